@@ -106,9 +106,16 @@ void UAnimNotifyState_MeleeTrace::NotifyTick(USkeletalMeshComponent* MeshComp, U
 
 FString UAnimNotifyState_MeleeTrace::GetNotifyName_Implementation() const
 {
-	FString ModeName = bOverrideTraceMode ?
-		(TraceMode == EMeleeTraceMode::Linear ? TEXT("Linear") : TEXT("Spherical")) :
-		TEXT("Default");
+	FString ModeName = TEXT("Default");
+	if (bOverrideTraceMode)
+	{
+		switch (TraceMode)
+		{
+			case EMeleeTraceMode::Linear:		ModeName = TEXT("Linear"); break;
+			case EMeleeTraceMode::Spherical:	ModeName = TEXT("Spherical"); break;
+			case EMeleeTraceMode::Swept:		ModeName = TEXT("Swept"); break;
+		}
+	}
 
 	FString SourceName = bOverrideMeshSource ?
 		(MeshSource == EMeleeTraceMeshSource::WeaponMesh ? TEXT("Weapon") : TEXT("Char")) :
@@ -0,0 +1,36 @@
+// CallOfTheMoutains - Animation Notify for Footsteps Implementation
+
+#include "AnimNotify_Footstep.h"
+#include "FootstepComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+
+UAnimNotify_Footstep::UAnimNotify_Footstep()
+{
+	// Set default notify color in editor
+#if WITH_EDITORONLY_DATA
+	NotifyColor = FColor(120, 180, 90, 255); // Green for locomotion
+#endif
+}
+
+void UAnimNotify_Footstep::Notify(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference)
+{
+	Super::Notify(MeshComp, Animation, EventReference);
+
+	AActor* Owner = MeshComp ? MeshComp->GetOwner() : nullptr;
+	UFootstepComponent* FootstepComp = Owner ? Owner->FindComponentByClass<UFootstepComponent>() : nullptr;
+	if (!FootstepComp)
+	{
+		// Animation previews and characters without footsteps
+		return;
+	}
+
+	const FName FootBone = FootBoneOverride.IsNone() ? FootstepComp->GetFootBone(bIsRightFoot) : FootBoneOverride;
+	const FVector FootLocation = MeshComp->DoesSocketExist(FootBone) ? MeshComp->GetSocketLocation(FootBone) : Owner->GetActorLocation();
+
+	FootstepComp->OnFootstepNotify(FootLocation, bIsRightFoot, MeshComp->GetAnimClass());
+}
+
+FString UAnimNotify_Footstep::GetNotifyName_Implementation() const
+{
+	return bIsRightFoot ? TEXT("Footstep R") : TEXT("Footstep L");
+}
@@ -0,0 +1,37 @@
+// CallOfTheMoutains - Animation Notify for Footsteps
+// Plays a footstep at the foot bone on the frame the foot plants
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Animation/AnimNotifies/AnimNotify.h"
+#include "AnimNotify_Footstep.generated.h"
+
+class UFootstepComponent;
+
+/**
+ * Animation Notify - Footstep
+ * Place on locomotion animations where each foot hits the ground. Calls the owner's
+ * UFootstepComponent with the foot bone's location, and switches that component from
+ * distance-based auto footsteps to notify-driven ones the first time it fires.
+ */
+UCLASS(meta = (DisplayName = "Footstep"))
+class CALLOFTHEMOUTAINS_API UAnimNotify_Footstep : public UAnimNotify
+{
+	GENERATED_BODY()
+
+public:
+	UAnimNotify_Footstep();
+
+	virtual void Notify(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference) override;
+
+	virtual FString GetNotifyName_Implementation() const override;
+
+	/** Which foot plants on this frame */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Footstep")
+	bool bIsRightFoot = true;
+
+	/** Bone to sample (None = the component's LeftFootBone/RightFootBone) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Footstep")
+	FName FootBoneOverride = NAME_None;
+};
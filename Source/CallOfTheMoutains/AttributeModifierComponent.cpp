@@ -0,0 +1,249 @@
+// CallOfTheMoutains - Attribute Modifier Component Implementation
+
+#include "AttributeModifierComponent.h"
+#include "HealthComponent.h"
+#include "CallOfTheMoutains.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "TimerManager.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Attribute Layer Changes"), STAT_AttributeLayerChanges, STATGROUP_CallOfTheMoutains);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Attribute Stack Recomputes"), STAT_AttributeStackRecomputes, STATGROUP_CallOfTheMoutains);
+
+UAttributeModifierComponent::UAttributeModifierComponent()
+{
+	// Purely event driven
+	PrimaryComponentTick.bCanEverTick = false;
+}
+
+UAttributeModifierComponent* UAttributeModifierComponent::FindOrAdd(AActor* Actor)
+{
+	if (!IsValid(Actor))
+	{
+		return nullptr;
+	}
+
+	if (UAttributeModifierComponent* Existing = Actor->FindComponentByClass<UAttributeModifierComponent>())
+	{
+		return Existing;
+	}
+
+	UAttributeModifierComponent* Created = NewObject<UAttributeModifierComponent>(Actor);
+	Actor->AddInstanceComponent(Created);
+	Created->RegisterComponent();
+	return Created;
+}
+
+void UAttributeModifierComponent::OnRegister()
+{
+	Super::OnRegister();
+
+	// Stacks created mid-play (FindOrAdd) would otherwise stay unknown to the health component
+	if (UHealthComponent* HealthComp = GetOwner() ? GetOwner()->FindComponentByClass<UHealthComponent>() : nullptr)
+	{
+		HealthComp->SetAttributeModifiers(this);
+	}
+}
+
+void UAttributeModifierComponent::OnUnregister()
+{
+	if (UHealthComponent* HealthComp = GetOwner() ? GetOwner()->FindComponentByClass<UHealthComponent>() : nullptr)
+	{
+		if (HealthComp->GetAttributeModifiers() == this)
+		{
+			HealthComp->SetAttributeModifiers(nullptr);
+		}
+	}
+
+	Super::OnUnregister();
+}
+
+void UAttributeModifierComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UWorld* World = GetWorld())
+	{
+		for (FAttributeModifierStack& Stack : Stacks)
+		{
+			for (FAttributeModifierLayer& Layer : Stack.Layers)
+			{
+				World->GetTimerManager().ClearTimer(Layer.ExpireTimer);
+			}
+		}
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+// ==================== Layers ====================
+
+FAttributeModifierLayer& UAttributeModifierComponent::GetLayer(EModifiedAttribute Attribute, EModifierSource Source)
+{
+	check(Attribute < EModifiedAttribute::Count && Source < EModifierSource::Count);
+	return Stacks[static_cast<int32>(Attribute)].Layers[static_cast<int32>(Source)];
+}
+
+void UAttributeModifierComponent::SetModifier(EModifiedAttribute Attribute, EModifierSource Source, float Additive, float Multiplier)
+{
+	if (Attribute >= EModifiedAttribute::Count || Source >= EModifierSource::Count)
+	{
+		return;
+	}
+
+	FAttributeModifierLayer& Layer = GetLayer(Attribute, Source);
+	if (Layer.bActive && Layer.Additive == Additive && Layer.Multiplier == Multiplier)
+	{
+		return;
+	}
+
+	Layer.Additive = Additive;
+	Layer.Multiplier = Multiplier;
+	Layer.bActive = true;
+	OnLayerChanged(Attribute);
+}
+
+void UAttributeModifierComponent::SetTimedModifier(EModifiedAttribute Attribute, EModifierSource Source, float Additive, float Multiplier, float Duration)
+{
+	UWorld* World = GetWorld();
+	if (Attribute >= EModifiedAttribute::Count || Source >= EModifierSource::Count || !World)
+	{
+		return;
+	}
+
+	SetModifier(Attribute, Source, Additive, Multiplier);
+
+	FTimerDelegate ExpireDelegate = FTimerDelegate::CreateUObject(this, &UAttributeModifierComponent::RemoveModifier, Attribute, Source);
+	World->GetTimerManager().SetTimer(GetLayer(Attribute, Source).ExpireTimer, ExpireDelegate, FMath::Max(Duration, KINDA_SMALL_NUMBER), false);
+}
+
+void UAttributeModifierComponent::RemoveModifier(EModifiedAttribute Attribute, EModifierSource Source)
+{
+	if (Attribute >= EModifiedAttribute::Count || Source >= EModifierSource::Count)
+	{
+		return;
+	}
+
+	FAttributeModifierLayer& Layer = GetLayer(Attribute, Source);
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(Layer.ExpireTimer);
+	}
+
+	if (!Layer.bActive)
+	{
+		return;
+	}
+
+	Layer.Additive = 0.0f;
+	Layer.Multiplier = 1.0f;
+	Layer.bActive = false;
+	OnLayerChanged(Attribute);
+}
+
+void UAttributeModifierComponent::RemoveSource(EModifierSource Source)
+{
+	for (int32 i = 0; i < static_cast<int32>(EModifiedAttribute::Count); ++i)
+	{
+		RemoveModifier(static_cast<EModifiedAttribute>(i), Source);
+	}
+}
+
+void UAttributeModifierComponent::OnLayerChanged(EModifiedAttribute Attribute)
+{
+	INC_DWORD_STAT(STAT_AttributeLayerChanges);
+
+	Stacks[static_cast<int32>(Attribute)].bDirty = true;
+
+	if (Attribute == EModifiedAttribute::MoveSpeed && bDriveMovementSpeed)
+	{
+		RequestMovementSpeedUpdate();
+	}
+
+	OnAttributeModified.Broadcast(Attribute);
+}
+
+// ==================== Values ====================
+
+void UAttributeModifierComponent::Resolve(FAttributeModifierStack& Stack)
+{
+	INC_DWORD_STAT(STAT_AttributeStackRecomputes);
+
+	Stack.Additive = 0.0f;
+	Stack.Multiplier = 1.0f;
+	for (const FAttributeModifierLayer& Layer : Stack.Layers)
+	{
+		if (Layer.bActive)
+		{
+			Stack.Additive += Layer.Additive;
+			Stack.Multiplier *= Layer.Multiplier;
+		}
+	}
+	Stack.bDirty = false;
+}
+
+float UAttributeModifierComponent::GetModifiedValue(EModifiedAttribute Attribute, float BaseValue) const
+{
+	if (Attribute >= EModifiedAttribute::Count)
+	{
+		return BaseValue;
+	}
+
+	FAttributeModifierStack& Stack = Stacks[static_cast<int32>(Attribute)];
+	if (Stack.bDirty)
+	{
+		Resolve(Stack);
+	}
+
+	return (BaseValue + Stack.Additive) * Stack.Multiplier;
+}
+
+void UAttributeModifierComponent::SetBaseWalkSpeed(float Speed)
+{
+	BaseWalkSpeed = Speed;
+
+	if (bDriveMovementSpeed)
+	{
+		ApplyMovementSpeed();
+	}
+}
+
+void UAttributeModifierComponent::RequestMovementSpeedUpdate()
+{
+	if (bMovementSpeedPending)
+	{
+		return;
+	}
+
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		ApplyMovementSpeed();
+		return;
+	}
+
+	bMovementSpeedPending = true;
+	World->GetTimerManager().SetTimerForNextTick(this, &UAttributeModifierComponent::ApplyMovementSpeed);
+}
+
+void UAttributeModifierComponent::ApplyMovementSpeed()
+{
+	bMovementSpeedPending = false;
+	if (!bDriveMovementSpeed)
+	{
+		return;
+	}
+
+	const ACharacter* Character = Cast<ACharacter>(GetOwner());
+	UCharacterMovementComponent* Movement = Character ? Character->GetCharacterMovement() : nullptr;
+	if (!Movement)
+	{
+		return;
+	}
+
+	// Owners that never set a base keep the speed they were configured with
+	if (BaseWalkSpeed < 0.0f)
+	{
+		BaseWalkSpeed = Movement->MaxWalkSpeed;
+	}
+
+	Movement->MaxWalkSpeed = FMath::Max(GetModifiedValue(EModifiedAttribute::MoveSpeed, BaseWalkSpeed), 0.0f);
+}
@@ -0,0 +1,163 @@
+// CallOfTheMoutains - Attribute Modifier Component
+// Per-attribute stack of additive and multiplicative modifier layers, one layer per source
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "AttributeModifierComponent.generated.h"
+
+/**
+ * Attributes modifier layers can change. The base value stays with the component that
+ * owns the attribute (HealthComponent, SprintComponent, the character's own speeds).
+ */
+UENUM(BlueprintType)
+enum class EModifiedAttribute : uint8
+{
+	MoveSpeed		UMETA(DisplayName = "Move Speed"),		// CharacterMovement MaxWalkSpeed
+	StaminaRegen	UMETA(DisplayName = "Stamina Regen"),	// HealthComponent StaminaRegenRate
+	DamageTaken		UMETA(DisplayName = "Damage Taken"),	// HealthComponent DamageMultiplier
+	Count			UMETA(Hidden)
+};
+
+/**
+ * Where a modifier layer comes from. Each source has at most one layer per attribute.
+ */
+UENUM(BlueprintType)
+enum class EModifierSource : uint8
+{
+	TimePeriod		UMETA(DisplayName = "Time Period"),
+	Weather			UMETA(DisplayName = "Weather"),
+	BileSlow		UMETA(DisplayName = "Bile Slow"),
+	EquipmentWeight	UMETA(DisplayName = "Equipment Weight"),
+	Sprint			UMETA(DisplayName = "Sprint"),
+	Custom			UMETA(DisplayName = "Custom"),
+	Count			UMETA(Hidden)
+};
+
+/** Broadcast when any layer of an attribute changes */
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnAttributeModified, EModifiedAttribute);
+
+/**
+ * One source's modifier on one attribute
+ */
+struct FAttributeModifierLayer
+{
+	float Additive = 0.0f;
+	float Multiplier = 1.0f;
+	bool bActive = false;
+
+	/** Set for timed layers (SetTimedModifier) */
+	FTimerHandle ExpireTimer;
+};
+
+/**
+ * All layers of one attribute and their combined result
+ */
+struct FAttributeModifierStack
+{
+	FAttributeModifierLayer Layers[static_cast<int32>(EModifierSource::Count)];
+
+	/** Sum of additive and product of multiplicative layers (valid while !bDirty) */
+	float Additive = 0.0f;
+	float Multiplier = 1.0f;
+	bool bDirty = false;
+};
+
+/**
+ * Attribute Modifier Component
+ *
+ * Time period, weather, debuffs, equipment weight and sprint each set their own layer
+ * instead of writing into the attribute owner's values, so layers never fight over
+ * "original" values and removing one restores the rest exactly.
+ *
+ * Final value = (Base + sum of additive layers) * product of multiplicative layers.
+ * Changing a layer only marks its attribute dirty; the combination is recomputed on the
+ * next read, so readers that query every frame pay for a multiply-add.
+ *
+ * MoveSpeed is pushed onto the owner's CharacterMovement on the tick after a layer changes,
+ * so several changes in one frame resolve its stack once. It's computed from the base speed
+ * given to SetBaseWalkSpeed - owners must set their walk speed through it rather than writing
+ * MaxWalkSpeed, or the stack keeps applying the old base. Components that drive MaxWalkSpeed
+ * from GetModifiedValue themselves clear bDriveMovementSpeed (USprintComponent).
+ *
+ * Only created on actors something modifies: sources call FindOrAdd. Readers don't search
+ * for it - it hands itself to the owner's UHealthComponent when registered.
+ */
+UCLASS(ClassGroup=(Gameplay), meta=(BlueprintSpawnableComponent))
+class CALLOFTHEMOUTAINS_API UAttributeModifierComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UAttributeModifierComponent();
+
+	/** The actor's modifier component, created and registered if it has none (nullptr for invalid actors) */
+	static UAttributeModifierComponent* FindOrAdd(AActor* Actor);
+
+protected:
+	virtual void OnRegister() override;
+	virtual void OnUnregister() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+public:
+	// ==================== Configuration ====================
+
+	/** Write MoveSpeed to the owner's CharacterMovement when it changes */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Attributes")
+	bool bDriveMovementSpeed = true;
+
+	// ==================== Layers ====================
+
+	/** Add or replace a source's layer on an attribute */
+	UFUNCTION(BlueprintCallable, Category = "Attributes")
+	void SetModifier(EModifiedAttribute Attribute, EModifierSource Source, float Additive = 0.0f, float Multiplier = 1.0f);
+
+	/** Add or replace a layer that removes itself after Duration seconds (re-applying restarts the timer) */
+	UFUNCTION(BlueprintCallable, Category = "Attributes")
+	void SetTimedModifier(EModifiedAttribute Attribute, EModifierSource Source, float Additive, float Multiplier, float Duration);
+
+	/** Remove a source's layer from an attribute */
+	UFUNCTION(BlueprintCallable, Category = "Attributes")
+	void RemoveModifier(EModifiedAttribute Attribute, EModifierSource Source);
+
+	/** Remove a source's layers from every attribute */
+	UFUNCTION(BlueprintCallable, Category = "Attributes")
+	void RemoveSource(EModifierSource Source);
+
+	// ==================== Values ====================
+
+	/** Final value of an attribute for a base value */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Attributes")
+	float GetModifiedValue(EModifiedAttribute Attribute, float BaseValue) const;
+
+	/** Set the speed MoveSpeed layers apply to (the owner's unmodified walk speed) */
+	UFUNCTION(BlueprintCallable, Category = "Attributes")
+	void SetBaseWalkSpeed(float Speed);
+
+	/** Called when any layer of an attribute changes */
+	FOnAttributeModified OnAttributeModified;
+
+private:
+	mutable FAttributeModifierStack Stacks[static_cast<int32>(EModifiedAttribute::Count)];
+
+	/** Walk speed MoveSpeed layers apply to (< 0 = take the movement component's on first use) */
+	float BaseWalkSpeed = -1.0f;
+
+	/** A MoveSpeed change is waiting for next tick's ApplyMovementSpeed */
+	bool bMovementSpeedPending = false;
+
+	FAttributeModifierLayer& GetLayer(EModifiedAttribute Attribute, EModifierSource Source);
+
+	/** Mark an attribute for recompute, notify listeners and update movement */
+	void OnLayerChanged(EModifiedAttribute Attribute);
+
+	/** Combine a dirty stack's layers */
+	static void Resolve(FAttributeModifierStack& Stack);
+
+	/** Push the modified walk speed onto the owner's CharacterMovement next tick (once per frame) */
+	void RequestMovementSpeedUpdate();
+
+	/** Push the modified walk speed onto the owner's CharacterMovement */
+	void ApplyMovementSpeed();
+};
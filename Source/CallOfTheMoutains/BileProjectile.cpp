@@ -13,6 +13,8 @@
 #include "Components/AudioComponent.h"
 #include "Kismet/GameplayStatics.h"
 #include "HealthComponent.h"
+#include "AttributeModifierComponent.h"
+#include "DamageableRegistry.h"
 
 ABileProjectile::ABileProjectile()
 {
@@ -124,7 +126,7 @@ void ABileProjectile::ApplyDamage(AActor* Target, const FHitResult& Hit)
 	}
 
 	// Try to find health component
-	UHealthComponent* TargetHealth = Target->FindComponentByClass<UHealthComponent>();
+	UHealthComponent* TargetHealth = UDamageableRegistry::GetHealthComponent(Target);
 	if (TargetHealth)
 	{
 		AController* InstigatorController = nullptr;
@@ -163,35 +165,16 @@ void ABileProjectile::ApplySlowDebuff(AActor* Target)
 
 	// Only apply slow to characters with movement component
 	ACharacter* Character = Cast<ACharacter>(Target);
-	if (!Character)
+	if (!Character || !Character->GetCharacterMovement())
 	{
 		return;
 	}
 
-	UCharacterMovementComponent* Movement = Character->GetCharacterMovement();
-	if (!Movement)
+	// One slow layer per target - another hit refreshes its duration instead of stacking
+	if (UAttributeModifierComponent* AttributeModifiers = UAttributeModifierComponent::FindOrAdd(Character))
 	{
-		return;
+		AttributeModifiers->SetTimedModifier(EModifiedAttribute::MoveSpeed, EModifierSource::BileSlow, 0.0f, 1.0f - SlowPercent, SlowDuration);
 	}
-
-	// Store original speed
-	float OriginalMaxWalkSpeed = Movement->MaxWalkSpeed;
-
-	// Apply slow
-	Movement->MaxWalkSpeed *= (1.0f - SlowPercent);
-
-	// Set timer to restore speed
-	FTimerHandle SlowTimerHandle;
-	FTimerDelegate SlowDelegate;
-	SlowDelegate.BindLambda([Movement, OriginalMaxWalkSpeed]()
-	{
-		if (Movement && IsValid(Movement))
-		{
-			Movement->MaxWalkSpeed = OriginalMaxWalkSpeed;
-		}
-	});
-
-	GetWorld()->GetTimerManager().SetTimer(SlowTimerHandle, SlowDelegate, SlowDuration, false);
 }
 
 void ABileProjectile::SpawnImpactEffects(FVector Location, FVector Normal)
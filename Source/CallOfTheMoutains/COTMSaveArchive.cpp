@@ -0,0 +1,566 @@
+// CallOfTheMoutains - Save Archive Implementation
+
+#include "COTMSaveArchive.h"
+#include "COTMSaveGame.h"
+#include "SaveJournal.h"
+#include "CallOfTheMoutains.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/Crc.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Kismet/GameplayStatics.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+DECLARE_CYCLE_STAT(TEXT("Save Archive Write"), STAT_SaveArchiveWrite, STATGROUP_CallOfTheMoutains);
+DECLARE_CYCLE_STAT(TEXT("Save Archive Read"), STAT_SaveArchiveRead, STATGROUP_CallOfTheMoutains);
+DECLARE_CYCLE_STAT(TEXT("Save Slot Peek"), STAT_SaveSlotPeek, STATGROUP_CallOfTheMoutains);
+
+namespace
+{
+	/** "COTS" */
+	constexpr uint32 SaveArchiveMagic = 0x434F5453;
+
+	/** The CRC field follows magic and schema version; it covers every byte after itself */
+	constexpr int32 CrcOffset = sizeof(uint32) * 2;
+	constexpr int32 CrcCoveredOffset = CrcOffset + sizeof(uint32);
+
+	/** Written next to a slot while it's replaced */
+	const TCHAR* const TempSuffix = TEXT(".tmp");
+	const TCHAR* const BackupSuffix = TEXT(".bak");
+
+	/** Id, version, offset, size */
+	constexpr int32 SectionTableEntrySize = sizeof(uint32) * 4;
+
+	// ==================== Sections ====================
+	// Shared by read and write. Guard fields added later with "if (Version >= N)".
+
+	void SerializeMeta(FArchive& Ar, UCOTMSaveGame& Save, uint32 Version)
+	{
+		Ar << Save.SaveSlotName;
+		Ar << Save.UserIndex;
+	}
+
+	void SerializePlayer(FArchive& Ar, UCOTMSaveGame& Save, uint32 Version)
+	{
+		Ar << Save.PlayerLocation;
+		Ar << Save.PlayerRotation;
+		Ar << Save.HealthPercent;
+		Ar << Save.StaminaPercent;
+	}
+
+	void SerializeInventory(FArchive& Ar, UCOTMSaveGame& Save, uint32 Version)
+	{
+		int32 NumSlots = Save.InventorySlots.Num();
+		Ar << NumSlots;
+		if (Ar.IsLoading())
+		{
+			Save.InventorySlots.SetNum(FMath::Max(NumSlots, 0));
+		}
+
+		for (FInventorySlot& Slot : Save.InventorySlots)
+		{
+			FCOTMSaveArchive::SerializeInventorySlot(Ar, Slot);
+		}
+	}
+
+	void SerializeEquipment(FArchive& Ar, UCOTMSaveGame& Save, uint32 Version)
+	{
+		int32 NumEquipped = Save.EquippedItems.Num();
+		Ar << NumEquipped;
+		if (Ar.IsLoading())
+		{
+			Save.EquippedItems.Empty(NumEquipped);
+			for (int32 i = 0; i < NumEquipped && !Ar.IsError(); ++i)
+			{
+				EEquipmentSlot Slot = EEquipmentSlot::None;
+				FName ItemID;
+				Ar << Slot;
+				FCOTMSaveArchive::SerializeName(Ar, ItemID);
+				Save.EquippedItems.Add(Slot, ItemID);
+			}
+		}
+		else
+		{
+			for (TPair<EEquipmentSlot, FName>& Pair : Save.EquippedItems)
+			{
+				Ar << Pair.Key;
+				FCOTMSaveArchive::SerializeName(Ar, Pair.Value);
+			}
+		}
+
+		int32 NumHotbarSlots = Save.HotbarSlots.Num();
+		Ar << NumHotbarSlots;
+		if (Ar.IsLoading())
+		{
+			Save.HotbarSlots.Empty(NumHotbarSlots);
+			for (int32 i = 0; i < NumHotbarSlots && !Ar.IsError(); ++i)
+			{
+				EHotbarSlot Slot = EHotbarSlot::Special;
+				Ar << Slot;
+				FCOTMSaveArchive::SerializeHotbarSlot(Ar, Save.HotbarSlots.Add(Slot));
+			}
+		}
+		else
+		{
+			for (TPair<EHotbarSlot, FSavedHotbarSlot>& Pair : Save.HotbarSlots)
+			{
+				Ar << Pair.Key;
+				FCOTMSaveArchive::SerializeHotbarSlot(Ar, Pair.Value);
+			}
+		}
+
+		Ar << Save.bWeaponsStowed;
+	}
+
+	void SerializeDayNight(FArchive& Ar, UCOTMSaveGame& Save, uint32 Version)
+	{
+		Ar << Save.bHasDayNightData;
+		Ar << Save.CurrentGameTime.Hour;
+		Ar << Save.CurrentGameTime.Minute;
+		Ar << Save.CurrentGameTime.Day;
+		Ar << Save.CurrentWeather;
+	}
+
+	void SerializeWorldState(FArchive& Ar, UCOTMSaveGame& Save, uint32 Version)
+	{
+		int32 NumLevels = Save.WorldStateLevels.Num();
+		Ar << NumLevels;
+		if (Ar.IsLoading())
+		{
+			Save.WorldStateLevels.SetNum(FMath::Max(NumLevels, 0));
+		}
+
+		for (FSavedWorldStateLevel& Level : Save.WorldStateLevels)
+		{
+			FCOTMSaveArchive::SerializeWorldStateLevel(Ar, Level);
+		}
+	}
+
+	void SerializeWeather(FArchive& Ar, UCOTMSaveGame& Save, uint32 Version)
+	{
+		Ar << Save.bHasWeatherTimeline;
+		FCOTMSaveArchive::SerializeWeatherTimeline(Ar, Save.WeatherTimeline);
+	}
+
+	struct FSaveSectionDesc
+	{
+		ECOTMSaveSection Id;
+
+		/** Version written by this build */
+		uint32 Version;
+
+		void (*Serialize)(FArchive&, UCOTMSaveGame&, uint32);
+	};
+
+	/** Every section this build reads and writes, in file order */
+	const FSaveSectionDesc SaveSections[] =
+	{
+		{ ECOTMSaveSection::Meta, 1, &SerializeMeta },
+		{ ECOTMSaveSection::Player, 1, &SerializePlayer },
+		{ ECOTMSaveSection::Inventory, 1, &SerializeInventory },
+		{ ECOTMSaveSection::Equipment, 1, &SerializeEquipment },
+		{ ECOTMSaveSection::DayNight, 1, &SerializeDayNight },
+		{ ECOTMSaveSection::WorldState, 1, &SerializeWorldState },
+		{ ECOTMSaveSection::Weather, 1, &SerializeWeather },
+	};
+
+	const FSaveSectionDesc* FindSection(uint32 Id)
+	{
+		for (const FSaveSectionDesc& Section : SaveSections)
+		{
+			if (static_cast<uint32>(Section.Id) == Id)
+			{
+				return &Section;
+			}
+		}
+		return nullptr;
+	}
+}
+
+void FCOTMSaveArchive::SerializeName(FArchive& Ar, FName& Name)
+{
+	FString NameString = Ar.IsLoading() ? FString() : Name.ToString();
+	Ar << NameString;
+	if (Ar.IsLoading())
+	{
+		Name = FName(*NameString);
+	}
+}
+
+void FCOTMSaveArchive::SerializeInventorySlot(FArchive& Ar, FInventorySlot& Slot)
+{
+	SerializeName(Ar, Slot.ItemID);
+	Ar << Slot.Quantity;
+	Ar << Slot.AcquiredOrder;
+}
+
+void FCOTMSaveArchive::SerializeHotbarSlot(FArchive& Ar, FSavedHotbarSlot& Slot)
+{
+	int32 NumItems = Slot.AssignedItems.Num();
+	Ar << NumItems;
+	if (Ar.IsLoading())
+	{
+		Slot.AssignedItems.SetNum(FMath::Max(NumItems, 0));
+	}
+
+	for (FName& ItemID : Slot.AssignedItems)
+	{
+		SerializeName(Ar, ItemID);
+	}
+
+	Ar << Slot.CurrentIndex;
+}
+
+void FCOTMSaveArchive::SerializeWorldStateLevel(FArchive& Ar, FSavedWorldStateLevel& Level)
+{
+	SerializeName(Ar, Level.LevelName);
+	Ar << Level.PackedRecords;
+}
+
+void FCOTMSaveArchive::SerializeWeatherTimeline(FArchive& Ar, FWeatherTimelineCursor& Cursor)
+{
+	Ar << Cursor.Seed;
+	Ar << Cursor.Segment;
+	Ar << Cursor.Weather;
+	Ar << Cursor.SegmentStart;
+	Ar << Cursor.Time;
+	Ar << Cursor.bForced;
+	Ar << Cursor.ForcedTarget;
+	Ar << Cursor.ForcedTransitionDuration;
+}
+
+bool FCOTMSaveArchive::Write(const UCOTMSaveGame* SaveObject, TArray<uint8>& OutData)
+{
+	SCOPE_CYCLE_COUNTER(STAT_SaveArchiveWrite);
+
+	if (!SaveObject)
+	{
+		return false;
+	}
+
+	// Section functions are shared with loading and take a mutable object; writing doesn't modify it
+	UCOTMSaveGame& Save = *const_cast<UCOTMSaveGame*>(SaveObject);
+
+	constexpr int32 NumSections = UE_ARRAY_COUNT(SaveSections);
+	const int32 PayloadStart = FixedHeaderSize + NumSections * SectionTableEntrySize;
+
+	// Payloads first, so the table can record their offsets
+	TArray<uint8> Payload;
+	FMemoryWriter PayloadWriter(Payload);
+	uint32 SectionOffsets[NumSections];
+	uint32 SectionSizes[NumSections];
+
+	for (int32 i = 0; i < NumSections; ++i)
+	{
+		const int64 Start = PayloadWriter.Tell();
+		SaveSections[i].Serialize(PayloadWriter, Save, SaveSections[i].Version);
+		SectionOffsets[i] = static_cast<uint32>(PayloadStart + Start);
+		SectionSizes[i] = static_cast<uint32>(PayloadWriter.Tell() - Start);
+	}
+
+	OutData.Reset(PayloadStart + Payload.Num());
+	FMemoryWriter Writer(OutData);
+
+	uint32 Magic = SaveArchiveMagic;
+	uint32 Schema = SchemaVersion;
+	uint32 Crc = 0;
+	int64 TimestampTicks = Save.SaveTimestamp.GetTicks();
+	float PlayTime = Save.PlayTimeSeconds;
+	uint32 SnapshotId = Save.JournalSnapshotId;
+	uint32 SectionCount = NumSections;
+	Writer << Magic << Schema << Crc << TimestampTicks << PlayTime << SnapshotId << SectionCount;
+	check(Writer.Tell() == FixedHeaderSize);
+
+	for (int32 i = 0; i < NumSections; ++i)
+	{
+		uint32 Id = static_cast<uint32>(SaveSections[i].Id);
+		uint32 Version = SaveSections[i].Version;
+		Writer << Id << Version << SectionOffsets[i] << SectionSizes[i];
+	}
+
+	Writer.Serialize(Payload.GetData(), Payload.Num());
+
+	Crc = FCrc::MemCrc32(OutData.GetData() + CrcCoveredOffset, OutData.Num() - CrcCoveredOffset);
+	FMemory::Memcpy(OutData.GetData() + CrcOffset, &Crc, sizeof(Crc));
+
+	return !Writer.IsError() && !PayloadWriter.IsError();
+}
+
+bool FCOTMSaveArchive::HasHeader(const TArray<uint8>& Data)
+{
+	uint32 Magic = 0;
+	if (Data.Num() >= static_cast<int32>(sizeof(Magic)))
+	{
+		FMemory::Memcpy(&Magic, Data.GetData(), sizeof(Magic));
+	}
+	return Magic == SaveArchiveMagic;
+}
+
+bool FCOTMSaveArchive::ReadHeader(const uint8* Data, int64 Size, FCOTMSaveSlotInfo& OutInfo)
+{
+	OutInfo = FCOTMSaveSlotInfo();
+
+	if (!Data || Size < FixedHeaderSize)
+	{
+		return false;
+	}
+
+	TArrayView<const uint8> HeaderView(Data, FixedHeaderSize);
+	FMemoryReaderView Reader(HeaderView);
+
+	uint32 Magic = 0;
+	uint32 Schema = 0;
+	uint32 Crc = 0;
+	int64 TimestampTicks = 0;
+	float PlayTime = 0.0f;
+	uint32 SnapshotId = 0;
+	uint32 SectionCount = 0;
+	Reader << Magic << Schema << Crc << TimestampTicks << PlayTime << SnapshotId << SectionCount;
+
+	// A newer schema may have moved these fields - don't guess
+	if (Magic != SaveArchiveMagic || Schema == 0 || Schema > SchemaVersion)
+	{
+		return false;
+	}
+
+	OutInfo.bValid = true;
+	OutInfo.SaveTimestamp = FDateTime(TimestampTicks);
+	OutInfo.PlayTimeSeconds = PlayTime;
+	OutInfo.SchemaVersion = static_cast<int32>(Schema);
+	OutInfo.JournalSnapshotId = SnapshotId;
+	return true;
+}
+
+bool FCOTMSaveArchive::Validate(const TArray<uint8>& Data)
+{
+	FCOTMSaveSlotInfo Info;
+	if (!ReadHeader(Data.GetData(), Data.Num(), Info))
+	{
+		return false;
+	}
+
+	uint32 StoredCrc = 0;
+	FMemory::Memcpy(&StoredCrc, Data.GetData() + CrcOffset, sizeof(StoredCrc));
+	return StoredCrc == FCrc::MemCrc32(Data.GetData() + CrcCoveredOffset, Data.Num() - CrcCoveredOffset);
+}
+
+bool FCOTMSaveArchive::Read(const TArray<uint8>& Data, UCOTMSaveGame* SaveObject)
+{
+	SCOPE_CYCLE_COUNTER(STAT_SaveArchiveRead);
+
+	if (!SaveObject || !Validate(Data))
+	{
+		return false;
+	}
+
+	FMemoryReader Reader(Data);
+	uint32 Magic = 0;
+	uint32 Schema = 0;
+	uint32 Crc = 0;
+	int64 TimestampTicks = 0;
+	float PlayTime = 0.0f;
+	uint32 SnapshotId = 0;
+	uint32 SectionCount = 0;
+	Reader << Magic << Schema << Crc << TimestampTicks << PlayTime << SnapshotId << SectionCount;
+
+	if (static_cast<int64>(SectionCount) * SectionTableEntrySize > Data.Num() - FixedHeaderSize)
+	{
+		return false;
+	}
+
+	SaveObject->SaveTimestamp = FDateTime(TimestampTicks);
+	SaveObject->PlayTimeSeconds = PlayTime;
+	SaveObject->JournalSnapshotId = SnapshotId;
+
+	for (uint32 i = 0; i < SectionCount; ++i)
+	{
+		uint32 Id = 0;
+		uint32 Version = 0;
+		uint32 Offset = 0;
+		uint32 Size = 0;
+		Reader << Id << Version << Offset << Size;
+
+		if (static_cast<int64>(Offset) + Size > Data.Num())
+		{
+			UE_LOG(LogTemp, Warning, TEXT("SaveArchive: Section %u is out of bounds"), Id);
+			return false;
+		}
+
+		const FSaveSectionDesc* Section = FindSection(Id);
+		if (!Section)
+		{
+			// Written by a newer build - skip it
+			continue;
+		}
+
+		if (Version > Section->Version)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("SaveArchive: Section %u version %u is newer than supported (%u) - using defaults"), Id, Version, Section->Version);
+			continue;
+		}
+
+		FMemoryReaderView SectionReader(TArrayView<const uint8>(Data.GetData() + Offset, Size));
+		Section->Serialize(SectionReader, *SaveObject, Version);
+
+		if (SectionReader.IsError())
+		{
+			UE_LOG(LogTemp, Warning, TEXT("SaveArchive: Section %u failed to load"), Id);
+			return false;
+		}
+	}
+
+	return true;
+}
+
+FString FCOTMSaveArchive::GetSlotPath(const FString& SlotName)
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("SaveGames"), SlotName + TEXT(".sav"));
+}
+
+bool FCOTMSaveArchive::WriteSlotData(const FString& SlotName, int32 UserIndex, const TArray<uint8>& Data)
+{
+#if PLATFORM_DESKTOP
+	IFileManager& FileManager = IFileManager::Get();
+	const FString SlotPath = GetSlotPath(SlotName);
+	const FString TempPath = SlotPath + TempSuffix;
+	const FString BackupPath = SlotPath + BackupSuffix;
+
+	// Flushed to disk before anything is renamed - a rename can otherwise land ahead of the data
+	FileManager.MakeDirectory(*FPaths::GetPath(TempPath), true);
+	TUniquePtr<IFileHandle> TempFile(FPlatformFileManager::Get().GetPlatformFile().OpenWrite(*TempPath));
+	const bool bWritten = TempFile && TempFile->Write(Data.GetData(), Data.Num()) && TempFile->Flush(true);
+	TempFile.Reset();
+
+	if (!bWritten)
+	{
+		FileManager.Delete(*TempPath, false, false, true);
+		return false;
+	}
+
+	// Move deletes the destination before renaming, so keep the previous save as .bak rather than
+	// replacing it directly. A crash between the steps leaves .tmp/.bak for ReadSlotData to recover.
+	if (FileManager.FileExists(*SlotPath) && !FileManager.Move(*BackupPath, *SlotPath, true, true))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("SaveArchive: Failed to back up %s"), *SlotPath);
+		FileManager.Delete(*TempPath, false, false, true);
+		return false;
+	}
+
+	if (!FileManager.Move(*SlotPath, *TempPath, true, true))
+	{
+		// The temp file stays behind as the recovery copy
+		UE_LOG(LogTemp, Warning, TEXT("SaveArchive: Failed to replace %s"), *SlotPath);
+		return false;
+	}
+
+	return true;
+#else
+	return UGameplayStatics::SaveDataToSlot(Data, SlotName, UserIndex);
+#endif
+}
+
+bool FCOTMSaveArchive::ReadSlotData(const FString& SlotName, int32 UserIndex, TArray<uint8>& OutData)
+{
+	OutData.Reset();
+	const bool bLoaded = UGameplayStatics::LoadDataFromSlot(OutData, SlotName, UserIndex);
+	if (bLoaded && (!HasHeader(OutData) || Validate(OutData)))
+	{
+		return true;
+	}
+
+#if PLATFORM_DESKTOP
+	// Missing or broken - a write was interrupted. The temp file is newer than the backup.
+	const FString SlotPath = GetSlotPath(SlotName);
+	for (const TCHAR* Suffix : { TempSuffix, BackupSuffix })
+	{
+		TArray<uint8> RecoveryData;
+		if (FFileHelper::LoadFileToArray(RecoveryData, *(SlotPath + Suffix), FILEREAD_Silent) && Validate(RecoveryData))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("SaveArchive: %s is %s - recovered from %s%s"), *SlotName, bLoaded ? TEXT("invalid") : TEXT("missing"), *SlotName, Suffix);
+			OutData = MoveTemp(RecoveryData);
+			return true;
+		}
+	}
+#endif
+
+	// Broken slot data is still returned so callers can report it
+	return bLoaded;
+}
+
+void FCOTMSaveArchive::DeleteRecoveryFiles(const FString& SlotName)
+{
+#if PLATFORM_DESKTOP
+	const FString SlotPath = GetSlotPath(SlotName);
+	IFileManager::Get().Delete(*(SlotPath + TempSuffix), false, false, true);
+	IFileManager::Get().Delete(*(SlotPath + BackupSuffix), false, false, true);
+#endif
+}
+
+void FCOTMSaveArchive::FindSlotNames(TArray<FString>& OutSlotNames)
+{
+	const FString SaveDir = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("SaveGames"));
+
+	TArray<FString> FileNames;
+	IFileManager::Get().FindFiles(FileNames, *FPaths::Combine(SaveDir, TEXT("*.sav")), true, false);
+
+	for (const FString& FileName : FileNames)
+	{
+		OutSlotNames.Add(FPaths::GetBaseFilename(FileName));
+	}
+}
+
+bool FCOTMSaveArchive::PeekSlot(const FString& SlotName, int32 UserIndex, FCOTMSaveSlotInfo& OutInfo)
+{
+	SCOPE_CYCLE_COUNTER(STAT_SaveSlotPeek);
+
+	OutInfo = FCOTMSaveSlotInfo();
+
+	const FString SlotPath = GetSlotPath(SlotName);
+	uint8 Header[FixedHeaderSize];
+
+	TUniquePtr<FArchive> FileReader(IFileManager::Get().CreateFileReader(*SlotPath, FILEREAD_Silent));
+	if (FileReader)
+	{
+		const int64 HeaderBytes = FMath::Min<int64>(FileReader->TotalSize(), FixedHeaderSize);
+		FileReader->Serialize(Header, HeaderBytes);
+
+		if (!ReadHeader(Header, HeaderBytes, OutInfo) && HeaderBytes > 0)
+		{
+			// Legacy property save - the file time is the best available timestamp
+			OutInfo.bValid = true;
+			OutInfo.SaveTimestamp = IFileManager::Get().GetTimeStamp(*SlotPath);
+		}
+	}
+	else
+	{
+		// Save system without plain files, or a slot lost mid-write - load it, decode only its header
+		TArray<uint8> Data;
+		if (!ReadSlotData(SlotName, UserIndex, Data))
+		{
+			return false;
+		}
+
+		if (!ReadHeader(Data.GetData(), Data.Num(), OutInfo) && Data.Num() > 0)
+		{
+			OutInfo.bValid = true;
+		}
+	}
+
+	if (!OutInfo.bValid)
+	{
+		return false;
+	}
+
+	OutInfo.SlotName = SlotName;
+
+	// Journal records written since the snapshot carry the latest time
+	if (OutInfo.SchemaVersion > 0)
+	{
+		FSaveJournal::ReadLatestEntryInfo(FSaveJournal::GetJournalPath(SlotName), OutInfo.JournalSnapshotId,
+			OutInfo.SaveTimestamp, OutInfo.PlayTimeSeconds);
+	}
+
+	return true;
+}
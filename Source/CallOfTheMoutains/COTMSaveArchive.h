@@ -0,0 +1,112 @@
+// CallOfTheMoutains - Save Archive
+// Versioned binary layout for UCOTMSaveGame: fixed header, section table, per-section payloads
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UCOTMSaveGame;
+struct FCOTMSaveSlotInfo;
+struct FInventorySlot;
+struct FSavedHotbarSlot;
+struct FSavedWorldStateLevel;
+struct FWeatherTimelineCursor;
+
+/**
+ * Save file sections. Values are written to disk - never renumber, only append.
+ */
+enum class ECOTMSaveSection : uint32
+{
+	Meta = 1,
+	Player = 2,
+	Inventory = 3,
+	Equipment = 4,
+	DayNight = 5,
+	WorldState = 6,
+	Weather = 7
+};
+
+/**
+ * Save Archive
+ *
+ * File layout:
+ * - Fixed header: magic, schema version, CRC, save timestamp, play time, journal snapshot id,
+ *   section count. Readable on its own, so slot menus can show a save without loading it.
+ * - Section table: id, version, offset and size of every section.
+ * - Section payloads.
+ * The CRC covers everything after the CRC field, so a corrupt file is rejected before any
+ * section is parsed.
+ *
+ * Each section has its own version. Its serialize function reads every version it ever wrote:
+ * fields added in version N are guarded with Version >= N and keep their defaults when older
+ * data is loaded - that is the section's migration. Unknown sections are skipped and missing
+ * sections leave defaults, so sections can be added without bumping the schema version.
+ * Files without the header were written by UGameplayStatics::SaveGameToSlot and are loaded
+ * through LoadGameFromMemory; the next save rewrites them in this layout.
+ *
+ * Everything here is thread-safe as long as no other thread touches the save object.
+ */
+struct CALLOFTHEMOUTAINS_API FCOTMSaveArchive
+{
+	/** Layout of the header and section table */
+	static constexpr uint32 SchemaVersion = 1;
+
+	/** Bytes needed for ReadHeader */
+	static constexpr int32 FixedHeaderSize = 32;
+
+	/** Serialize a save object */
+	static bool Write(const UCOTMSaveGame* SaveObject, TArray<uint8>& OutData);
+
+	/** Whether data has a valid header and checksum (cheap - no section is parsed) */
+	static bool Validate(const TArray<uint8>& Data);
+
+	/** Fill a save object from data written by Write. Fails without touching it if Validate fails */
+	static bool Read(const TArray<uint8>& Data, UCOTMSaveGame* SaveObject);
+
+	/** Whether data starts with this layout's header (as opposed to a legacy save) */
+	static bool HasHeader(const TArray<uint8>& Data);
+
+	/** Decode the fixed header from its first FixedHeaderSize bytes */
+	static bool ReadHeader(const uint8* Data, int64 Size, FCOTMSaveSlotInfo& OutInfo);
+
+	/** Path the generic save system stores a slot at */
+	static FString GetSlotPath(const FString& SlotName);
+
+	/**
+	 * Write slot data crash-safely: into a flushed temp file next to the slot, the previous save
+	 * moved to .bak, then the temp file renamed into place. An interrupted write always leaves
+	 * the slot, its .tmp or its .bak for ReadSlotData. Platforms whose save system doesn't use
+	 * plain files write through UGameplayStatics::SaveDataToSlot.
+	 */
+	static bool WriteSlotData(const FString& SlotName, int32 UserIndex, const TArray<uint8>& Data);
+
+	/**
+	 * Read slot data written by WriteSlotData. When the slot is missing or fails validation, falls
+	 * back to a valid .tmp, then .bak, left by an interrupted write.
+	 * @return Whether any data was found (it may still fail Validate if nothing could be recovered)
+	 */
+	static bool ReadSlotData(const FString& SlotName, int32 UserIndex, TArray<uint8>& OutData);
+
+	/** Delete a slot's .tmp/.bak so ReadSlotData can't bring a deleted slot back */
+	static void DeleteRecoveryFiles(const FString& SlotName);
+
+	/** Names of every slot file in the save folder (empty on save systems without plain files) */
+	static void FindSlotNames(TArray<FString>& OutSlotNames);
+
+	/**
+	 * Read only the header of a slot's file (plus its journal, for the latest timestamp).
+	 * Falls back to loading the whole slot on save systems that don't store plain files.
+	 */
+	static bool PeekSlot(const FString& SlotName, int32 UserIndex, FCOTMSaveSlotInfo& OutInfo);
+
+	// ==================== Field Helpers ====================
+	// Shared with the save journal so both files encode items the same way
+
+	/** Names are written as strings so files don't depend on the name table */
+	static void SerializeName(FArchive& Ar, FName& Name);
+
+	static void SerializeInventorySlot(FArchive& Ar, FInventorySlot& Slot);
+	static void SerializeHotbarSlot(FArchive& Ar, FSavedHotbarSlot& Slot);
+	static void SerializeWorldStateLevel(FArchive& Ar, FSavedWorldStateLevel& Level);
+	static void SerializeWeatherTimeline(FArchive& Ar, FWeatherTimelineCursor& Cursor);
+};
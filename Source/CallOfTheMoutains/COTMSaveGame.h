@@ -23,6 +23,55 @@ struct FSavedHotbarSlot
 	int32 CurrentIndex = 0;
 };
 
+/**
+ * Saved world state of one level, packed by UWorldStateSubsystem
+ */
+USTRUCT()
+struct FSavedWorldStateLevel
+{
+	GENERATED_BODY()
+
+	/** Level package name */
+	UPROPERTY(SaveGame)
+	FName LevelName;
+
+	/** Actor GUID/state records - decoded only when the level is loaded */
+	UPROPERTY(SaveGame)
+	TArray<uint8> PackedRecords;
+};
+
+/**
+ * Save slot summary read from a save file's header (no full load)
+ */
+USTRUCT(BlueprintType)
+struct FCOTMSaveSlotInfo
+{
+	GENERATED_BODY()
+
+	/** Header was read successfully */
+	UPROPERTY(BlueprintReadOnly, Category = "SaveGame")
+	bool bValid = false;
+
+	/** Slot the info was read from */
+	UPROPERTY(BlueprintReadOnly, Category = "SaveGame")
+	FString SlotName;
+
+	/** When the slot was last saved */
+	UPROPERTY(BlueprintReadOnly, Category = "SaveGame")
+	FDateTime SaveTimestamp;
+
+	/** Total play time in seconds */
+	UPROPERTY(BlueprintReadOnly, Category = "SaveGame")
+	float PlayTimeSeconds = 0.0f;
+
+	/** Save archive schema version (0 = legacy property save) */
+	UPROPERTY(BlueprintReadOnly, Category = "SaveGame")
+	int32 SchemaVersion = 0;
+
+	/** Snapshot id for matching journal records */
+	uint32 JournalSnapshotId = 0;
+};
+
 /**
  * Main save game class for CallOfTheMoutains
  * Stores player location, inventory, and equipment
@@ -49,6 +98,14 @@ public:
 	UPROPERTY(VisibleAnywhere, Category = "SaveGame")
 	FDateTime SaveTimestamp;
 
+	/** Identifies this full snapshot - only journal records written against it are replayed */
+	UPROPERTY(SaveGame, VisibleAnywhere, Category = "SaveGame")
+	uint32 JournalSnapshotId = 0;
+
+	/** Total play time in seconds */
+	UPROPERTY(SaveGame, VisibleAnywhere, Category = "SaveGame")
+	float PlayTimeSeconds = 0.0f;
+
 	// ==================== Player Transform ====================
 
 	/** Player world location */
@@ -103,6 +160,22 @@ public:
 	UPROPERTY(SaveGame, VisibleAnywhere, Category = "SaveGame|DayNight")
 	bool bHasDayNightData = false;
 
+	// ==================== Weather ====================
+
+	/** Weather timeline seed and position - loading continues the same weather sequence */
+	UPROPERTY(SaveGame)
+	FWeatherTimelineCursor WeatherTimeline;
+
+	/** Has the weather timeline been saved? (older saves only have CurrentWeather) */
+	UPROPERTY(SaveGame)
+	bool bHasWeatherTimeline = false;
+
+	// ==================== World State ====================
+
+	/** Pickups, enemies and interactables, per level */
+	UPROPERTY(SaveGame)
+	TArray<FSavedWorldStateLevel> WorldStateLevels;
+
 	// ==================== Helper Functions ====================
 
 	/** Check if this save has valid data */
@@ -3,4 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Stats/Stats.h"
 
+// Shared stat group for gameplay systems ("stat CallOfTheMoutains" in console)
+DECLARE_STATS_GROUP(TEXT("CallOfTheMoutains"), STATGROUP_CallOfTheMoutains, STATCAT_Advanced);
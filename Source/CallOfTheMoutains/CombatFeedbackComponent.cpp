@@ -4,6 +4,7 @@
 #include "DystopianPostProcess.h"
 #include "EquipmentComponent.h"
 #include "HealthComponent.h"
+#include "DamageableRegistry.h"
 #include "MeleeTraceComponent.h"
 #include "Camera/CameraComponent.h"
 #include "GameFramework/SpringArmComponent.h"
@@ -660,7 +661,7 @@ void UCombatFeedbackComponent::OnMeleeHitCallback(const FMeleeHitResult& HitResu
 	// Check if we killed the target
 	if (HitResult.HitActor)
 	{
-		if (UHealthComponent* TargetHealth = HitResult.HitActor->FindComponentByClass<UHealthComponent>())
+		if (UHealthComponent* TargetHealth = UDamageableRegistry::GetHealthComponent(HitResult.HitActor))
 		{
 			if (TargetHealth->IsDead())
 			{
@@ -0,0 +1,146 @@
+// CallOfTheMoutains - Damageable Actor Registry Implementation
+
+#include "DamageableRegistry.h"
+#include "HealthComponent.h"
+#include "EquipmentComponent.h"
+#include "TargetableComponent.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/Controller.h"
+#include "Engine/World.h"
+
+namespace
+{
+	/** Equipment lookup matching the old per-hit scan: controller first (player), then actor (AI/dummies) */
+	UEquipmentComponent* ScanForEquipment(const AActor* Actor, AController*& OutController)
+	{
+		OutController = nullptr;
+		if (const APawn* Pawn = Cast<APawn>(Actor))
+		{
+			OutController = Pawn->GetController();
+			if (OutController)
+			{
+				if (UEquipmentComponent* ControllerEquipment = OutController->FindComponentByClass<UEquipmentComponent>())
+				{
+					return ControllerEquipment;
+				}
+			}
+		}
+		return Actor->FindComponentByClass<UEquipmentComponent>();
+	}
+}
+
+UDamageableRegistry* UDamageableRegistry::Get(const UObject* WorldContextObject)
+{
+	UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UDamageableRegistry>() : nullptr;
+}
+
+void UDamageableRegistry::Deinitialize()
+{
+	Entries.Empty();
+
+	Super::Deinitialize();
+}
+
+void UDamageableRegistry::RegisterDamageable(UHealthComponent* HealthComponent)
+{
+	AActor* Owner = HealthComponent ? HealthComponent->GetOwner() : nullptr;
+	if (!Owner)
+	{
+		return;
+	}
+
+	FDamageableComponents& Entry = Entries.FindOrAdd(Owner);
+	Entry.Health = HealthComponent;
+	Entry.Targetable = Owner->FindComponentByClass<UTargetableComponent>();
+
+	// Equipment is resolved on first lookup - the controller may not have possessed yet
+	Entry.bEquipmentResolved = false;
+}
+
+void UDamageableRegistry::UnregisterDamageable(UHealthComponent* HealthComponent)
+{
+	AActor* Owner = HealthComponent ? HealthComponent->GetOwner() : nullptr;
+	if (Owner)
+	{
+		Entries.Remove(Owner);
+	}
+}
+
+UHealthComponent* UDamageableRegistry::FindHealth(const AActor* Actor) const
+{
+	const FDamageableComponents* Entry = Actor ? Entries.Find(Actor) : nullptr;
+	return Entry ? Entry->Health.Get() : nullptr;
+}
+
+UTargetableComponent* UDamageableRegistry::FindTargetable(const AActor* Actor) const
+{
+	const FDamageableComponents* Entry = Actor ? Entries.Find(Actor) : nullptr;
+	return Entry ? Entry->Targetable.Get() : nullptr;
+}
+
+UEquipmentComponent* UDamageableRegistry::FindEquipment(const AActor* Actor)
+{
+	FDamageableComponents* Entry = Actor ? Entries.Find(Actor) : nullptr;
+	if (!Entry)
+	{
+		return nullptr;
+	}
+
+	// Re-resolve if possession changed since we cached
+	const APawn* Pawn = Cast<APawn>(Actor);
+	AController* CurrentController = Pawn ? Pawn->GetController() : nullptr;
+	if (!Entry->bEquipmentResolved || Entry->EquipmentController.Get() != CurrentController)
+	{
+		AController* ResolvedController = nullptr;
+		Entry->Equipment = ScanForEquipment(Actor, ResolvedController);
+		Entry->EquipmentController = ResolvedController;
+		Entry->bEquipmentResolved = true;
+	}
+
+	return Entry->Equipment.Get();
+}
+
+UHealthComponent* UDamageableRegistry::GetHealthComponent(const AActor* Actor)
+{
+	if (!Actor)
+	{
+		return nullptr;
+	}
+
+	if (UDamageableRegistry* Registry = Get(Actor))
+	{
+		return Registry->FindHealth(Actor);
+	}
+	return Actor->FindComponentByClass<UHealthComponent>();
+}
+
+UEquipmentComponent* UDamageableRegistry::GetEquipmentComponent(const AActor* Actor)
+{
+	if (!Actor)
+	{
+		return nullptr;
+	}
+
+	if (UDamageableRegistry* Registry = Get(Actor))
+	{
+		return Registry->FindEquipment(Actor);
+	}
+
+	AController* IgnoredController = nullptr;
+	return ScanForEquipment(Actor, IgnoredController);
+}
+
+UTargetableComponent* UDamageableRegistry::GetTargetableComponent(const AActor* Actor)
+{
+	if (!Actor)
+	{
+		return nullptr;
+	}
+
+	if (UDamageableRegistry* Registry = Get(Actor))
+	{
+		return Registry->FindTargetable(Actor);
+	}
+	return Actor->FindComponentByClass<UTargetableComponent>();
+}
@@ -0,0 +1,75 @@
+// CallOfTheMoutains - Damageable Actor Registry
+// O(1) lookup of health/equipment/targetable components for damage resolution
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "DamageableRegistry.generated.h"
+
+class UHealthComponent;
+class UEquipmentComponent;
+class UTargetableComponent;
+
+/**
+ * Components involved in resolving damage against an actor
+ */
+struct FDamageableComponents
+{
+	TWeakObjectPtr<UHealthComponent> Health;
+	TWeakObjectPtr<UTargetableComponent> Targetable;
+
+	/** Equipment can live on the actor or on its controller (player) - re-resolved when the controller changes */
+	TWeakObjectPtr<UEquipmentComponent> Equipment;
+	TWeakObjectPtr<AController> EquipmentController;
+	bool bEquipmentResolved = false;
+};
+
+/**
+ * Damageable Registry
+ * UHealthComponent registers its owner at BeginPlay and unregisters at EndPlay.
+ * Damage paths (melee traces, fire, projectiles) query this instead of scanning
+ * the actor's component array with FindComponentByClass on every hit.
+ */
+UCLASS()
+class CALLOFTHEMOUTAINS_API UDamageableRegistry : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Get the registry for a world context (nullptr if unavailable) */
+	static UDamageableRegistry* Get(const UObject* WorldContextObject);
+
+	virtual void Deinitialize() override;
+
+	/** Register a health component's owner as damageable */
+	void RegisterDamageable(UHealthComponent* HealthComponent);
+
+	/** Remove a health component's owner */
+	void UnregisterDamageable(UHealthComponent* HealthComponent);
+
+	/** Health component of a damageable actor (nullptr if not damageable) */
+	UHealthComponent* FindHealth(const AActor* Actor) const;
+
+	/** Targetable component of a damageable actor */
+	UTargetableComponent* FindTargetable(const AActor* Actor) const;
+
+	/** Equipment component for parry/block - checks the actor's controller first, then the actor */
+	UEquipmentComponent* FindEquipment(const AActor* Actor);
+
+	/** Is this actor registered as damageable? */
+	bool IsDamageable(const AActor* Actor) const { return Entries.Contains(Actor); }
+
+	/** Number of registered damageable actors */
+	int32 GetNumDamageables() const { return Entries.Num(); }
+
+	// ==================== Static Helpers (fall back to a component scan when no registry exists) ====================
+
+	static UHealthComponent* GetHealthComponent(const AActor* Actor);
+	static UEquipmentComponent* GetEquipmentComponent(const AActor* Actor);
+	static UTargetableComponent* GetTargetableComponent(const AActor* Actor);
+
+private:
+	TMap<TObjectKey<AActor>, FDamageableComponents> Entries;
+};
@@ -0,0 +1,142 @@
+// CallOfTheMoutains - Day Cycle LUT Implementation
+
+#include "DayCycleLUT.h"
+
+namespace
+{
+	void PackColor(float* Out, const FLinearColor& Color)
+	{
+		Out[0] = Color.R;
+		Out[1] = Color.G;
+		Out[2] = Color.B;
+		Out[3] = Color.A;
+	}
+
+	FLinearColor UnpackColor(const float* In)
+	{
+		return FLinearColor(In[0], In[1], In[2], In[3]);
+	}
+}
+
+// ==================== Packed Visuals ====================
+
+FPackedDayVisuals FPackedDayVisuals::Pack(const FTimePeriodVisuals& Visuals)
+{
+	FPackedDayVisuals Result;
+	PackColor(&Result.Values[SunColor], Visuals.SunColor);
+	Result.Values[SunIntensity] = Visuals.SunIntensity;
+	Result.Values[SkyLightIntensity] = Visuals.SkyLightIntensity;
+	PackColor(&Result.Values[SkyLightColor], Visuals.SkyLightColor);
+	Result.Values[FogDensity] = Visuals.FogDensity;
+	PackColor(&Result.Values[FogColor], Visuals.FogColor);
+	Result.Values[Saturation] = Visuals.Saturation;
+	Result.Values[Temperature] = Visuals.Temperature;
+	Result.Values[ExposureCompensation] = Visuals.ExposureCompensation;
+	Result.Values[VignetteIntensity] = Visuals.VignetteIntensity;
+	return Result;
+}
+
+FTimePeriodVisuals FPackedDayVisuals::Unpack() const
+{
+	FTimePeriodVisuals Result;
+	Result.SunColor = UnpackColor(&Values[SunColor]);
+	Result.SunIntensity = Values[SunIntensity];
+	Result.SkyLightIntensity = Values[SkyLightIntensity];
+	Result.SkyLightColor = UnpackColor(&Values[SkyLightColor]);
+	Result.FogDensity = Values[FogDensity];
+	Result.FogColor = UnpackColor(&Values[FogColor]);
+	Result.Saturation = Values[Saturation];
+	Result.Temperature = Values[Temperature];
+	Result.ExposureCompensation = Values[ExposureCompensation];
+	Result.VignetteIntensity = Values[VignetteIntensity];
+	return Result;
+}
+
+FPackedDayVisuals FPackedDayVisuals::PackWeatherMultipliers(const FWeatherVisuals& Weather)
+{
+	FPackedDayVisuals Result;
+	for (float& Value : Result.Values)
+	{
+		Value = 1.0f;
+	}
+
+	// Clouds dim the sun, the atmosphere tint colors sky and fog (alpha stays untouched)
+	const FLinearColor Tint(Weather.AtmosphereTint.R, Weather.AtmosphereTint.G, Weather.AtmosphereTint.B, 1.0f);
+	Result.Values[SunIntensity] = Weather.SunIntensityMultiplier;
+	PackColor(&Result.Values[SkyLightColor], Tint);
+	Result.Values[FogDensity] = Weather.FogDensityMultiplier;
+	PackColor(&Result.Values[FogColor], Tint);
+	Result.Values[Saturation] = Weather.SaturationMultiplier;
+	return Result;
+}
+
+FPackedDayVisuals FPackedDayVisuals::Lerp(const FPackedDayVisuals& A, const FPackedDayVisuals& B, float Alpha)
+{
+	FPackedDayVisuals Result;
+	for (int32 i = 0; i < NumChannels; ++i)
+	{
+		Result.Values[i] = FMath::Lerp(A.Values[i], B.Values[i], Alpha);
+	}
+	return Result;
+}
+
+void FPackedDayVisuals::Multiply(const FPackedDayVisuals& Multipliers)
+{
+	for (int32 i = 0; i < NumChannels; ++i)
+	{
+		Values[i] *= Multipliers.Values[i];
+	}
+}
+
+// ==================== Day Cycle ====================
+
+void FDayCycleLUT::Bake(TFunctionRef<FPackedDayVisuals(int32 Minute)> EntryForMinute)
+{
+	Entries.SetNumUninitialized(MinutesPerDay + 1);
+	for (int32 Minute = 0; Minute < MinutesPerDay; ++Minute)
+	{
+		Entries[Minute] = EntryForMinute(Minute);
+	}
+	Entries[MinutesPerDay] = Entries[0];
+}
+
+FPackedDayVisuals FDayCycleLUT::Sample(float MinuteOfDay) const
+{
+	if (!IsBaked())
+	{
+		return FPackedDayVisuals::Pack(FTimePeriodVisuals());
+	}
+
+	float Wrapped = FMath::Fmod(MinuteOfDay, static_cast<float>(MinutesPerDay));
+	if (Wrapped < 0.0f)
+	{
+		Wrapped += MinutesPerDay;
+	}
+
+	const int32 Index = FMath::Min(FMath::FloorToInt(Wrapped), MinutesPerDay - 1);
+	return FPackedDayVisuals::Lerp(Entries[Index], Entries[Index + 1], Wrapped - Index);
+}
+
+// ==================== Weather ====================
+
+void FWeatherVisualsLUT::Bake(const TMap<EWeatherType, FWeatherVisuals>& WeatherVisuals)
+{
+	Entries.SetNumUninitialized(NumWeatherTypes);
+	for (int32 i = 0; i < NumWeatherTypes; ++i)
+	{
+		const FWeatherVisuals* Visuals = WeatherVisuals.Find(static_cast<EWeatherType>(i));
+		Entries[i] = FPackedDayVisuals::PackWeatherMultipliers(Visuals ? *Visuals : FWeatherVisuals());
+	}
+}
+
+FPackedDayVisuals FWeatherVisualsLUT::Sample(EWeatherType From, EWeatherType To, float Alpha) const
+{
+	const int32 FromIndex = static_cast<int32>(From);
+	const int32 ToIndex = static_cast<int32>(To);
+	if (!Entries.IsValidIndex(FromIndex) || !Entries.IsValidIndex(ToIndex))
+	{
+		return FPackedDayVisuals::PackWeatherMultipliers(FWeatherVisuals());
+	}
+
+	return FromIndex == ToIndex ? Entries[ToIndex] : FPackedDayVisuals::Lerp(Entries[FromIndex], Entries[ToIndex], Alpha);
+}
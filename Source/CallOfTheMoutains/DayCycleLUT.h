@@ -0,0 +1,82 @@
+// CallOfTheMoutains - Day Cycle LUT
+// Day/night visuals baked once per game minute, with weather multipliers composed on top
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DayNightTypes.h"
+
+/**
+ * FTimePeriodVisuals as a flat float array, so blending and composing are one loop
+ * instead of a field-by-field lerp. Colors take four channels (RGBA).
+ */
+struct CALLOFTHEMOUTAINS_API FPackedDayVisuals
+{
+	enum EChannel : int32
+	{
+		SunColor = 0,
+		SunIntensity = 4,
+		SkyLightIntensity = 5,
+		SkyLightColor = 6,
+		FogDensity = 10,
+		FogColor = 11,
+		Saturation = 15,
+		Temperature = 16,
+		ExposureCompensation = 17,
+		VignetteIntensity = 18,
+		NumChannels = 19
+	};
+
+	float Values[NumChannels];
+
+	static FPackedDayVisuals Pack(const FTimePeriodVisuals& Visuals);
+	FTimePeriodVisuals Unpack() const;
+
+	/** Per-channel multipliers applying a weather's visuals (all ones for the FWeatherVisuals defaults) */
+	static FPackedDayVisuals PackWeatherMultipliers(const FWeatherVisuals& Weather);
+
+	static FPackedDayVisuals Lerp(const FPackedDayVisuals& A, const FPackedDayVisuals& B, float Alpha);
+
+	/** Channel-wise multiply */
+	void Multiply(const FPackedDayVisuals& Multipliers);
+};
+
+/**
+ * Day Cycle LUT
+ * One packed entry per game minute, plus a copy of minute 0 at the end so the last minute
+ * blends into midnight. Sampling any time of day is one lerp between adjacent entries.
+ */
+class CALLOFTHEMOUTAINS_API FDayCycleLUT
+{
+public:
+	static constexpr int32 MinutesPerDay = 1440;
+
+	/** Fill every minute from a callback (game thread, on settings changes only) */
+	void Bake(TFunctionRef<FPackedDayVisuals(int32 Minute)> EntryForMinute);
+
+	bool IsBaked() const { return Entries.Num() == MinutesPerDay + 1; }
+
+	/** Visuals at a time of day in minutes since midnight (wrapped to one day) */
+	FPackedDayVisuals Sample(float MinuteOfDay) const;
+
+private:
+	TArray<FPackedDayVisuals> Entries;
+};
+
+/**
+ * Weather Visuals LUT
+ * Packed multipliers per EWeatherType. A weather transition samples as one lerp between two
+ * entries, and the result is multiplied onto a day cycle sample.
+ */
+class CALLOFTHEMOUTAINS_API FWeatherVisualsLUT
+{
+public:
+	/** Pack the weather system's visuals (missing weathers leave the day visuals unchanged) */
+	void Bake(const TMap<EWeatherType, FWeatherVisuals>& WeatherVisuals);
+
+	/** Multipliers while blending From -> To (identity if never baked) */
+	FPackedDayVisuals Sample(EWeatherType From, EWeatherType To, float Alpha) const;
+
+private:
+	TArray<FPackedDayVisuals> Entries;
+};
@@ -3,15 +3,12 @@
 #include "DayNightGameplayModifier.h"
 #include "DayNightManager.h"
 #include "WeatherSystem.h"
-#include "HealthComponent.h"
-#include "GameFramework/Character.h"
-#include "GameFramework/CharacterMovementComponent.h"
+#include "AttributeModifierComponent.h"
 
 UDayNightGameplayModifier::UDayNightGameplayModifier()
 {
-	PrimaryComponentTick.bCanEverTick = true;
-	PrimaryComponentTick.bStartWithTickEnabled = true;
-	PrimaryComponentTick.TickInterval = 0.5f; // Update twice per second
+	// Driven by time period and weather change events
+	PrimaryComponentTick.bCanEverTick = false;
 }
 
 void UDayNightGameplayModifier::BeginPlay()
@@ -21,13 +18,6 @@ void UDayNightGameplayModifier::BeginPlay()
 	// Cache references
 	CacheReferences();
 
-	// Store original values
-	if (HealthComponent)
-	{
-		OriginalStaminaRegenRate = HealthComponent->StaminaRegenRate;
-		OriginalDamageMultiplier = HealthComponent->DamageMultiplier;
-	}
-
 	// Subscribe to events
 	if (DayNightManager)
 	{
@@ -45,11 +35,11 @@ void UDayNightGameplayModifier::BeginPlay()
 
 void UDayNightGameplayModifier::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	// Restore original values
-	if (HealthComponent)
+	// Drop our layers - everything else on the stack stays as it is
+	if (AttributeModifiers)
 	{
-		HealthComponent->StaminaRegenRate = OriginalStaminaRegenRate;
-		HealthComponent->DamageMultiplier = OriginalDamageMultiplier;
+		AttributeModifiers->RemoveSource(EModifierSource::TimePeriod);
+		AttributeModifiers->RemoveSource(EModifierSource::Weather);
 	}
 
 	// Unsubscribe from events
@@ -66,15 +56,6 @@ void UDayNightGameplayModifier::EndPlay(const EEndPlayReason::Type EndPlayReason
 	Super::EndPlay(EndPlayReason);
 }
 
-void UDayNightGameplayModifier::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
-{
-	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
-
-	// Periodically refresh modifiers (handles smooth transitions)
-	CalculateModifiers();
-	ApplyModifiersToComponents();
-}
-
 void UDayNightGameplayModifier::CacheReferences()
 {
 	// Find DayNightManager
@@ -86,8 +67,8 @@ void UDayNightGameplayModifier::CacheReferences()
 		WeatherSystem = DayNightManager->WeatherSystem;
 	}
 
-	// Find HealthComponent on owner
-	HealthComponent = GetOwner()->FindComponentByClass<UHealthComponent>();
+	// Modifier stack on owner (HealthComponent and movement read from it)
+	AttributeModifiers = UAttributeModifierComponent::FindOrAdd(GetOwner());
 }
 
 void UDayNightGameplayModifier::CalculateModifiers()
@@ -101,6 +82,9 @@ void UDayNightGameplayModifier::CalculateModifiers()
 	CachedFireDamageMultiplier = 1.0f;
 	CachedLightningDamageMultiplier = 1.0f;
 	CachedStaminaDrainMultiplier = 1.0f;
+	TimeDamageMultiplier = 1.0f;
+	TimeStaminaRegenMultiplier = 1.0f;
+	WeatherStaminaRegenMultiplier = 1.0f;
 
 	// Get time-based modifiers
 	if (DayNightManager)
@@ -110,13 +94,13 @@ void UDayNightGameplayModifier::CalculateModifiers()
 		if (bIsPlayer)
 		{
 			// Player receives benefits
-			CachedDamageMultiplier *= TimeGameplay.PlayerDamageMultiplier;
-			CachedStaminaRegenMultiplier *= TimeGameplay.StaminaRegenMultiplier;
+			TimeDamageMultiplier = TimeGameplay.PlayerDamageMultiplier;
+			TimeStaminaRegenMultiplier = TimeGameplay.StaminaRegenMultiplier;
 		}
 		else
 		{
 			// Enemies receive different modifiers
-			CachedDamageMultiplier *= TimeGameplay.EnemyDamageMultiplier;
+			TimeDamageMultiplier = TimeGameplay.EnemyDamageMultiplier;
 			CachedDetectionRange *= TimeGameplay.EnemyDetectionRange;
 		}
 	}
@@ -148,48 +132,48 @@ void UDayNightGameplayModifier::CalculateModifiers()
 		{
 			CachedStaminaDrainMultiplier *= WeatherGameplay.StaminaDrainMultiplier;
 			// Inverse relationship - higher drain means lower regen
-			CachedStaminaRegenMultiplier /= WeatherGameplay.StaminaDrainMultiplier;
+			WeatherStaminaRegenMultiplier = 1.0f / FMath::Max(WeatherGameplay.StaminaDrainMultiplier, KINDA_SMALL_NUMBER);
 		}
 	}
+
+	CachedDamageMultiplier = TimeDamageMultiplier;
+	CachedStaminaRegenMultiplier = TimeStaminaRegenMultiplier * WeatherStaminaRegenMultiplier;
 }
 
 void UDayNightGameplayModifier::ApplyModifiersToComponents()
 {
-	// Apply to HealthComponent
-	if (HealthComponent)
+	if (!AttributeModifiers)
 	{
-		if (bApplyStaminaModifiers)
-		{
-			HealthComponent->StaminaRegenRate = OriginalStaminaRegenRate * CachedStaminaRegenMultiplier;
-		}
+		return;
+	}
 
-		if (bApplyDamageModifiers)
-		{
-			HealthComponent->DamageMultiplier = OriginalDamageMultiplier * CachedDamageMultiplier;
-		}
+	if (bApplyDamageModifiers)
+	{
+		AttributeModifiers->SetModifier(EModifiedAttribute::DamageTaken, EModifierSource::TimePeriod, 0.0f, TimeDamageMultiplier);
+	}
+	else
+	{
+		AttributeModifiers->RemoveModifier(EModifiedAttribute::DamageTaken, EModifierSource::TimePeriod);
+	}
+
+	if (bApplyStaminaModifiers)
+	{
+		AttributeModifiers->SetModifier(EModifiedAttribute::StaminaRegen, EModifierSource::TimePeriod, 0.0f, TimeStaminaRegenMultiplier);
+		AttributeModifiers->SetModifier(EModifiedAttribute::StaminaRegen, EModifierSource::Weather, 0.0f, WeatherStaminaRegenMultiplier);
+	}
+	else
+	{
+		AttributeModifiers->RemoveModifier(EModifiedAttribute::StaminaRegen, EModifierSource::TimePeriod);
+		AttributeModifiers->RemoveModifier(EModifiedAttribute::StaminaRegen, EModifierSource::Weather);
 	}
 
-	// Apply movement speed modifier
 	if (bApplyMovementModifiers)
 	{
-		ACharacter* Character = Cast<ACharacter>(GetOwner());
-		if (Character)
-		{
-			UCharacterMovementComponent* MovementComp = Character->GetCharacterMovement();
-			if (MovementComp)
-			{
-				// Store the original max walk speed on first run
-				static float OriginalMaxWalkSpeed = 0.0f;
-				if (OriginalMaxWalkSpeed == 0.0f)
-				{
-					OriginalMaxWalkSpeed = MovementComp->MaxWalkSpeed;
-				}
-
-				// Apply modifier (but don't stack - use original as base)
-				// Note: This is a simple implementation. A more robust system would
-				// use a modifier stack system to combine multiple speed modifiers.
-			}
-		}
+		AttributeModifiers->SetModifier(EModifiedAttribute::MoveSpeed, EModifierSource::Weather, 0.0f, CachedMovementSpeedMultiplier);
+	}
+	else
+	{
+		AttributeModifiers->RemoveModifier(EModifiedAttribute::MoveSpeed, EModifierSource::Weather);
 	}
 }
 
@@ -10,14 +10,15 @@
 
 class ADayNightManager;
 class UWeatherSystem;
-class UHealthComponent;
+class UAttributeModifierComponent;
 
 /**
  * Day/Night Gameplay Modifier Component
  *
  * Add to any actor that should be affected by time of day and weather.
  * Automatically subscribes to DayNightManager events and applies
- * appropriate gameplay modifiers.
+ * appropriate gameplay modifiers. Nothing is polled: modifiers are recalculated
+ * when the time period or weather changes.
  *
  * Usage:
  * 1. Add to player character, enemies, or any relevant actors
@@ -25,9 +26,9 @@ class UHealthComponent;
  * 3. The component automatically handles integration with existing systems
  *
  * Integrates with:
- * - HealthComponent (stamina regen, damage modifiers)
+ * - HealthComponent (stamina regen, damage modifiers) and movement speed, through
+ *   TimePeriod and Weather layers on the owner's UAttributeModifierComponent
  * - AI perception (detection range)
- * - Movement (speed modifiers)
  */
 UCLASS(ClassGroup=(Gameplay), meta=(BlueprintSpawnableComponent))
 class CALLOFTHEMOUTAINS_API UDayNightGameplayModifier : public UActorComponent
@@ -40,7 +41,6 @@ public:
 protected:
 	virtual void BeginPlay() override;
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
-	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 public:
 	// ==================== Configuration ====================
@@ -119,7 +119,7 @@ protected:
 	UWeatherSystem* WeatherSystem;
 
 	UPROPERTY()
-	UHealthComponent* HealthComponent;
+	UAttributeModifierComponent* AttributeModifiers;
 
 	// ==================== Cached Modifier Values ====================
 
@@ -132,9 +132,10 @@ protected:
 	float CachedLightningDamageMultiplier = 1.0f;
 	float CachedStaminaDrainMultiplier = 1.0f;
 
-	// Original values (for restoration)
-	float OriginalStaminaRegenRate = 20.0f;
-	float OriginalDamageMultiplier = 1.0f;
+	// Per-source parts of the cached values, pushed as modifier layers
+	float TimeDamageMultiplier = 1.0f;
+	float TimeStaminaRegenMultiplier = 1.0f;
+	float WeatherStaminaRegenMultiplier = 1.0f;
 
 	// ==================== Internal Functions ====================
 
@@ -144,7 +145,7 @@ protected:
 	/** Calculate combined modifiers from time and weather */
 	void CalculateModifiers();
 
-	/** Apply modifiers to integrated components */
+	/** Push the modifiers as TimePeriod/Weather layers (layers for disabled modifiers are removed) */
 	void ApplyModifiersToComponents();
 
 	// ==================== Event Handlers ====================
@@ -4,12 +4,42 @@
 #include "WeatherSystem.h"
 #include "AmbientSFXComponent.h"
 #include "DystopianPostProcess.h"
+#include "EnvironmentRegistry.h"
 #include "Components/DirectionalLightComponent.h"
 #include "Components/SkyLightComponent.h"
 #include "Components/ExponentialHeightFogComponent.h"
 #include "Kismet/GameplayStatics.h"
 #include "GameFramework/PlayerController.h"
-#include "EngineUtils.h"
+#include "HAL/IConsoleManager.h"
+#include "CallOfTheMoutains.h"
+
+DECLARE_CYCLE_STAT(TEXT("Day Cycle LUT Bake"), STAT_DayCycleLUTBake, STATGROUP_CallOfTheMoutains);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Lighting Render Pushes"), STAT_LightingRenderPushes, STATGROUP_CallOfTheMoutains);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Lighting Pushes Saved/s"), STAT_LightingPushesSavedPerSecond, STATGROUP_CallOfTheMoutains);
+
+#if !UE_BUILD_SHIPPING
+static FAutoConsoleCommandWithWorld GVerifyVisualsLUTCommand(
+	TEXT("COTM.DayNight.VerifyLUT"),
+	TEXT("Compare the baked day/night visuals LUT with the real-time period blend over a whole day"),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		if (const ADayNightManager* Manager = ADayNightManager::GetDayNightManager(World))
+		{
+			Manager->VerifyVisualsLUT();
+		}
+	}));
+
+static FAutoConsoleCommandWithWorldAndArgs GSimulateWeatherCommand(
+	TEXT("COTM.Weather.Simulate"),
+	TEXT("Run the weather timeline for N game days (default 30) without ticking and log the cost and weather distribution"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (const ADayNightManager* Manager = ADayNightManager::GetDayNightManager(World))
+		{
+			Manager->SimulateWeather(Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 30);
+		}
+	}));
+#endif
 
 ADayNightManager::ADayNightManager()
 {
@@ -26,6 +56,28 @@ ADayNightManager::ADayNightManager()
 	AmbientSFX = CreateDefaultSubobject<UAmbientSFXComponent>(TEXT("AmbientSFX"));
 }
 
+void ADayNightManager::PostInitializeComponents()
+{
+	Super::PostInitializeComponents();
+
+	// Before any BeginPlay, so other actors can find us from theirs
+	if (UEnvironmentRegistry* Registry = UEnvironmentRegistry::Get(this))
+	{
+		Registry->RegisterDayNightManager(this);
+	}
+}
+
+void ADayNightManager::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UEnvironmentRegistry* Registry = UEnvironmentRegistry::Get(this))
+	{
+		Registry->OnEnvironmentChanged.Remove(EnvironmentChangedHandle);
+		Registry->UnregisterDayNightManager(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void ADayNightManager::BeginPlay()
 {
 	Super::BeginPlay();
@@ -33,6 +85,9 @@ void ADayNightManager::BeginPlay()
 	// Initialize default settings if not configured
 	InitializeDefaultSettings();
 
+	// The weather system's defaults were set up by its own BeginPlay in Super::BeginPlay
+	RebuildVisualsLUT();
+
 	// Set starting time
 	CurrentTime = StartingTime;
 	LastHour = CurrentTime.Hour;
@@ -46,8 +101,7 @@ void ADayNightManager::BeginPlay()
 	FindPlayerPostProcess();
 
 	// Initial update
-	UpdateSunRotation();
-	UpdateLighting(0.0f);
+	ForceLightingUpdate();
 	UpdatePostProcess();
 
 	// Fire initial events
@@ -63,9 +117,57 @@ void ADayNightManager::Tick(float DeltaTime)
 		UpdateTime(DeltaTime);
 	}
 
+	// Lighting moves slowly - update at an interval scaled by TimeScale, pushing only what changed
+	TimeSinceLightingUpdate += DeltaTime;
+	if (bLightingUpdatePending || TimeSinceLightingUpdate >= GetLightingUpdateInterval())
+	{
+		TimeSinceLightingUpdate = 0.0f;
+		bLightingUpdatePending = false;
+
+		UpdateSunRotation();
+		UpdateLighting();
+		UpdatePostProcess();
+	}
+
+	UpdateRenderStats(DeltaTime);
+}
+
+float ADayNightManager::GetLightingUpdateInterval() const
+{
+	// Weather transitions run in real time, so they don't slow down with the time scale
+	const float TimeInterval = LightingUpdateInterval / FMath::Max(bCycleEnabled ? TimeScale : 0.0f, 0.1f);
+	const bool bWeatherBlending = WeatherSystem && WeatherSystem->GetTransitionState() != EWeatherTransitionState::Stable;
+	return bWeatherBlending ? FMath::Min(TimeInterval, LightingUpdateInterval) : TimeInterval;
+}
+
+void ADayNightManager::ForceLightingUpdate()
+{
+	bHasAppliedSun = false;
+	bHasAppliedVisuals = false;
+
 	UpdateSunRotation();
-	UpdateLighting(DeltaTime);
-	UpdatePostProcess();
+	UpdateLighting();
+
+	TimeSinceLightingUpdate = 0.0f;
+	bLightingUpdatePending = false;
+}
+
+void ADayNightManager::UpdateRenderStats(float DeltaTime)
+{
+	// Before change-driven updates, every present component was pushed every frame
+	StatsWindowBaselinePushes += (SunLightActor ? 1 : 0) + (SunLight ? 1 : 0) + (SkyLight ? 1 : 0)
+		+ (HeightFog ? 1 : 0) + (PlayerPostProcess ? 1 : 0);
+
+	StatsWindowTime += DeltaTime;
+	if (StatsWindowTime >= 1.0f)
+	{
+		RenderUpdatesSavedPerSecond = (StatsWindowBaselinePushes - StatsWindowPushes) / StatsWindowTime;
+		SET_FLOAT_STAT(STAT_LightingPushesSavedPerSecond, RenderUpdatesSavedPerSecond);
+
+		StatsWindowTime = 0.0f;
+		StatsWindowPushes = 0;
+		StatsWindowBaselinePushes = 0;
+	}
 }
 
 void ADayNightManager::UpdateTime(float DeltaTime)
@@ -105,22 +207,10 @@ void ADayNightManager::UpdateTime(float DeltaTime)
 	ETimePeriod NewPeriod = CalculateTimePeriod();
 	if (NewPeriod != CurrentTimePeriod)
 	{
+		// The visual blend into the new period is baked into the LUT
 		PreviousTimePeriod = CurrentTimePeriod;
 		CurrentTimePeriod = NewPeriod;
 
-		// Start blending
-		bIsBlendingTimePeriod = true;
-		TimePeriodBlendAlpha = 0.0f;
-
-		if (TimePeriodVisuals.Contains(PreviousTimePeriod))
-		{
-			BlendStartVisuals = TimePeriodVisuals[PreviousTimePeriod];
-		}
-		if (TimePeriodVisuals.Contains(CurrentTimePeriod))
-		{
-			BlendTargetVisuals = TimePeriodVisuals[CurrentTimePeriod];
-		}
-
 		OnTimePeriodChanged.Broadcast(CurrentTimePeriod, PreviousTimePeriod);
 	}
 
@@ -135,14 +225,20 @@ void ADayNightManager::UpdateSunRotation()
 		return;
 	}
 
-	// Calculate sun angle based on time
+	// Calculate sun angle based on time, including the fractional minute so the sun moves smoothly
 	// Normalized time: 0.0 = midnight, 0.5 = noon, 1.0 = midnight again
-	float NormalizedTime = CurrentTime.GetNormalizedTime();
+	float NormalizedTime = GetMinuteOfDay() / 1440.0f;
 
 	// Convert to rotation: 0 at midnight, 180 at noon
 	// Sun rises in east, sets in west
 	float SunAngle = (NormalizedTime * 360.0f) - 90.0f + SunAngleOffset;
 
+	// Skip moves too small to see
+	if (bHasAppliedSun && FMath::Abs(FMath::FindDeltaAngleDegrees(AppliedSunPitch, SunAngle)) < SunAngleEpsilon)
+	{
+		return;
+	}
+
 	// Apply rotation
 	FRotator NewRotation = SunRotationAxis;
 	NewRotation.Pitch = SunAngle;
@@ -150,39 +246,228 @@ void ADayNightManager::UpdateSunRotation()
 	if (SunLightActor)
 	{
 		SunLightActor->SetActorRotation(NewRotation);
+		bHasAppliedSun = true;
+		AppliedSunPitch = SunAngle;
+		++StatsWindowPushes;
+		INC_DWORD_STAT(STAT_LightingRenderPushes);
+	}
+}
+
+void ADayNightManager::UpdateLighting()
+{
+	// DayCycleDuration and TimePeriodBlendTime are writable at runtime - re-bake if the blend length moved
+	if (!VisualsLUT.IsBaked() || GetTimePeriodBlendMinutes() != BakedBlendMinutes)
+	{
+		RebuildVisualsLUT();
+	}
+
+	ApplyVisuals(SampleVisuals().Unpack());
+}
+
+float ADayNightManager::GetMinuteOfDay() const
+{
+	return CurrentTime.Hour * 60 + CurrentTime.Minute + FractionalMinutes;
+}
+
+int32 ADayNightManager::GetTimePeriodBlendMinutes() const
+{
+	// Whole minutes, so every blend starts and ends exactly on a LUT entry
+	return FMath::Max(FMath::RoundToInt(TimePeriodBlendTime * 1440.0f / DayCycleDuration), 0);
+}
+
+FPackedDayVisuals ADayNightManager::SampleVisuals() const
+{
+	FPackedDayVisuals Visuals = VisualsLUT.Sample(GetMinuteOfDay());
+
+	if (WeatherSystem)
+	{
+		EWeatherType FromWeather;
+		EWeatherType ToWeather;
+		float WeatherAlpha;
+		WeatherSystem->GetVisualsBlend(FromWeather, ToWeather, WeatherAlpha);
+		Visuals.Multiply(WeatherLUT.Sample(FromWeather, ToWeather, WeatherAlpha));
+	}
+
+	return Visuals;
+}
+
+void ADayNightManager::RebuildVisualsLUT()
+{
+	SCOPE_CYCLE_COUNTER(STAT_DayCycleLUTBake);
+
+	BakedBlendMinutes = GetTimePeriodBlendMinutes();
+
+	// Pack every period once - periods without visuals use the defaults
+	TMap<ETimePeriod, FPackedDayVisuals> PackedPeriods;
+	for (const TPair<ETimePeriod, FTimePeriodVisuals>& Pair : TimePeriodVisuals)
+	{
+		PackedPeriods.Add(Pair.Key, FPackedDayVisuals::Pack(Pair.Value));
+	}
+	const FPackedDayVisuals DefaultVisuals = FPackedDayVisuals::Pack(FTimePeriodVisuals());
+
+	auto GetPeriodVisuals = [&PackedPeriods, &DefaultVisuals](ETimePeriod Period) -> const FPackedDayVisuals&
+	{
+		const FPackedDayVisuals* Visuals = PackedPeriods.Find(Period);
+		return Visuals ? *Visuals : DefaultVisuals;
+	};
+
+	// Each period blends in from the one before it over the first BakedBlendMinutes
+	VisualsLUT.Bake([this, &GetPeriodVisuals](int32 Minute)
+	{
+		const ETimePeriod Period = GetTimePeriodForHour(Minute / 60);
+		const int32 StartHour = GetTimePeriodStartHour(Period);
+		const ETimePeriod PeriodBefore = GetTimePeriodForHour((StartHour + 23) % 24);
+
+		const int32 MinutesIntoPeriod = (Minute - StartHour * 60 + FDayCycleLUT::MinutesPerDay) % FDayCycleLUT::MinutesPerDay;
+		const float Alpha = BakedBlendMinutes > 0 ? FMath::Min(static_cast<float>(MinutesIntoPeriod) / BakedBlendMinutes, 1.0f) : 1.0f;
+
+		return FPackedDayVisuals::Lerp(GetPeriodVisuals(PeriodBefore), GetPeriodVisuals(Period), Alpha);
+	});
+
+	if (WeatherSystem)
+	{
+		WeatherLUT.Bake(WeatherSystem->WeatherVisuals);
 	}
+
+	bLightingUpdatePending = true;
 }
 
-void ADayNightManager::UpdateLighting(float DeltaTime)
+#if !UE_BUILD_SHIPPING
+bool ADayNightManager::VerifyVisualsLUT() const
 {
-	// Update blend state
-	if (bIsBlendingTimePeriod && TimePeriodBlendTime > 0.0f)
+	if (!VisualsLUT.IsBaked())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("DayNightManager: Visuals LUT not baked yet"));
+		return false;
+	}
+
+	constexpr int32 StepsPerMinute = 4;
+	constexpr float Tolerance = 1.0e-4f;
+	float MaxError = 0.0f;
+	float MaxErrorMinute = 0.0f;
+	bool bMatches = true;
+
+	// Reference: the real-time blend the LUT replaced. On entering a period, lights blended from the
+	// previous period over TimePeriodBlendTime real seconds (TimeScale 1). The LUT rounds that length
+	// to whole minutes, so allow each channel the error that rounding alone can cause.
+	const float SecondsPerMinute = DayCycleDuration / FDayCycleLUT::MinutesPerDay;
+	const float RealBlendMinutes = TimePeriodBlendTime / SecondsPerMinute;
+	const float BlendRoundingError = RealBlendMinutes > 0.0f || BakedBlendMinutes > 0
+		? FMath::Abs(BakedBlendMinutes - RealBlendMinutes) / FMath::Max(RealBlendMinutes, static_cast<float>(BakedBlendMinutes))
+		: 0.0f;
+
+	for (int32 Step = 0; Step < FDayCycleLUT::MinutesPerDay * StepsPerMinute; ++Step)
 	{
-		TimePeriodBlendAlpha += DeltaTime / TimePeriodBlendTime;
-		if (TimePeriodBlendAlpha >= 1.0f)
+		const float MinuteOfDay = static_cast<float>(Step) / StepsPerMinute;
+		const ETimePeriod Period = GetTimePeriodForHour(FMath::FloorToInt(MinuteOfDay / 60.0f));
+		const int32 StartHour = GetTimePeriodStartHour(Period);
+
+		float MinutesIntoPeriod = MinuteOfDay - StartHour * 60.0f;
+		if (MinutesIntoPeriod < 0.0f)
 		{
-			TimePeriodBlendAlpha = 1.0f;
-			bIsBlendingTimePeriod = false;
+			MinutesIntoPeriod += FDayCycleLUT::MinutesPerDay;
+		}
+
+		// Blend alpha advanced by real seconds, as UpdateLighting(DeltaTime) did
+		const float SecondsIntoPeriod = MinutesIntoPeriod * SecondsPerMinute;
+		const float Alpha = TimePeriodBlendTime > 0.0f ? FMath::Min(SecondsIntoPeriod / TimePeriodBlendTime, 1.0f) : 1.0f;
+
+		const FTimePeriodVisuals* From = TimePeriodVisuals.Find(GetTimePeriodForHour((StartHour + 23) % 24));
+		const FTimePeriodVisuals* To = TimePeriodVisuals.Find(Period);
+		const FTimePeriodVisuals& FromVisuals = From ? *From : FTimePeriodVisuals();
+		const FTimePeriodVisuals& ToVisuals = To ? *To : FTimePeriodVisuals();
+		const FTimePeriodVisuals Expected = LerpVisuals(FromVisuals, ToVisuals, Alpha);
+
+		const FPackedDayVisuals ExpectedPacked = FPackedDayVisuals::Pack(Expected);
+		const FPackedDayVisuals FromPacked = FPackedDayVisuals::Pack(FromVisuals);
+		const FPackedDayVisuals ToPacked = FPackedDayVisuals::Pack(ToVisuals);
+		const FPackedDayVisuals Sampled = VisualsLUT.Sample(MinuteOfDay);
+		for (int32 i = 0; i < FPackedDayVisuals::NumChannels; ++i)
+		{
+			const float Error = FMath::Abs(Sampled.Values[i] - ExpectedPacked.Values[i]);
+			const float Allowed = Tolerance + FMath::Abs(ToPacked.Values[i] - FromPacked.Values[i]) * BlendRoundingError;
+			bMatches &= Error <= Allowed;
+
+			if (Error > MaxError)
+			{
+				MaxError = Error;
+				MaxErrorMinute = MinuteOfDay;
+			}
 		}
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("DayNightManager: Visuals LUT %s - max error %g at minute %.2f (blend %.2f min real-time, %d baked)"),
+		bMatches ? TEXT("matches the real-time blend") : TEXT("DIFFERS from the real-time blend"), MaxError, MaxErrorMinute, RealBlendMinutes, BakedBlendMinutes);
+	return bMatches;
+}
+
+void ADayNightManager::SimulateWeather(int32 Days) const
+{
+	if (!WeatherSystem)
+	{
+		return;
+	}
+
+	Days = FMath::Clamp(Days, 1, 100000);
+	const double SecondsPerDay = DayCycleDuration;
+	const FWeatherTimeline& Source = WeatherSystem->GetTimeline();
+
+	// The whole span in one call - what a time skip pays
+	FWeatherTimeline Skipped = Source;
+	const double SkipStart = FPlatformTime::Seconds();
+	const int32 Changes = Skipped.Advance(SecondsPerDay * Days);
+	const double SkipMs = (FPlatformTime::Seconds() - SkipStart) * 1000.0;
+
+	// Minute by minute for the distribution - must land on the same segment as the skip
+	FWeatherTimeline Stepped = Source;
+	double SecondsInWeather[NumWeatherTypes] = {};
+	const double MinuteSeconds = SecondsPerDay / FDayCycleLUT::MinutesPerDay;
+	const double StepStart = FPlatformTime::Seconds();
+	for (int32 Minute = 0; Minute < Days * FDayCycleLUT::MinutesPerDay; ++Minute)
+	{
+		Stepped.Advance(MinuteSeconds);
+		SecondsInWeather[static_cast<int32>(Stepped.GetState().Current)] += MinuteSeconds;
+	}
+	const double StepMs = (FPlatformTime::Seconds() - StepStart) * 1000.0;
+
+	const bool bMatches = Stepped.GetCursor().Segment == Skipped.GetCursor().Segment && Stepped.GetCursor().Weather == Skipped.GetCursor().Weather;
+	UE_LOG(LogTemp, Display, TEXT("DayNightManager: Simulated %d days of weather (seed %d): %d changes, skip %.3f ms, per-minute steps %.3f ms, results %s"),
+		Days, Source.GetCursor().Seed, Changes, SkipMs, StepMs, bMatches ? TEXT("match") : TEXT("DIFFER"));
 
-		// Lerp visuals
-		FTimePeriodVisuals CurrentVisuals = LerpVisuals(BlendStartVisuals, BlendTargetVisuals, TimePeriodBlendAlpha);
-		ApplyVisuals(CurrentVisuals);
+	for (int32 i = 0; i < NumWeatherTypes; ++i)
+	{
+		UE_LOG(LogTemp, Display, TEXT("  %s: %.1f%%"), *UEnum::GetValueAsString(static_cast<EWeatherType>(i)), 100.0 * SecondsInWeather[i] / (SecondsPerDay * Days));
 	}
-	else if (TimePeriodVisuals.Contains(CurrentTimePeriod))
+}
+#endif
+
+#if WITH_EDITOR
+void ADayNightManager::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	// Visuals tweaked in the details panel during play show up right away
+	if (HasActorBegunPlay())
 	{
-		ApplyVisuals(TimePeriodVisuals[CurrentTimePeriod]);
+		RebuildVisualsLUT();
 	}
 }
+#endif
 
 void ADayNightManager::UpdatePostProcess()
 {
 	if (!bControlPostProcess || !PlayerPostProcess)
 	{
-		// Try to find it again
+		// Try to find it again - a new post-process needs the current visuals pushed
 		if (bControlPostProcess && !PlayerPostProcess)
 		{
 			FindPlayerPostProcess();
+			if (PlayerPostProcess)
+			{
+				bHasAppliedVisuals = false;
+				PostProcessBlendEndTime = 0.0f;
+				bLightingUpdatePending = true;
+			}
 		}
 		return;
 	}
@@ -194,8 +479,11 @@ void ADayNightManager::UpdatePostProcess()
 
 ETimePeriod ADayNightManager::CalculateTimePeriod() const
 {
-	int32 Hour = CurrentTime.Hour;
+	return GetTimePeriodForHour(CurrentTime.Hour);
+}
 
+ETimePeriod ADayNightManager::GetTimePeriodForHour(int32 Hour)
+{
 	if (Hour >= 5 && Hour < 7)
 	{
 		return ETimePeriod::Dawn;
@@ -466,66 +754,75 @@ void ADayNightManager::InitializeDefaultSettings()
 
 void ADayNightManager::CacheLightReferences()
 {
-	// Get directional light component
+	// Get components of the assigned actors
 	if (SunLightActor)
 	{
 		SunLight = SunLightActor->FindComponentByClass<UDirectionalLightComponent>();
 	}
 
-	// Get sky light component
 	if (SkyLightActor)
 	{
 		SkyLight = SkyLightActor->FindComponentByClass<USkyLightComponent>();
 	}
 
-	// Get fog component
 	if (FogActor)
 	{
 		HeightFog = FogActor->FindComponentByClass<UExponentialHeightFogComponent>();
 	}
 
-	// Auto-find if not specified
-	if (!SunLight)
+	UEnvironmentRegistry* Registry = UEnvironmentRegistry::Get(this);
+	if (!Registry)
 	{
-		for (TActorIterator<AActor> It(GetWorld()); It; ++It)
-		{
-			UDirectionalLightComponent* DirLight = It->FindComponentByClass<UDirectionalLightComponent>();
-			if (DirLight)
-			{
-				SunLight = DirLight;
-				SunLightActor = *It;
-				break;
-			}
-		}
+		return;
 	}
 
-	if (!SkyLight)
+	// Publish what we were given, then fill the gaps from the registry
+	Registry->RegisterSunLight(SunLight);
+	Registry->RegisterSkyLight(SkyLight);
+	Registry->RegisterHeightFog(HeightFog);
+	OnEnvironmentChanged();
+
+	// Auto-find the rest over the next frames instead of scanning every actor now
+	if (!SunLight || !SkyLight || !HeightFog)
 	{
-		for (TActorIterator<AActor> It(GetWorld()); It; ++It)
+		if (!EnvironmentChangedHandle.IsValid())
 		{
-			USkyLightComponent* Sky = It->FindComponentByClass<USkyLightComponent>();
-			if (Sky)
-			{
-				SkyLight = Sky;
-				SkyLightActor = *It;
-				break;
-			}
+			EnvironmentChangedHandle = Registry->OnEnvironmentChanged.AddUObject(this, &ADayNightManager::OnEnvironmentChanged);
 		}
+		Registry->RequestDiscovery();
 	}
+}
 
-	if (!HeightFog)
+void ADayNightManager::OnEnvironmentChanged()
+{
+	const UEnvironmentRegistry* Registry = UEnvironmentRegistry::Get(this);
+	if (!Registry)
 	{
-		for (TActorIterator<AActor> It(GetWorld()); It; ++It)
-		{
-			UExponentialHeightFogComponent* Fog = It->FindComponentByClass<UExponentialHeightFogComponent>();
-			if (Fog)
-			{
-				HeightFog = Fog;
-				FogActor = *It;
-				break;
-			}
-		}
+		return;
+	}
+
+	if (!SunLight && Registry->GetSunLight())
+	{
+		SunLight = Registry->GetSunLight();
+		SunLightActor = SunLight->GetOwner();
+	}
+
+	if (!SkyLight && Registry->GetSkyLight())
+	{
+		SkyLight = Registry->GetSkyLight();
+		SkyLightActor = SkyLight->GetOwner();
+	}
+
+	if (!HeightFog && Registry->GetHeightFog())
+	{
+		HeightFog = Registry->GetHeightFog();
+		FogActor = HeightFog->GetOwner();
 	}
+
+	// Newly found lights get the current values on the next tick
+	bHasAppliedSun = false;
+	bHasAppliedVisuals = false;
+	bLightingUpdatePending = true;
 }
 
 void ADayNightManager::FindPlayerPostProcess()
@@ -563,30 +860,55 @@ FTimePeriodVisuals ADayNightManager::LerpVisuals(const FTimePeriodVisuals& A, co
 
 void ADayNightManager::ApplyVisuals(const FTimePeriodVisuals& Visuals)
 {
+	// Each group is compared with what it was last pushed, so slow drifts still add up to a push
+	const float Tolerance = VisualsEpsilon;
+	const bool bForce = !bHasAppliedVisuals;
+	FTimePeriodVisuals& Applied = AppliedVisuals;
+	int32 NumPushes = 0;
+
 	// Apply to directional light (sun)
-	if (SunLight)
+	if (SunLight && (bForce || !Visuals.SunColor.Equals(Applied.SunColor, Tolerance)
+		|| !FMath::IsNearlyEqual(Visuals.SunIntensity, Applied.SunIntensity, Tolerance)))
 	{
 		SunLight->SetLightColor(Visuals.SunColor);
 		SunLight->SetIntensity(Visuals.SunIntensity);
+		Applied.SunColor = Visuals.SunColor;
+		Applied.SunIntensity = Visuals.SunIntensity;
+		++NumPushes;
 	}
 
 	// Apply to sky light
-	if (SkyLight)
+	if (SkyLight && (bForce || !Visuals.SkyLightColor.Equals(Applied.SkyLightColor, Tolerance)
+		|| !FMath::IsNearlyEqual(Visuals.SkyLightIntensity, Applied.SkyLightIntensity, Tolerance)))
 	{
 		SkyLight->SetLightColor(Visuals.SkyLightColor);
 		SkyLight->SetIntensity(Visuals.SkyLightIntensity);
 		SkyLight->MarkRenderStateDirty();
+		Applied.SkyLightColor = Visuals.SkyLightColor;
+		Applied.SkyLightIntensity = Visuals.SkyLightIntensity;
+		++NumPushes;
 	}
 
-	// Apply to fog
-	if (HeightFog)
+	// Apply to fog (density values are tiny - compare relative to them)
+	if (HeightFog && (bForce || !Visuals.FogColor.Equals(Applied.FogColor, Tolerance)
+		|| !FMath::IsNearlyEqual(Visuals.FogDensity, Applied.FogDensity, Tolerance * FMath::Max(Applied.FogDensity, 0.001f))))
 	{
 		HeightFog->SetFogDensity(Visuals.FogDensity);
 		HeightFog->SetFogInscatteringColor(Visuals.FogColor);
+		Applied.FogColor = Visuals.FogColor;
+		Applied.FogDensity = Visuals.FogDensity;
+		++NumPushes;
 	}
 
-	// Apply post-process settings through DystopianPostProcess
-	if (PlayerPostProcess)
+	// Apply post-process settings through DystopianPostProcess. Regular pushes are already a smooth
+	// curve (the LUT blends period changes), so they apply directly; only a time skip blends, and
+	// pushes wait for that blend to finish instead of restarting it.
+	const float WorldTime = GetWorld()->GetTimeSeconds();
+	if (PlayerPostProcess && (bBlendNextPostProcess || WorldTime >= PostProcessBlendEndTime) && (bForce
+		|| !FMath::IsNearlyEqual(Visuals.Saturation, Applied.Saturation, Tolerance)
+		|| !FMath::IsNearlyEqual(Visuals.Temperature, Applied.Temperature, Tolerance)
+		|| !FMath::IsNearlyEqual(Visuals.ExposureCompensation, Applied.ExposureCompensation, Tolerance)
+		|| !FMath::IsNearlyEqual(Visuals.VignetteIntensity, Applied.VignetteIntensity, Tolerance)))
 	{
 		// Update the post-process settings
 		FDystopianSettings NewSettings = PlayerPostProcess->Settings;
@@ -595,8 +917,20 @@ void ADayNightManager::ApplyVisuals(const FTimePeriodVisuals& Visuals)
 		NewSettings.ExposureCompensation = Visuals.ExposureCompensation;
 		NewSettings.VignetteIntensity = Visuals.VignetteIntensity;
 
-		PlayerPostProcess->BlendToSettings(NewSettings, TimePeriodBlendTime * 0.5f);
+		const float BlendTime = bBlendNextPostProcess ? TimePeriodBlendTime * 0.5f : 0.0f;
+		PlayerPostProcess->BlendToSettings(NewSettings, BlendTime);
+		PostProcessBlendEndTime = WorldTime + BlendTime;
+		Applied.Saturation = Visuals.Saturation;
+		Applied.Temperature = Visuals.Temperature;
+		Applied.ExposureCompensation = Visuals.ExposureCompensation;
+		Applied.VignetteIntensity = Visuals.VignetteIntensity;
+		++NumPushes;
 	}
+
+	bHasAppliedVisuals = true;
+	bBlendNextPostProcess = false;
+	StatsWindowPushes += NumPushes;
+	INC_DWORD_STAT_BY(STAT_LightingRenderPushes, NumPushes);
 }
 
 bool ADayNightManager::IsDaytime() const
@@ -622,10 +956,29 @@ FTimePeriodGameplay ADayNightManager::GetCurrentGameplayModifiers() const
 }
 
 void ADayNightManager::SetTime(FCOTMGameTime NewTime, bool bTriggerEvents)
+{
+	// Weather runs in real seconds: a game minute lasts DayCycleDuration / 1440 of them at TimeScale 1
+	const int32 MinutesSkipped = (NewTime.Day - CurrentTime.Day) * 1440 + NewTime.GetTotalMinutes() - CurrentTime.GetTotalMinutes();
+	if (MinutesSkipped > 0 && WeatherSystem)
+	{
+		WeatherSystem->AdvanceWeather(MinutesSkipped * DayCycleDuration / 1440.0f);
+	}
+
+	// A jump in time eases the grade over instead of snapping it
+	bBlendNextPostProcess = true;
+	ApplyTime(NewTime, bTriggerEvents);
+}
+
+void ADayNightManager::ApplyTime(const FCOTMGameTime& NewTime, bool bTriggerEvents)
 {
 	FCOTMGameTime OldTime = CurrentTime;
 	CurrentTime = NewTime;
 
+	if (bTriggerEvents && CurrentTime.Day != OldTime.Day)
+	{
+		OnDayChanged.Broadcast(CurrentTime.Day);
+	}
+
 	// Update period
 	ETimePeriod OldPeriod = CurrentTimePeriod;
 	CurrentTimePeriod = CalculateTimePeriod();
@@ -636,13 +989,8 @@ void ADayNightManager::SetTime(FCOTMGameTime NewTime, bool bTriggerEvents)
 	}
 
 	// Immediate visual update
-	bIsBlendingTimePeriod = false;
-	if (TimePeriodVisuals.Contains(CurrentTimePeriod))
-	{
-		ApplyVisuals(TimePeriodVisuals[CurrentTimePeriod]);
-	}
-
-	UpdateSunRotation();
+	FractionalMinutes = 0.0f;
+	ForceLightingUpdate();
 }
 
 void ADayNightManager::SetTimeByHourMinute(int32 Hour, int32 Minute, bool bTriggerEvents)
@@ -652,8 +1000,12 @@ void ADayNightManager::SetTimeByHourMinute(int32 Hour, int32 Minute, bool bTrigg
 
 void ADayNightManager::SkipToTimePeriod(ETimePeriod TargetPeriod, bool bTriggerEvents)
 {
-	int32 TargetHour = GetTimePeriodStartHour(TargetPeriod);
-	SetTimeByHourMinute(TargetHour, 0, bTriggerEvents);
+	FCOTMGameTime Target(GetTimePeriodStartHour(TargetPeriod), 0, CurrentTime.Day);
+	if (Target.GetTotalMinutes() < CurrentTime.GetTotalMinutes())
+	{
+		Target.Day++;
+	}
+	SetTime(Target, bTriggerEvents);
 }
 
 int32 ADayNightManager::GetTimePeriodStartHour(ETimePeriod Period) const
@@ -687,7 +1039,8 @@ void ADayNightManager::GetSaveData(FCOTMGameTime& OutTime, EWeatherType& OutWeat
 
 void ADayNightManager::LoadSaveData(const FCOTMGameTime& InTime, EWeatherType InWeather)
 {
-	SetTime(InTime, false);
+	// A loaded time isn't a skip - the weather comes from the save
+	ApplyTime(InTime, false);
 
 	if (WeatherSystem)
 	{
@@ -697,21 +1050,6 @@ void ADayNightManager::LoadSaveData(const FCOTMGameTime& InTime, EWeatherType In
 
 ADayNightManager* ADayNightManager::GetDayNightManager(const UObject* WorldContextObject)
 {
-	if (!WorldContextObject)
-	{
-		return nullptr;
-	}
-
-	UWorld* World = WorldContextObject->GetWorld();
-	if (!World)
-	{
-		return nullptr;
-	}
-
-	for (TActorIterator<ADayNightManager> It(World); It; ++It)
-	{
-		return *It;
-	}
-
-	return nullptr;
+	const UEnvironmentRegistry* Registry = UEnvironmentRegistry::Get(WorldContextObject);
+	return Registry ? Registry->GetDayNightManager() : nullptr;
 }
@@ -6,6 +6,7 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
 #include "DayNightTypes.h"
+#include "DayCycleLUT.h"
 #include "DayNightManager.generated.h"
 
 class UDirectionalLightComponent;
@@ -42,9 +43,15 @@ public:
 	ADayNightManager();
 
 protected:
+	virtual void PostInitializeComponents() override;
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void Tick(float DeltaTime) override;
 
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
 public:
 	// ==================== Core Configuration ====================
 
@@ -66,7 +73,7 @@ public:
 
 	// ==================== Lighting References ====================
 
-	/** Reference to the directional light (sun/moon) in the level */
+	/** Reference to the directional light (sun/moon) in the level (found in the background if unset) */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Day Night|Lighting")
 	AActor* SunLightActor;
 
@@ -96,10 +103,47 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Day Night|Gameplay")
 	TMap<ETimePeriod, FTimePeriodGameplay> TimePeriodGameplay;
 
-	/** Blend time when transitioning between time periods (seconds) */
+	/** Blend time when transitioning between time periods (seconds at TimeScale 1, baked as whole game minutes) */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Day Night|Visuals", meta = (ClampMin = "0.0"))
 	float TimePeriodBlendTime = 30.0f;
 
+	/**
+	 * Re-bake the per-minute visuals LUT and the weather multipliers. Call after changing
+	 * TimePeriodVisuals or the weather system's WeatherVisuals at runtime - blend time and
+	 * day length changes are picked up automatically.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Day Night|Visuals")
+	void RebuildVisualsLUT();
+
+#if !UE_BUILD_SHIPPING
+	/**
+	 * Compare the LUT with the real-time LerpVisuals blend it replaced, at quarter-minute steps over a
+	 * whole day. Returns true if they match within what the whole-minute blend rounding allows.
+	 */
+	bool VerifyVisualsLUT() const;
+
+	/** Run a copy of the weather timeline for a number of game days without ticking; logs cost and weather distribution */
+	void SimulateWeather(int32 Days) const;
+#endif
+
+	// ==================== Update Policy ====================
+
+	/** Seconds between lighting updates at TimeScale 1; faster time scales update proportionally more often (0 = every frame) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Day Night|Performance", meta = (ClampMin = "0.0", ClampMax = "2.0"))
+	float LightingUpdateInterval = 0.25f;
+
+	/** Sun rotation change (degrees) below which the sun isn't moved */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Day Night|Performance", meta = (ClampMin = "0.0"))
+	float SunAngleEpsilon = 0.05f;
+
+	/** Color/intensity/density change below which a light, the fog or the post-process isn't updated */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Day Night|Performance", meta = (ClampMin = "0.0"))
+	float VisualsEpsilon = 0.002f;
+
+	/** Render-state updates per second skipped compared to pushing every component every frame */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Day Night|Performance")
+	float GetRenderUpdatesSavedPerSecond() const { return RenderUpdatesSavedPerSecond; }
+
 	// ==================== Components ====================
 
 	/** Weather system component */
@@ -174,7 +218,7 @@ public:
 
 	// ==================== Time Control ====================
 
-	/** Set the current time (triggers appropriate events) */
+	/** Set the current time (triggers appropriate events). Moving forward fast-forwards the weather too */
 	UFUNCTION(BlueprintCallable, Category = "Day Night")
 	void SetTime(FCOTMGameTime NewTime, bool bTriggerEvents = true);
 
@@ -182,7 +226,7 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Day Night")
 	void SetTimeByHourMinute(int32 Hour, int32 Minute, bool bTriggerEvents = true);
 
-	/** Skip to a specific time period */
+	/** Skip forward to the next start of a time period (the next day's if it already started today) */
 	UFUNCTION(BlueprintCallable, Category = "Day Night")
 	void SkipToTimePeriod(ETimePeriod TargetPeriod, bool bTriggerEvents = true);
 
@@ -210,7 +254,7 @@ public:
 
 	// ==================== Static Access ====================
 
-	/** Get the day/night manager instance in the current world */
+	/** Get the day/night manager instance in the current world (registry lookup - no actor iteration) */
 	UFUNCTION(BlueprintCallable, Category = "Day Night", meta = (WorldContext = "WorldContextObject"))
 	static ADayNightManager* GetDayNightManager(const UObject* WorldContextObject);
 
@@ -225,7 +269,7 @@ protected:
 	UPROPERTY(BlueprintReadOnly, Category = "Day Night|State")
 	ETimePeriod CurrentTimePeriod = ETimePeriod::Midday;
 
-	/** Previous time period (for blending) */
+	/** Previous time period */
 	ETimePeriod PreviousTimePeriod = ETimePeriod::Midday;
 
 	/** Last hour for hourly events */
@@ -247,22 +291,64 @@ protected:
 	UPROPERTY()
 	UExponentialHeightFogComponent* HeightFog;
 
-	/** Time period blend state */
-	bool bIsBlendingTimePeriod = false;
-	float TimePeriodBlendAlpha = 0.0f;
-	FTimePeriodVisuals BlendStartVisuals;
-	FTimePeriodVisuals BlendTargetVisuals;
+	/** Lighting update throttle - time since the last update, and a request to update next tick */
+	float TimeSinceLightingUpdate = 0.0f;
+	bool bLightingUpdatePending = true;
+
+	/** Last values pushed to the render components (nothing pushed yet when false) */
+	bool bHasAppliedSun = false;
+	float AppliedSunPitch = 0.0f;
+	bool bHasAppliedVisuals = false;
+	FTimePeriodVisuals AppliedVisuals;
+
+	/** A time skip asked for the next post-process push to blend; regular pushes hold off until that blend ends */
+	bool bBlendNextPostProcess = false;
+	float PostProcessBlendEndTime = 0.0f;
+
+	/** Render-state update stats, over a one second window */
+	float StatsWindowTime = 0.0f;
+	int32 StatsWindowPushes = 0;
+	int32 StatsWindowBaselinePushes = 0;
+	float RenderUpdatesSavedPerSecond = 0.0f;
+
+	/** Time period visuals baked per game minute, and the weather multipliers composed on top */
+	FDayCycleLUT VisualsLUT;
+	FWeatherVisualsLUT WeatherLUT;
+
+	/** Period blend length the LUT was baked with (game minutes, -1 = not baked) */
+	int32 BakedBlendMinutes = -1;
 
 	// ==================== Internal Functions ====================
 
 	/** Update time progression */
 	void UpdateTime(float DeltaTime);
 
+	/** Set the time and refresh the visuals, leaving the weather alone */
+	void ApplyTime(const FCOTMGameTime& NewTime, bool bTriggerEvents);
+
 	/** Update sun/moon rotation based on time */
 	void UpdateSunRotation();
 
-	/** Update lighting based on current time period */
-	void UpdateLighting(float DeltaTime);
+	/** Sample the visuals LUT for the current time and weather and apply the result */
+	void UpdateLighting();
+
+	/** Current time of day in minutes since midnight, including the fractional minute */
+	float GetMinuteOfDay() const;
+
+	/** Period blend length in game minutes for the current TimePeriodBlendTime and DayCycleDuration */
+	int32 GetTimePeriodBlendMinutes() const;
+
+	/** Visuals at the current time of day with the weather applied */
+	FPackedDayVisuals SampleVisuals() const;
+
+	/** Seconds between lighting updates for the current TimeScale */
+	float GetLightingUpdateInterval() const;
+
+	/** Push sun rotation and visuals now, even if unchanged (time jumps, new lights) */
+	void ForceLightingUpdate();
+
+	/** Count render-state pushes against the every-frame baseline */
+	void UpdateRenderStats(float DeltaTime);
 
 	/** Update post-process based on time period */
 	void UpdatePostProcess();
@@ -270,22 +356,30 @@ protected:
 	/** Determine time period from current time */
 	ETimePeriod CalculateTimePeriod() const;
 
+	/** Time period an hour of the day belongs to */
+	static ETimePeriod GetTimePeriodForHour(int32 Hour);
+
 	/** Check for and fire time-based events */
 	void CheckTimeEvents();
 
 	/** Initialize default time period configurations */
 	void InitializeDefaultSettings();
 
-	/** Find and cache light component references */
+	/** Cache light components: assigned actors first, then the environment registry (discovery fills the rest later) */
 	void CacheLightReferences();
 
+	/** The environment registry found a light - pick up any we're missing */
+	void OnEnvironmentChanged();
+
+	FDelegateHandle EnvironmentChangedHandle;
+
 	/** Find player's post-process component */
 	void FindPlayerPostProcess();
 
-	/** Lerp between two visual configurations */
+	/** Lerp between two visual configurations (reference path - runtime sampling goes through the LUT) */
 	FTimePeriodVisuals LerpVisuals(const FTimePeriodVisuals& A, const FTimePeriodVisuals& B, float Alpha) const;
 
-	/** Apply visual settings to lights and fog */
+	/** Apply visual settings to lights and fog - only the groups that changed by more than VisualsEpsilon */
 	void ApplyVisuals(const FTimePeriodVisuals& Visuals);
 
 	/** Get the starting hour for a time period */
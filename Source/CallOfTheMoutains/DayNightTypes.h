@@ -43,6 +43,9 @@ enum class EWeatherType : uint8
 	Snow			UMETA(DisplayName = "Snow")				// Snowfall
 };
 
+/** Number of weather types (EWeatherType has no MAX entry - keep in sync with the last enumerator) */
+constexpr int32 NumWeatherTypes = static_cast<int32>(EWeatherType::Snow) + 1;
+
 /**
  * Weather transition state
  */
@@ -332,6 +335,46 @@ struct FAmbientAudioSet
 	float RandomSoundVolume = 0.8f;
 };
 
+/**
+ * Position in a seeded weather timeline (see FWeatherTimeline).
+ * The seed plus this cursor reproduce the weather exactly - it's what save games store.
+ */
+USTRUCT()
+struct FWeatherTimelineCursor
+{
+	GENERATED_BODY()
+
+	/** Every segment's durations and next weather are rolled from this */
+	UPROPERTY(SaveGame)
+	int32 Seed = 0;
+
+	/** Segments since the timeline started (one weather held, then the transition out of it) */
+	UPROPERTY(SaveGame)
+	int32 Segment = 0;
+
+	/** Weather held during the segment */
+	UPROPERTY(SaveGame)
+	EWeatherType Weather = EWeatherType::Clear;
+
+	/** Weather clock time the segment started (seconds) */
+	UPROPERTY(SaveGame)
+	double SegmentStart = 0.0;
+
+	/** Weather clock time now (seconds) */
+	UPROPERTY(SaveGame)
+	double Time = 0.0;
+
+	/** Segment was started by a scripted transition: no held phase, fixed target and duration */
+	UPROPERTY(SaveGame)
+	bool bForced = false;
+
+	UPROPERTY(SaveGame)
+	EWeatherType ForcedTarget = EWeatherType::Clear;
+
+	UPROPERTY(SaveGame)
+	float ForcedTransitionDuration = 0.0f;
+};
+
 // ==================== Delegates ====================
 
 /** Called when time period changes */
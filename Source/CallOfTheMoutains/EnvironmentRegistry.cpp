@@ -0,0 +1,225 @@
+// CallOfTheMoutains - Environment Registry Implementation
+
+#include "EnvironmentRegistry.h"
+#include "DayNightManager.h"
+#include "CallOfTheMoutains.h"
+#include "Components/DirectionalLightComponent.h"
+#include "Components/SkyLightComponent.h"
+#include "Components/ExponentialHeightFogComponent.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+
+DECLARE_CYCLE_STAT(TEXT("Environment Discovery"), STAT_EnvironmentDiscovery, STATGROUP_CallOfTheMoutains);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Environment Actors Scanned"), STAT_EnvironmentActorsScanned, STATGROUP_CallOfTheMoutains);
+
+UEnvironmentRegistry* UEnvironmentRegistry::Get(const UObject* WorldContextObject)
+{
+	UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UEnvironmentRegistry>() : nullptr;
+}
+
+void UEnvironmentRegistry::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddUObject(this, &UEnvironmentRegistry::OnLevelAdded);
+}
+
+void UEnvironmentRegistry::Deinitialize()
+{
+	FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+	StopDiscovery();
+
+	DayNightManager.Reset();
+	SunLight.Reset();
+	SkyLight.Reset();
+	HeightFog.Reset();
+	OnEnvironmentChanged.Clear();
+
+	Super::Deinitialize();
+}
+
+bool UEnvironmentRegistry::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+bool UEnvironmentRegistry::IsTickable() const
+{
+	return bDiscovering;
+}
+
+TStatId UEnvironmentRegistry::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UEnvironmentRegistry, STATGROUP_Tickables);
+}
+
+// ==================== Registration ====================
+
+void UEnvironmentRegistry::RegisterDayNightManager(ADayNightManager* Manager)
+{
+	if (DayNightManager.IsValid() && DayNightManager.Get() != Manager)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("EnvironmentRegistry: More than one DayNightManager - keeping %s"), *DayNightManager->GetName());
+		return;
+	}
+	DayNightManager = Manager;
+}
+
+void UEnvironmentRegistry::UnregisterDayNightManager(ADayNightManager* Manager)
+{
+	if (DayNightManager.Get() == Manager)
+	{
+		DayNightManager.Reset();
+	}
+}
+
+void UEnvironmentRegistry::RegisterSunLight(UDirectionalLightComponent* Light)
+{
+	if (Light && !SunLight.IsValid())
+	{
+		SunLight = Light;
+		OnEnvironmentChanged.Broadcast();
+	}
+}
+
+void UEnvironmentRegistry::RegisterSkyLight(USkyLightComponent* Light)
+{
+	if (Light && !SkyLight.IsValid())
+	{
+		SkyLight = Light;
+		OnEnvironmentChanged.Broadcast();
+	}
+}
+
+void UEnvironmentRegistry::RegisterHeightFog(UExponentialHeightFogComponent* Fog)
+{
+	if (Fog && !HeightFog.IsValid())
+	{
+		HeightFog = Fog;
+		OnEnvironmentChanged.Broadcast();
+	}
+}
+
+// ==================== Discovery ====================
+
+void UEnvironmentRegistry::RequestDiscovery()
+{
+	UWorld* World = GetWorld();
+	if (bDiscovering || HasAllLights() || !World)
+	{
+		return;
+	}
+
+	bDiscovering = true;
+	ScanActorIndex = 0;
+	PendingLevels.Reset();
+	for (ULevel* Level : World->GetLevels())
+	{
+		PendingLevels.Add(Level);
+	}
+
+	ActorSpawnedHandle = World->AddOnActorSpawnedHandler(FOnActorSpawned::FDelegate::CreateUObject(this, &UEnvironmentRegistry::OnActorSpawned));
+}
+
+void UEnvironmentRegistry::StopDiscovery()
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->RemoveOnActorSpawnedHandler(ActorSpawnedHandle);
+	}
+	ActorSpawnedHandle.Reset();
+
+	bDiscovering = false;
+	PendingLevels.Reset();
+	ScanActorIndex = 0;
+}
+
+void UEnvironmentRegistry::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_EnvironmentDiscovery);
+
+	int32 Budget = FMath::Max(ActorsScannedPerFrame, 1);
+	while (Budget > 0 && PendingLevels.Num() > 0 && !HasAllLights())
+	{
+		ULevel* Level = PendingLevels[0].Get();
+		if (!Level || ScanActorIndex >= Level->Actors.Num())
+		{
+			PendingLevels.RemoveAt(0);
+			ScanActorIndex = 0;
+			continue;
+		}
+
+		// Level actor arrays can change between frames - the index is only a resume hint
+		const int32 End = FMath::Min(ScanActorIndex + Budget, Level->Actors.Num());
+		Budget -= End - ScanActorIndex;
+		INC_DWORD_STAT_BY(STAT_EnvironmentActorsScanned, End - ScanActorIndex);
+
+		for (; ScanActorIndex < End; ++ScanActorIndex)
+		{
+			ConsiderActor(Level->Actors[ScanActorIndex]);
+		}
+	}
+
+	if (PendingLevels.Num() == 0 || HasAllLights())
+	{
+		StopDiscovery();
+	}
+}
+
+bool UEnvironmentRegistry::ConsiderActor(AActor* Actor)
+{
+	if (!IsValid(Actor))
+	{
+		return false;
+	}
+
+	// One walk over the components for all three types
+	bool bFound = false;
+	for (UActorComponent* Component : Actor->GetComponents())
+	{
+		if (!SunLight.IsValid())
+		{
+			if (UDirectionalLightComponent* Light = Cast<UDirectionalLightComponent>(Component))
+			{
+				RegisterSunLight(Light);
+				bFound = true;
+				continue;
+			}
+		}
+
+		if (!SkyLight.IsValid())
+		{
+			if (USkyLightComponent* Light = Cast<USkyLightComponent>(Component))
+			{
+				RegisterSkyLight(Light);
+				bFound = true;
+				continue;
+			}
+		}
+
+		if (!HeightFog.IsValid())
+		{
+			if (UExponentialHeightFogComponent* Fog = Cast<UExponentialHeightFogComponent>(Component))
+			{
+				RegisterHeightFog(Fog);
+				bFound = true;
+			}
+		}
+	}
+	return bFound;
+}
+
+void UEnvironmentRegistry::OnActorSpawned(AActor* Actor)
+{
+	ConsiderActor(Actor);
+}
+
+void UEnvironmentRegistry::OnLevelAdded(ULevel* Level, UWorld* World)
+{
+	// Streamed-in levels join a running scan
+	if (bDiscovering && World == GetWorld())
+	{
+		PendingLevels.Add(Level);
+	}
+}
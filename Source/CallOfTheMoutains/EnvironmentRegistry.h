@@ -0,0 +1,93 @@
+// CallOfTheMoutains - Environment Registry
+// O(1) lookup of the day/night manager, sun, sky light and height fog
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "EnvironmentRegistry.generated.h"
+
+class ADayNightManager;
+class UDirectionalLightComponent;
+class USkyLightComponent;
+class UExponentialHeightFogComponent;
+
+/**
+ * Environment Registry
+ * ADayNightManager registers itself and publishes the lights it was given. Lights nobody
+ * published are found by a background discovery scan: one pass over the loaded levels' actors,
+ * at most ActorsScannedPerFrame per frame, checking all three component types at once. Levels
+ * streamed in and actors spawned during discovery are picked up too. The scan stops as soon as
+ * everything is found and never runs unless requested.
+ */
+UCLASS()
+class CALLOFTHEMOUTAINS_API UEnvironmentRegistry : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Get the registry for a world context (nullptr if unavailable) */
+	static UEnvironmentRegistry* Get(const UObject* WorldContextObject);
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override;
+
+	// ==================== Day/Night Manager ====================
+
+	void RegisterDayNightManager(ADayNightManager* Manager);
+	void UnregisterDayNightManager(ADayNightManager* Manager);
+	ADayNightManager* GetDayNightManager() const { return DayNightManager.Get(); }
+
+	// ==================== Lights (first registration wins) ====================
+
+	void RegisterSunLight(UDirectionalLightComponent* Light);
+	void RegisterSkyLight(USkyLightComponent* Light);
+	void RegisterHeightFog(UExponentialHeightFogComponent* Fog);
+
+	UDirectionalLightComponent* GetSunLight() const { return SunLight.Get(); }
+	USkyLightComponent* GetSkyLight() const { return SkyLight.Get(); }
+	UExponentialHeightFogComponent* GetHeightFog() const { return HeightFog.Get(); }
+
+	/** Whether sun, sky light and fog are all known */
+	bool HasAllLights() const { return SunLight.IsValid() && SkyLight.IsValid() && HeightFog.IsValid(); }
+
+	/** Start a time-sliced scan for the lights not registered yet (no-op if all are known) */
+	void RequestDiscovery();
+
+	/** Is a discovery scan in progress? */
+	bool IsDiscovering() const { return bDiscovering; }
+
+	/** Broadcast when a light is registered or discovered */
+	FSimpleMulticastDelegate OnEnvironmentChanged;
+
+	/** Actors checked per frame while discovering */
+	int32 ActorsScannedPerFrame = 256;
+
+private:
+	TWeakObjectPtr<ADayNightManager> DayNightManager;
+	TWeakObjectPtr<UDirectionalLightComponent> SunLight;
+	TWeakObjectPtr<USkyLightComponent> SkyLight;
+	TWeakObjectPtr<UExponentialHeightFogComponent> HeightFog;
+
+	// Discovery state
+	bool bDiscovering = false;
+	TArray<TWeakObjectPtr<ULevel>> PendingLevels;
+	int32 ScanActorIndex = 0;
+
+	FDelegateHandle ActorSpawnedHandle;
+	FDelegateHandle LevelAddedHandle;
+
+	/** Register any environment component an actor has. Returns true if something new was found */
+	bool ConsiderActor(AActor* Actor);
+
+	void StopDiscovery();
+
+	void OnActorSpawned(AActor* Actor);
+	void OnLevelAdded(ULevel* Level, UWorld* World);
+};
@@ -1,8 +1,11 @@
 // CallOfTheMoutains - Equipment Component Implementation
 
 #include "EquipmentComponent.h"
+#include "CallOfTheMoutains.h"
 #include "InventoryComponent.h"
+#include "ItemDatabaseSubsystem.h"
 #include "HealthComponent.h"
+#include "AttributeModifierComponent.h"
 #include "LampActor.h"
 #include "Engine/DataTable.h"
 #include "Components/SkeletalMeshComponent.h"
@@ -16,6 +19,33 @@
 #include "UObject/ConstructorHelpers.h"
 #include "Kismet/GameplayStatics.h"
 #include "Sound/SoundBase.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Equipment Hot Path Sync Loads"), STAT_EquipmentHotPathSyncLoads, STATGROUP_CallOfTheMoutains);
+
+namespace
+{
+	/** Return the resident asset if loaded, otherwise sync load it and count the hitch */
+	template<typename AssetType>
+	AssetType* ResolveResidentAsset(const TSoftObjectPtr<AssetType>& SoftAsset, int32& SyncLoadCounter)
+	{
+		if (SoftAsset.IsNull())
+		{
+			return nullptr;
+		}
+
+		if (AssetType* Resident = SoftAsset.Get())
+		{
+			return Resident;
+		}
+
+		SyncLoadCounter++;
+		INC_DWORD_STAT(STAT_EquipmentHotPathSyncLoads);
+		UE_LOG(LogTemp, Warning, TEXT("EquipmentComponent: Sync loading %s on combat hot path (not preloaded)"), *SoftAsset.ToString());
+		return SoftAsset.LoadSynchronous();
+	}
+}
 
 UEquipmentComponent::UEquipmentComponent()
 {
@@ -67,6 +97,12 @@ void UEquipmentComponent::BeginPlay()
 		}
 	}
 
+	// Item lookups go through the shared item database
+	if (UItemDatabaseSubsystem* ItemDatabase = UItemDatabaseSubsystem::Get(this))
+	{
+		ItemDatabase->RegisterItemTable(ItemDataTable);
+	}
+
 	// Initialize hotbar slots
 	HotbarSlots.Add(EHotbarSlot::Consumable, FHotbarSlotData());
 	HotbarSlots.Add(EHotbarSlot::PrimaryWeapon, FHotbarSlotData());
@@ -105,6 +141,24 @@ void UEquipmentComponent::BeginPlay()
 		AssignToHotbar(FName("TestShield"), EHotbarSlot::OffHand);
 		AssignToHotbar(FName("RustyKey"), EHotbarSlot::Special);
 	}
+
+	// Start streaming unarmed montages so the first punch doesn't hitch
+	RequestUnarmedPreload();
+}
+
+void UEquipmentComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	// Release all pinned preload handles
+	for (auto& Pair : PreloadHandles)
+	{
+		if (Pair.Value.IsValid())
+		{
+			Pair.Value->ReleaseHandle();
+		}
+	}
+	PreloadHandles.Empty();
+
+	Super::EndPlay(EndPlayReason);
 }
 
 void UEquipmentComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
@@ -125,18 +179,13 @@ void UEquipmentComponent::TickComponent(float DeltaTime, ELevelTick TickType, FA
 
 bool UEquipmentComponent::EquipItem(FName ItemID)
 {
-	FItemData ItemData;
-	if (!GetItemData(ItemID, ItemData))
+	const FItemHotData* ItemData = FindItemHotData(ItemID);
+	if (!ItemData || !ItemData->IsEquipment())
 	{
 		return false;
 	}
 
-	if (!ItemData.IsEquipment())
-	{
-		return false;
-	}
-
-	return EquipItemToSlot(ItemID, ItemData.EquipmentSlot);
+	return EquipItemToSlot(ItemID, ItemData->EquipmentSlot);
 }
 
 bool UEquipmentComponent::EquipItemToSlot(FName ItemID, EEquipmentSlot Slot, bool bFromSaveLoad)
@@ -146,11 +195,12 @@ bool UEquipmentComponent::EquipItemToSlot(FName ItemID, EEquipmentSlot Slot, boo
 		return false;
 	}
 
-	FItemData ItemData;
-	if (!GetItemData(ItemID, ItemData))
+	const FItemData* ItemDataPtr = FindItemData(ItemID);
+	if (!ItemDataPtr)
 	{
 		return false;
 	}
+	const FItemData& ItemData = *ItemDataPtr;
 
 	// Check if item can go in this slot
 	if (ItemData.EquipmentSlot != Slot)
@@ -179,6 +229,9 @@ bool UEquipmentComponent::EquipItemToSlot(FName ItemID, EEquipmentSlot Slot, boo
 	// Equip item
 	EquippedItems[Slot] = ItemID;
 
+	// Stream in montages/sounds/meshes now so attacks never load on button press
+	RequestSlotPreload(Slot, ItemData);
+
 	// Attach visual mesh
 	if (ItemData.IsWeapon())
 	{
@@ -238,10 +291,10 @@ bool UEquipmentComponent::UnequipSlot(EEquipmentSlot Slot)
 	}
 
 	// Play unequip montage if this is a weapon
-	FItemData ItemData;
-	if (GetItemData(CurrentItem, ItemData) && ItemData.IsWeapon())
+	const FItemData* ItemData = FindItemData(CurrentItem);
+	if (ItemData && ItemData->IsWeapon())
 	{
-		PlayWeaponMontage(ItemData, false);
+		PlayWeaponMontage(*ItemData, false);
 	}
 
 	// Remove visual mesh
@@ -256,6 +309,9 @@ bool UEquipmentComponent::UnequipSlot(EEquipmentSlot Slot)
 
 	EquippedItems[Slot] = NAME_None;
 
+	// Unpin the item's preloaded assets
+	ReleaseSlotPreload(Slot);
+
 	// Update weapon type tracking
 	UpdateWeaponTypes();
 
@@ -276,12 +332,23 @@ FName UEquipmentComponent::GetEquippedItem(EEquipmentSlot Slot) const
 
 bool UEquipmentComponent::GetEquippedItemData(EEquipmentSlot Slot, FItemData& OutItemData) const
 {
-	FName ItemID = GetEquippedItem(Slot);
-	if (ItemID.IsNone())
+	if (const FItemData* ItemData = FindEquippedItemData(Slot))
 	{
-		return false;
+		UItemDatabaseSubsystem::NotifyItemDataCopied();
+		OutItemData = *ItemData;
+		return true;
 	}
-	return GetItemData(ItemID, OutItemData);
+	return false;
+}
+
+const FItemData* UEquipmentComponent::FindEquippedItemData(EEquipmentSlot Slot) const
+{
+	return FindItemData(GetEquippedItem(Slot));
+}
+
+const FItemHotData* UEquipmentComponent::FindEquippedItemHotData(EEquipmentSlot Slot) const
+{
+	return FindItemHotData(GetEquippedItem(Slot));
 }
 
 bool UEquipmentComponent::IsSlotEquipped(EEquipmentSlot Slot) const
@@ -297,10 +364,9 @@ FItemStats UEquipmentComponent::GetTotalEquippedStats() const
 	{
 		if (!Pair.Value.IsNone())
 		{
-			FItemData ItemData;
-			if (GetItemData(Pair.Value, ItemData))
+			if (const FItemHotData* ItemData = FindItemHotData(Pair.Value))
 			{
-				TotalStats = TotalStats + ItemData.Stats;
+				TotalStats = TotalStats + ItemData->Stats;
 			}
 		}
 	}
@@ -315,11 +381,12 @@ bool UEquipmentComponent::AssignToHotbar(FName ItemID, EHotbarSlot HotbarSlot)
 		return false;
 	}
 
-	FItemData ItemData;
-	if (!GetItemData(ItemID, ItemData))
+	const FItemHotData* ItemDataPtr = FindItemHotData(ItemID);
+	if (!ItemDataPtr)
 	{
 		return false;
 	}
+	const FItemHotData& ItemData = *ItemDataPtr;
 
 	// Validate item type matches hotbar slot
 	bool bValid = false;
@@ -481,11 +548,12 @@ bool UEquipmentComponent::UseConsumable()
 		return false;
 	}
 
-	FItemData ItemData;
-	if (!GetItemData(ItemID, ItemData))
+	const FItemData* ItemDataPtr = FindItemData(ItemID);
+	if (!ItemDataPtr)
 	{
 		return false;
 	}
+	const FItemData& ItemData = *ItemDataPtr;
 
 	// Handle toggle items (infinite use, no consumption)
 	if (ItemData.IsToggleItem())
@@ -627,11 +695,12 @@ bool UEquipmentComponent::UseSpecialItem()
 		return false;
 	}
 
-	FItemData ItemData;
-	if (!GetItemData(ItemID, ItemData))
+	const FItemData* ItemDataPtr = FindItemData(ItemID);
+	if (!ItemDataPtr)
 	{
 		return false;
 	}
+	const FItemData& ItemData = *ItemDataPtr;
 
 	// Handle toggle items (like lanterns, torches)
 	if (ItemData.IsToggleItem())
@@ -798,14 +867,9 @@ void UEquipmentComponent::CycleOffHand()
 
 bool UEquipmentComponent::GetItemData(FName ItemID, FItemData& OutItemData) const
 {
-	if (!ItemDataTable || ItemID.IsNone())
-	{
-		return false;
-	}
-
-	FItemData* FoundData = ItemDataTable->FindRow<FItemData>(ItemID, TEXT("GetItemData"));
-	if (FoundData)
+	if (const FItemData* FoundData = FindItemData(ItemID))
 	{
+		UItemDatabaseSubsystem::NotifyItemDataCopied();
 		OutItemData = *FoundData;
 		return true;
 	}
@@ -813,6 +877,16 @@ bool UEquipmentComponent::GetItemData(FName ItemID, FItemData& OutItemData) cons
 	return false;
 }
 
+const FItemData* UEquipmentComponent::FindItemData(FName ItemID) const
+{
+	return UItemDatabaseSubsystem::FindItem(this, ItemID, ItemDataTable);
+}
+
+const FItemHotData* UEquipmentComponent::FindItemHotData(FName ItemID) const
+{
+	return UItemDatabaseSubsystem::FindHotData(this, ItemID);
+}
+
 void UEquipmentComponent::UpdateStats()
 {
 	UpdateWeight();
@@ -830,10 +904,9 @@ void UEquipmentComponent::UpdateWeight()
 	{
 		if (!Pair.Value.IsNone())
 		{
-			FItemData ItemData;
-			if (GetItemData(Pair.Value, ItemData))
+			if (const FItemHotData* ItemData = FindItemHotData(Pair.Value))
 			{
-				CurrentEquippedWeight += ItemData.Stats.Weight;
+				CurrentEquippedWeight += ItemData->Stats.Weight;
 			}
 		}
 	}
@@ -844,6 +917,18 @@ void UEquipmentComponent::UpdateWeight()
 	// Broadcast if encumbrance state changed
 	if (bIsOverEncumbered != bWasOverEncumbered)
 	{
+		if (UAttributeModifierComponent* AttributeModifiers = UAttributeModifierComponent::FindOrAdd(GetOwner()))
+		{
+			if (bIsOverEncumbered)
+			{
+				AttributeModifiers->SetModifier(EModifiedAttribute::MoveSpeed, EModifierSource::EquipmentWeight, 0.0f, OverEncumberedSpeedMultiplier);
+			}
+			else
+			{
+				AttributeModifiers->RemoveModifier(EModifiedAttribute::MoveSpeed, EModifierSource::EquipmentWeight);
+			}
+		}
+
 		OnEncumbranceChanged.Broadcast(bIsOverEncumbered);
 	}
 }
@@ -879,10 +964,14 @@ void UEquipmentComponent::EquipFromHotbar(EHotbarSlot HotbarSlot)
 			EquippedItems[TargetSlot] = ItemID;
 
 			// Attach new weapon mesh
-			FItemData ItemData;
-			if (GetItemData(ItemID, ItemData))
+			if (const FItemData* ItemData = FindItemData(ItemID))
 			{
-				AttachWeaponMesh(TargetSlot, ItemData);
+				RequestSlotPreload(TargetSlot, *ItemData);
+				AttachWeaponMesh(TargetSlot, *ItemData);
+			}
+			else
+			{
+				ReleaseSlotPreload(TargetSlot);
 			}
 
 			// Update weapon type
@@ -1068,10 +1157,9 @@ void UEquipmentComponent::UpdateWeaponTypes()
 	EWeaponType OldAnimationType = GetCurrentWeaponType();
 
 	// Update primary weapon type
-	FItemData PrimaryData;
-	if (GetEquippedItemData(EEquipmentSlot::PrimaryWeapon, PrimaryData))
+	if (const FItemHotData* PrimaryData = FindEquippedItemHotData(EEquipmentSlot::PrimaryWeapon))
 	{
-		CurrentPrimaryWeaponType = PrimaryData.WeaponType;
+		CurrentPrimaryWeaponType = PrimaryData->WeaponType;
 	}
 	else
 	{
@@ -1079,10 +1167,9 @@ void UEquipmentComponent::UpdateWeaponTypes()
 	}
 
 	// Update off-hand weapon type
-	FItemData OffHandData;
-	if (GetEquippedItemData(EEquipmentSlot::OffHand, OffHandData))
+	if (const FItemHotData* OffHandData = FindEquippedItemHotData(EEquipmentSlot::OffHand))
 	{
-		CurrentOffHandWeaponType = OffHandData.WeaponType;
+		CurrentOffHandWeaponType = OffHandData->WeaponType;
 	}
 	else
 	{
@@ -1155,10 +1242,9 @@ void UEquipmentComponent::StowWeapons()
 	}
 
 	// Play unequip montage for primary weapon before stowing
-	FItemData PrimaryItemData;
-	if (GetEquippedItemData(EEquipmentSlot::PrimaryWeapon, PrimaryItemData))
+	if (const FItemData* PrimaryItemData = FindEquippedItemData(EEquipmentSlot::PrimaryWeapon))
 	{
-		PlayWeaponMontage(PrimaryItemData, false); // false = unequip/stow
+		PlayWeaponMontage(*PrimaryItemData, false); // false = unequip/stow
 	}
 
 	// Move primary weapon to stow socket (skeletal mesh)
@@ -1167,11 +1253,11 @@ void UEquipmentComponent::StowWeapons()
 		if (*PrimaryMesh)
 		{
 			FVector CurrentScale = (*PrimaryMesh)->GetRelativeScale3D();
-			FItemData ItemData;
 			FName SocketName = PrimaryWeaponStowSocket;
-			if (GetEquippedItemData(EEquipmentSlot::PrimaryWeapon, ItemData) && !ItemData.StowSocket.IsNone())
+			const FItemData* ItemData = FindEquippedItemData(EEquipmentSlot::PrimaryWeapon);
+			if (ItemData && !ItemData->StowSocket.IsNone())
 			{
-				SocketName = ItemData.StowSocket;
+				SocketName = ItemData->StowSocket;
 			}
 			if (OwnerMesh->DoesSocketExist(SocketName))
 			{
@@ -1187,11 +1273,11 @@ void UEquipmentComponent::StowWeapons()
 		if (*PrimaryStaticMesh)
 		{
 			FVector CurrentScale = (*PrimaryStaticMesh)->GetRelativeScale3D();
-			FItemData ItemData;
 			FName SocketName = PrimaryWeaponStowSocket;
-			if (GetEquippedItemData(EEquipmentSlot::PrimaryWeapon, ItemData) && !ItemData.StowSocket.IsNone())
+			const FItemData* ItemData = FindEquippedItemData(EEquipmentSlot::PrimaryWeapon);
+			if (ItemData && !ItemData->StowSocket.IsNone())
 			{
-				SocketName = ItemData.StowSocket;
+				SocketName = ItemData->StowSocket;
 			}
 			if (OwnerMesh->DoesSocketExist(SocketName))
 			{
@@ -1208,11 +1294,11 @@ void UEquipmentComponent::StowWeapons()
 		if (*OffHandMesh)
 		{
 			FVector CurrentScale = (*OffHandMesh)->GetRelativeScale3D();
-			FItemData ItemData;
 			FName SocketName = OffHandStowSocket;
-			if (GetEquippedItemData(EEquipmentSlot::OffHand, ItemData) && !ItemData.StowSocket.IsNone())
+			const FItemData* ItemData = FindEquippedItemData(EEquipmentSlot::OffHand);
+			if (ItemData && !ItemData->StowSocket.IsNone())
 			{
-				SocketName = ItemData.StowSocket;
+				SocketName = ItemData->StowSocket;
 			}
 			if (OwnerMesh->DoesSocketExist(SocketName))
 			{
@@ -1228,11 +1314,11 @@ void UEquipmentComponent::StowWeapons()
 		if (*OffHandStaticMesh)
 		{
 			FVector CurrentScale = (*OffHandStaticMesh)->GetRelativeScale3D();
-			FItemData ItemData;
 			FName SocketName = OffHandStowSocket;
-			if (GetEquippedItemData(EEquipmentSlot::OffHand, ItemData) && !ItemData.StowSocket.IsNone())
+			const FItemData* ItemData = FindEquippedItemData(EEquipmentSlot::OffHand);
+			if (ItemData && !ItemData->StowSocket.IsNone())
 			{
-				SocketName = ItemData.StowSocket;
+				SocketName = ItemData->StowSocket;
 			}
 			if (OwnerMesh->DoesSocketExist(SocketName))
 			{
@@ -1263,16 +1349,17 @@ void UEquipmentComponent::DrawWeapons()
 	}
 
 	// Move primary weapon back to hand socket (skeletal mesh)
-	FItemData PrimaryItemData;
+	const FItemData* PrimaryItemData = nullptr;
 	if (USkeletalMeshComponent** PrimaryMesh = WeaponMeshComponents.Find(EEquipmentSlot::PrimaryWeapon))
 	{
 		if (*PrimaryMesh)
 		{
 			FVector CurrentScale = (*PrimaryMesh)->GetRelativeScale3D();
 			FName SocketName = PrimaryWeaponSocket;
-			if (GetEquippedItemData(EEquipmentSlot::PrimaryWeapon, PrimaryItemData) && !PrimaryItemData.AttachSocket.IsNone())
+			PrimaryItemData = FindEquippedItemData(EEquipmentSlot::PrimaryWeapon);
+			if (PrimaryItemData && !PrimaryItemData->AttachSocket.IsNone())
 			{
-				SocketName = PrimaryItemData.AttachSocket;
+				SocketName = PrimaryItemData->AttachSocket;
 			}
 			(*PrimaryMesh)->AttachToComponent(OwnerMesh,
 				FAttachmentTransformRules::SnapToTargetNotIncludingScale, SocketName);
@@ -1286,9 +1373,10 @@ void UEquipmentComponent::DrawWeapons()
 		{
 			FVector CurrentScale = (*PrimaryStaticMesh)->GetRelativeScale3D();
 			FName SocketName = PrimaryWeaponSocket;
-			if (GetEquippedItemData(EEquipmentSlot::PrimaryWeapon, PrimaryItemData) && !PrimaryItemData.AttachSocket.IsNone())
+			PrimaryItemData = FindEquippedItemData(EEquipmentSlot::PrimaryWeapon);
+			if (PrimaryItemData && !PrimaryItemData->AttachSocket.IsNone())
 			{
-				SocketName = PrimaryItemData.AttachSocket;
+				SocketName = PrimaryItemData->AttachSocket;
 			}
 			(*PrimaryStaticMesh)->AttachToComponent(OwnerMesh,
 				FAttachmentTransformRules::SnapToTargetNotIncludingScale, SocketName);
@@ -1302,11 +1390,11 @@ void UEquipmentComponent::DrawWeapons()
 		if (*OffHandMesh)
 		{
 			FVector CurrentScale = (*OffHandMesh)->GetRelativeScale3D();
-			FItemData ItemData;
 			FName SocketName = OffHandSocket;
-			if (GetEquippedItemData(EEquipmentSlot::OffHand, ItemData) && !ItemData.AttachSocket.IsNone())
+			const FItemData* ItemData = FindEquippedItemData(EEquipmentSlot::OffHand);
+			if (ItemData && !ItemData->AttachSocket.IsNone())
 			{
-				SocketName = ItemData.AttachSocket;
+				SocketName = ItemData->AttachSocket;
 			}
 			(*OffHandMesh)->AttachToComponent(OwnerMesh,
 				FAttachmentTransformRules::SnapToTargetNotIncludingScale, SocketName);
@@ -1319,11 +1407,11 @@ void UEquipmentComponent::DrawWeapons()
 		if (*OffHandStaticMesh)
 		{
 			FVector CurrentScale = (*OffHandStaticMesh)->GetRelativeScale3D();
-			FItemData ItemData;
 			FName SocketName = OffHandSocket;
-			if (GetEquippedItemData(EEquipmentSlot::OffHand, ItemData) && !ItemData.AttachSocket.IsNone())
+			const FItemData* ItemData = FindEquippedItemData(EEquipmentSlot::OffHand);
+			if (ItemData && !ItemData->AttachSocket.IsNone())
 			{
-				SocketName = ItemData.AttachSocket;
+				SocketName = ItemData->AttachSocket;
 			}
 			(*OffHandStaticMesh)->AttachToComponent(OwnerMesh,
 				FAttachmentTransformRules::SnapToTargetNotIncludingScale, SocketName);
@@ -1334,9 +1422,9 @@ void UEquipmentComponent::DrawWeapons()
 	bWeaponsStowed = false;
 
 	// Play equip montage for primary weapon after drawing
-	if (PrimaryItemData.IsValid())
+	if (PrimaryItemData && PrimaryItemData->IsValid())
 	{
-		PlayWeaponMontage(PrimaryItemData, true); // true = equip/draw
+		PlayWeaponMontage(*PrimaryItemData, true); // true = equip/draw
 	}
 
 	// Broadcast weapon type change back to actual type
@@ -1407,18 +1495,14 @@ void UEquipmentComponent::LightAttack()
 	if (bHasWeaponEquipped)
 	{
 		// Use weapon's light attack montage array
-		FItemData WeaponData;
-		if (GetEquippedItemData(EEquipmentSlot::PrimaryWeapon, WeaponData))
+		if (const FItemData* WeaponData = FindEquippedItemData(EEquipmentSlot::PrimaryWeapon))
 		{
-			MaxComboCount = WeaponData.LightAttackMontages.Num();
+			MaxComboCount = WeaponData->LightAttackMontages.Num();
 			if (MaxComboCount > 0)
 			{
 				// Get current combo montage (loop back to start)
 				int32 ComboIdx = LightComboIndex % MaxComboCount;
-				if (!WeaponData.LightAttackMontages[ComboIdx].IsNull())
-				{
-					MontageToPlay = WeaponData.LightAttackMontages[ComboIdx].LoadSynchronous();
-				}
+				MontageToPlay = ResolveHotPathMontage(WeaponData->LightAttackMontages[ComboIdx]);
 			}
 		}
 	}
@@ -1429,10 +1513,7 @@ void UEquipmentComponent::LightAttack()
 		if (MaxComboCount > 0)
 		{
 			int32 ComboIdx = LightComboIndex % MaxComboCount;
-			if (!UnarmedLightAttackMontages[ComboIdx].IsNull())
-			{
-				MontageToPlay = UnarmedLightAttackMontages[ComboIdx].LoadSynchronous();
-			}
+			MontageToPlay = ResolveHotPathMontage(UnarmedLightAttackMontages[ComboIdx]);
 		}
 	}
 
@@ -1542,18 +1623,14 @@ void UEquipmentComponent::HeavyAttack()
 	if (bHasWeaponEquipped)
 	{
 		// Use weapon's heavy attack montage array
-		FItemData WeaponData;
-		if (GetEquippedItemData(EEquipmentSlot::PrimaryWeapon, WeaponData))
+		if (const FItemData* WeaponData = FindEquippedItemData(EEquipmentSlot::PrimaryWeapon))
 		{
-			MaxComboCount = WeaponData.HeavyAttackMontages.Num();
+			MaxComboCount = WeaponData->HeavyAttackMontages.Num();
 			if (MaxComboCount > 0)
 			{
 				// Get current combo montage (loop back to start)
 				int32 ComboIdx = HeavyComboIndex % MaxComboCount;
-				if (!WeaponData.HeavyAttackMontages[ComboIdx].IsNull())
-				{
-					MontageToPlay = WeaponData.HeavyAttackMontages[ComboIdx].LoadSynchronous();
-				}
+				MontageToPlay = ResolveHotPathMontage(WeaponData->HeavyAttackMontages[ComboIdx]);
 			}
 		}
 	}
@@ -1564,10 +1641,7 @@ void UEquipmentComponent::HeavyAttack()
 		if (MaxComboCount > 0)
 		{
 			int32 ComboIdx = HeavyComboIndex % MaxComboCount;
-			if (!UnarmedHeavyAttackMontages[ComboIdx].IsNull())
-			{
-				MontageToPlay = UnarmedHeavyAttackMontages[ComboIdx].LoadSynchronous();
-			}
+			MontageToPlay = ResolveHotPathMontage(UnarmedHeavyAttackMontages[ComboIdx]);
 		}
 	}
 
@@ -1808,14 +1882,14 @@ bool UEquipmentComponent::CanParry() const
 	}
 
 	// Check if we have a weapon/shield that can parry
-	FItemData OffHandData;
-	if (GetEquippedItemData(EEquipmentSlot::OffHand, OffHandData) && OffHandData.bCanParry)
+	const FItemData* OffHandData = FindEquippedItemData(EEquipmentSlot::OffHand);
+	if (OffHandData && OffHandData->bCanParry)
 	{
 		return true;
 	}
 
-	FItemData PrimaryData;
-	if (GetEquippedItemData(EEquipmentSlot::PrimaryWeapon, PrimaryData) && PrimaryData.bCanParry)
+	const FItemData* PrimaryData = FindEquippedItemData(EEquipmentSlot::PrimaryWeapon);
+	if (PrimaryData && PrimaryData->bCanParry)
 	{
 		return true;
 	}
@@ -1856,17 +1930,15 @@ void UEquipmentComponent::AttemptParry()
 		{
 			// Try to get parry montage from equipped off-hand first, then primary
 			UAnimMontage* ParryMontage = nullptr;
-			FItemData OffHandData;
-			if (GetEquippedItemData(EEquipmentSlot::OffHand, OffHandData) && !OffHandData.ParryMontage.IsNull())
+			if (const FItemData* OffHandData = FindEquippedItemData(EEquipmentSlot::OffHand))
 			{
-				ParryMontage = OffHandData.ParryMontage.LoadSynchronous();
+				ParryMontage = ResolveHotPathMontage(OffHandData->ParryMontage);
 			}
 			if (!ParryMontage)
 			{
-				FItemData PrimaryData;
-				if (GetEquippedItemData(EEquipmentSlot::PrimaryWeapon, PrimaryData) && !PrimaryData.ParryMontage.IsNull())
+				if (const FItemData* PrimaryData = FindEquippedItemData(EEquipmentSlot::PrimaryWeapon))
 				{
-					ParryMontage = PrimaryData.ParryMontage.LoadSynchronous();
+					ParryMontage = ResolveHotPathMontage(PrimaryData->ParryMontage);
 				}
 			}
 
@@ -1929,18 +2001,18 @@ void UEquipmentComponent::PlayBlockMontage()
 	// Try to get block montage from equipped off-hand first (shield), then primary weapon
 	UAnimMontage* BlockMontage = nullptr;
 
-	FItemData OffHandData;
-	if (GetEquippedItemData(EEquipmentSlot::OffHand, OffHandData) && OffHandData.bCanBlock && !OffHandData.BlockMontage.IsNull())
+	const FItemData* OffHandData = FindEquippedItemData(EEquipmentSlot::OffHand);
+	if (OffHandData && OffHandData->bCanBlock)
 	{
-		BlockMontage = OffHandData.BlockMontage.LoadSynchronous();
+		BlockMontage = ResolveHotPathMontage(OffHandData->BlockMontage);
 	}
 
 	if (!BlockMontage)
 	{
-		FItemData PrimaryData;
-		if (GetEquippedItemData(EEquipmentSlot::PrimaryWeapon, PrimaryData) && PrimaryData.bCanBlock && !PrimaryData.BlockMontage.IsNull())
+		const FItemData* PrimaryData = FindEquippedItemData(EEquipmentSlot::PrimaryWeapon);
+		if (PrimaryData && PrimaryData->bCanBlock)
 		{
-			BlockMontage = PrimaryData.BlockMontage.LoadSynchronous();
+			BlockMontage = ResolveHotPathMontage(PrimaryData->BlockMontage);
 		}
 	}
 
@@ -1967,20 +2039,19 @@ void UEquipmentComponent::StopBlockMontage()
 	}
 
 	// Get the current block montage to stop specifically
+	// A montage that isn't resident can't be playing, so never load here
 	UAnimMontage* BlockMontage = nullptr;
 
-	FItemData OffHandData;
-	if (GetEquippedItemData(EEquipmentSlot::OffHand, OffHandData) && !OffHandData.BlockMontage.IsNull())
+	if (const FItemData* OffHandData = FindEquippedItemData(EEquipmentSlot::OffHand))
 	{
-		BlockMontage = OffHandData.BlockMontage.LoadSynchronous();
+		BlockMontage = OffHandData->BlockMontage.Get();
 	}
 
 	if (!BlockMontage)
 	{
-		FItemData PrimaryData;
-		if (GetEquippedItemData(EEquipmentSlot::PrimaryWeapon, PrimaryData) && !PrimaryData.BlockMontage.IsNull())
+		if (const FItemData* PrimaryData = FindEquippedItemData(EEquipmentSlot::PrimaryWeapon))
 		{
-			BlockMontage = PrimaryData.BlockMontage.LoadSynchronous();
+			BlockMontage = PrimaryData->BlockMontage.Get();
 		}
 	}
 
@@ -2002,18 +2073,15 @@ void UEquipmentComponent::OnParrySuccessful(AActor* AttackingActor)
 	bCanRiposte = true;
 
 	// Play parry sound from equipped off-hand or primary
-	FItemData ParryingItemData;
-	if (GetEquippedItemData(EEquipmentSlot::OffHand, ParryingItemData) && !ParryingItemData.ParrySound.IsNull())
+	const FItemData* ParryingItemData = FindEquippedItemData(EEquipmentSlot::OffHand);
+	if (!ParryingItemData || ParryingItemData->ParrySound.IsNull())
 	{
-		USoundBase* ParrySFX = ParryingItemData.ParrySound.LoadSynchronous();
-		if (ParrySFX)
-		{
-			UGameplayStatics::PlaySoundAtLocation(this, ParrySFX, GetOwner()->GetActorLocation());
-		}
+		ParryingItemData = FindEquippedItemData(EEquipmentSlot::PrimaryWeapon);
 	}
-	else if (GetEquippedItemData(EEquipmentSlot::PrimaryWeapon, ParryingItemData) && !ParryingItemData.ParrySound.IsNull())
+
+	if (ParryingItemData && !ParryingItemData->ParrySound.IsNull())
 	{
-		USoundBase* ParrySFX = ParryingItemData.ParrySound.LoadSynchronous();
+		USoundBase* ParrySFX = ResolveHotPathSound(ParryingItemData->ParrySound);
 		if (ParrySFX)
 		{
 			UGameplayStatics::PlaySoundAtLocation(this, ParrySFX, GetOwner()->GetActorLocation());
@@ -2032,17 +2100,15 @@ void UEquipmentComponent::OnParrySuccessful(AActor* AttackingActor)
 		if (AnimInstance)
 		{
 			UAnimMontage* SuccessMontage = nullptr;
-			FItemData OffHandData;
-			if (GetEquippedItemData(EEquipmentSlot::OffHand, OffHandData) && !OffHandData.ParrySuccessMontage.IsNull())
+			if (const FItemData* OffHandData = FindEquippedItemData(EEquipmentSlot::OffHand))
 			{
-				SuccessMontage = OffHandData.ParrySuccessMontage.LoadSynchronous();
+				SuccessMontage = ResolveHotPathMontage(OffHandData->ParrySuccessMontage);
 			}
 			if (!SuccessMontage)
 			{
-				FItemData PrimaryData;
-				if (GetEquippedItemData(EEquipmentSlot::PrimaryWeapon, PrimaryData) && !PrimaryData.ParrySuccessMontage.IsNull())
+				if (const FItemData* PrimaryData = FindEquippedItemData(EEquipmentSlot::PrimaryWeapon))
 				{
-					SuccessMontage = PrimaryData.ParrySuccessMontage.LoadSynchronous();
+					SuccessMontage = ResolveHotPathMontage(PrimaryData->ParrySuccessMontage);
 				}
 			}
 
@@ -2103,10 +2169,9 @@ bool UEquipmentComponent::PerformRiposte()
 		if (AnimInstance)
 		{
 			UAnimMontage* RiposteMontage = nullptr;
-			FItemData PrimaryData;
-			if (GetEquippedItemData(EEquipmentSlot::PrimaryWeapon, PrimaryData) && !PrimaryData.RiposteMontage.IsNull())
+			if (const FItemData* PrimaryData = FindEquippedItemData(EEquipmentSlot::PrimaryWeapon))
 			{
-				RiposteMontage = PrimaryData.RiposteMontage.LoadSynchronous();
+				RiposteMontage = ResolveHotPathMontage(PrimaryData->RiposteMontage);
 			}
 
 			if (RiposteMontage)
@@ -2153,18 +2218,15 @@ FDamageModifierResult UEquipmentComponent::ModifyIncomingDamage(float IncomingDa
 
 		// Get block stability and sounds from equipped shield/weapon
 		float Stability = 50.0f; // Default
-		FItemData BlockingItemData;
-		bool bHasBlockingItem = false;
-
-		if (GetEquippedItemData(EEquipmentSlot::OffHand, BlockingItemData))
+		const FItemData* BlockingItemData = FindEquippedItemData(EEquipmentSlot::OffHand);
+		if (!BlockingItemData)
 		{
-			Stability = BlockingItemData.BlockStability;
-			bHasBlockingItem = true;
+			BlockingItemData = FindEquippedItemData(EEquipmentSlot::PrimaryWeapon);
 		}
-		else if (GetEquippedItemData(EEquipmentSlot::PrimaryWeapon, BlockingItemData))
+
+		if (BlockingItemData)
 		{
-			Stability = BlockingItemData.BlockStability;
-			bHasBlockingItem = true;
+			Stability = BlockingItemData->BlockStability;
 		}
 
 		// Calculate stamina drain: Damage * Multiplier * (1 - Stability/100)
@@ -2180,9 +2242,9 @@ FDamageModifierResult UEquipmentComponent::ModifyIncomingDamage(float IncomingDa
 			Result.ModifiedDamage = IncomingDamage * 0.5f; // Take 50% damage on guard break
 
 			// Play guard break sound
-			if (bHasBlockingItem && !BlockingItemData.GuardBreakSound.IsNull())
+			if (BlockingItemData && !BlockingItemData->GuardBreakSound.IsNull())
 			{
-				USoundBase* GuardBreakSFX = BlockingItemData.GuardBreakSound.LoadSynchronous();
+				USoundBase* GuardBreakSFX = ResolveHotPathSound(BlockingItemData->GuardBreakSound);
 				if (GuardBreakSFX)
 				{
 					UGameplayStatics::PlaySoundAtLocation(this, GuardBreakSFX, GetOwner()->GetActorLocation());
@@ -2205,9 +2267,9 @@ FDamageModifierResult UEquipmentComponent::ModifyIncomingDamage(float IncomingDa
 		else
 		{
 			// Successfully blocked - play block sound
-			if (bHasBlockingItem && !BlockingItemData.BlockSound.IsNull())
+			if (BlockingItemData && !BlockingItemData->BlockSound.IsNull())
 			{
-				USoundBase* BlockSFX = BlockingItemData.BlockSound.LoadSynchronous();
+				USoundBase* BlockSFX = ResolveHotPathSound(BlockingItemData->BlockSound);
 				if (BlockSFX)
 				{
 					UGameplayStatics::PlaySoundAtLocation(this, BlockSFX, GetOwner()->GetActorLocation());
@@ -2405,20 +2467,16 @@ bool UEquipmentComponent::DropAttack()
 	if (bHasWeaponEquipped)
 	{
 		// Use weapon's drop attack montage
-		FItemData WeaponData;
-		if (GetEquippedItemData(EEquipmentSlot::PrimaryWeapon, WeaponData))
+		if (const FItemData* WeaponData = FindEquippedItemData(EEquipmentSlot::PrimaryWeapon))
 		{
-			if (!WeaponData.DropAttackMontage.IsNull())
-			{
-				MontageToPlay = WeaponData.DropAttackMontage.LoadSynchronous();
-			}
+			MontageToPlay = ResolveHotPathMontage(WeaponData->DropAttackMontage);
 		}
 	}
 
 	// Fallback to unarmed drop attack
-	if (!MontageToPlay && !UnarmedDropAttackMontage.IsNull())
+	if (!MontageToPlay)
 	{
-		MontageToPlay = UnarmedDropAttackMontage.LoadSynchronous();
+		MontageToPlay = ResolveHotPathMontage(UnarmedDropAttackMontage);
 	}
 
 	if (!MontageToPlay)
@@ -2579,3 +2637,125 @@ float UEquipmentComponent::GetDropAttackDamageMultiplier() const
 	}
 	return 1.0f;
 }
+
+// ==================== Asset Preloading ====================
+
+void UEquipmentComponent::RequestSlotPreload(EEquipmentSlot Slot, const FItemData& ItemData)
+{
+	ReleaseSlotPreload(Slot);
+
+	TArray<FSoftObjectPath> AssetsToLoad;
+	auto AddAsset = [&AssetsToLoad](const FSoftObjectPath& AssetPath)
+	{
+		if (AssetPath.IsValid())
+		{
+			AssetsToLoad.AddUnique(AssetPath);
+		}
+	};
+
+	// Meshes
+	AddAsset(ItemData.SkeletalMesh.ToSoftObjectPath());
+	AddAsset(ItemData.WorldMesh.ToSoftObjectPath());
+
+	// Montages
+	AddAsset(ItemData.EquipMontage.ToSoftObjectPath());
+	AddAsset(ItemData.UnequipMontage.ToSoftObjectPath());
+	for (const TSoftObjectPtr<UAnimMontage>& Montage : ItemData.LightAttackMontages)
+	{
+		AddAsset(Montage.ToSoftObjectPath());
+	}
+	for (const TSoftObjectPtr<UAnimMontage>& Montage : ItemData.HeavyAttackMontages)
+	{
+		AddAsset(Montage.ToSoftObjectPath());
+	}
+	AddAsset(ItemData.ParryMontage.ToSoftObjectPath());
+	AddAsset(ItemData.ParrySuccessMontage.ToSoftObjectPath());
+	AddAsset(ItemData.BlockMontage.ToSoftObjectPath());
+	AddAsset(ItemData.RiposteMontage.ToSoftObjectPath());
+	AddAsset(ItemData.DropAttackMontage.ToSoftObjectPath());
+
+	// Sounds
+	AddAsset(ItemData.BlockSound.ToSoftObjectPath());
+	AddAsset(ItemData.ParrySound.ToSoftObjectPath());
+	AddAsset(ItemData.GuardBreakSound.ToSoftObjectPath());
+
+	if (AssetsToLoad.Num() == 0)
+	{
+		return;
+	}
+
+	TSharedPtr<FStreamableHandle> Handle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		AssetsToLoad, FStreamableDelegate(), FStreamableManager::AsyncLoadHighPriority);
+	if (Handle.IsValid())
+	{
+		PreloadHandles.Add(Slot, Handle);
+	}
+}
+
+void UEquipmentComponent::RequestUnarmedPreload()
+{
+	ReleaseSlotPreload(EEquipmentSlot::None);
+
+	TArray<FSoftObjectPath> AssetsToLoad;
+	for (const TSoftObjectPtr<UAnimMontage>& Montage : UnarmedLightAttackMontages)
+	{
+		if (!Montage.IsNull())
+		{
+			AssetsToLoad.AddUnique(Montage.ToSoftObjectPath());
+		}
+	}
+	for (const TSoftObjectPtr<UAnimMontage>& Montage : UnarmedHeavyAttackMontages)
+	{
+		if (!Montage.IsNull())
+		{
+			AssetsToLoad.AddUnique(Montage.ToSoftObjectPath());
+		}
+	}
+	if (!UnarmedDropAttackMontage.IsNull())
+	{
+		AssetsToLoad.AddUnique(UnarmedDropAttackMontage.ToSoftObjectPath());
+	}
+
+	if (AssetsToLoad.Num() == 0)
+	{
+		return;
+	}
+
+	TSharedPtr<FStreamableHandle> Handle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		AssetsToLoad, FStreamableDelegate(), FStreamableManager::AsyncLoadHighPriority);
+	if (Handle.IsValid())
+	{
+		PreloadHandles.Add(EEquipmentSlot::None, Handle);
+	}
+}
+
+void UEquipmentComponent::ReleaseSlotPreload(EEquipmentSlot Slot)
+{
+	if (TSharedPtr<FStreamableHandle>* Handle = PreloadHandles.Find(Slot))
+	{
+		if (Handle->IsValid())
+		{
+			(*Handle)->ReleaseHandle();
+		}
+		PreloadHandles.Remove(Slot);
+	}
+}
+
+bool UEquipmentComponent::IsSlotPreloaded(EEquipmentSlot Slot) const
+{
+	if (const TSharedPtr<FStreamableHandle>* Handle = PreloadHandles.Find(Slot))
+	{
+		return Handle->IsValid() && (*Handle)->HasLoadCompleted();
+	}
+	return false;
+}
+
+UAnimMontage* UEquipmentComponent::ResolveHotPathMontage(const TSoftObjectPtr<UAnimMontage>& Montage)
+{
+	return ResolveResidentAsset(Montage, HotPathSyncLoadCount);
+}
+
+USoundBase* UEquipmentComponent::ResolveHotPathSound(const TSoftObjectPtr<USoundBase>& Sound)
+{
+	return ResolveResidentAsset(Sound, HotPathSyncLoadCount);
+}
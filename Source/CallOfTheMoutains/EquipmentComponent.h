@@ -12,6 +12,7 @@ class UDataTable;
 class USkeletalMeshComponent;
 class UStaticMeshComponent;
 class UHealthComponent;
+struct FStreamableHandle;
 
 // Delegates for equipment changes
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnEquipmentChanged, EEquipmentSlot, Slot, FName, NewItemID);
@@ -78,6 +79,7 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 public:
@@ -109,6 +111,10 @@ public:
 	UPROPERTY(BlueprintReadOnly, Category = "Equipment|Weight")
 	bool bIsOverEncumbered = false;
 
+	/** Move speed multiplier while over-encumbered (applied as the EquipmentWeight modifier layer) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Equipment|Weight", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float OverEncumberedSpeedMultiplier = 0.6f;
+
 	// ==================== Socket Names ====================
 
 	/** Socket name for primary weapon (right hand) */
@@ -290,10 +296,16 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Equipment")
 	FName GetEquippedItem(EEquipmentSlot Slot) const;
 
-	/** Get item data for equipped item */
+	/** Get a copy of the equipped item's data (Blueprint wrapper - C++ should use FindEquippedItemData) */
 	UFUNCTION(BlueprintCallable, Category = "Equipment")
 	bool GetEquippedItemData(EEquipmentSlot Slot, FItemData& OutItemData) const;
 
+	/** Equipped item's data row without copying (nullptr if slot is empty) */
+	const FItemData* FindEquippedItemData(EEquipmentSlot Slot) const;
+
+	/** Equipped item's hot fields from the item database (nullptr if slot is empty) */
+	const FItemHotData* FindEquippedItemHotData(EEquipmentSlot Slot) const;
+
 	/** Check if slot has item equipped */
 	UFUNCTION(BlueprintCallable, Category = "Equipment")
 	bool IsSlotEquipped(EEquipmentSlot Slot) const;
@@ -539,10 +551,31 @@ public:
 
 	// ==================== Item Data Access ====================
 
-	/** Get item data from data table (public for UI access) */
+	/** Get a copy of item data (Blueprint wrapper - C++ should use FindItemData) */
 	UFUNCTION(BlueprintCallable, Category = "Equipment")
 	bool GetItemData(FName ItemID, FItemData& OutItemData) const;
 
+	/** Item data row without copying (public for UI access, nullptr if not found) */
+	const FItemData* FindItemData(FName ItemID) const;
+
+	/** Hot item fields from the item database - prefer this in loops (nullptr if not found) */
+	const FItemHotData* FindItemHotData(FName ItemID) const;
+
+	// ==================== Asset Preloading ====================
+
+	/** Number of montages/sounds that had to be loaded synchronously on a combat hot path
+	 * (preload not finished or asset missing from the preload set). Should stay at 0. */
+	UFUNCTION(BlueprintCallable, Category = "Equipment|Preload")
+	int32 GetHotPathSyncLoadCount() const { return HotPathSyncLoadCount; }
+
+	/** Reset the hot path sync load counter (for automated tests) */
+	UFUNCTION(BlueprintCallable, Category = "Equipment|Preload")
+	void ResetHotPathSyncLoadCount() { HotPathSyncLoadCount = 0; }
+
+	/** Are all preloaded assets for the given slot resident? (None = unarmed montages) */
+	UFUNCTION(BlueprintCallable, Category = "Equipment|Preload")
+	bool IsSlotPreloaded(EEquipmentSlot Slot) const;
+
 protected:
 	/** Equipment slots - maps slot type to equipped item ID */
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Equipment")
@@ -659,4 +692,28 @@ protected:
 
 	/** Execute a buffered input */
 	void ExecuteBufferedInput(EBufferedInputType InputType);
+
+	// ==================== Asset Preloading ====================
+
+	/** Pinned async load handles per slot - keeps equipped montages/sounds/meshes resident.
+	 * EEquipmentSlot::None holds the unarmed montages. */
+	TMap<EEquipmentSlot, TSharedPtr<FStreamableHandle>> PreloadHandles;
+
+	/** Sync loads that happened on a combat hot path */
+	int32 HotPathSyncLoadCount = 0;
+
+	/** Start an async load of every montage, sound and mesh referenced by the item (replaces any existing handle for the slot) */
+	void RequestSlotPreload(EEquipmentSlot Slot, const FItemData& ItemData);
+
+	/** Start an async load of the unarmed combat montages */
+	void RequestUnarmedPreload();
+
+	/** Release the pinned handle for a slot */
+	void ReleaseSlotPreload(EEquipmentSlot Slot);
+
+	/** Resolve a soft montage on a combat hot path - uses the resident asset, falls back to a counted sync load */
+	UAnimMontage* ResolveHotPathMontage(const TSoftObjectPtr<UAnimMontage>& Montage);
+
+	/** Resolve a soft sound on a combat hot path - uses the resident asset, falls back to a counted sync load */
+	USoundBase* ResolveHotPathSound(const TSoftObjectPtr<USoundBase>& Sound);
 };
@@ -2,6 +2,8 @@
 
 #include "FireActor.h"
 #include "HealthComponent.h"
+#include "DamageableRegistry.h"
+#include "WorldStateSubsystem.h"
 #include "Components/BoxComponent.h"
 #include "NiagaraComponent.h"
 #include "Components/AudioComponent.h"
@@ -28,6 +30,22 @@ AFireActor::AFireActor()
 	FireSound->bAutoActivate = true;
 }
 
+void AFireActor::OnConstruction(const FTransform& Transform)
+{
+	Super::OnConstruction(Transform);
+
+	UWorldStateSubsystem::AssignEditorGuid(this, WorldStateGuid);
+}
+
+#if WITH_EDITOR
+void AFireActor::PostEditImport()
+{
+	Super::PostEditImport();
+
+	UWorldStateSubsystem::RegenerateImportedGuid(WorldStateGuid);
+}
+#endif
+
 void AFireActor::BeginPlay()
 {
 	Super::BeginPlay();
@@ -38,6 +56,9 @@ void AFireActor::BeginPlay()
 
 	// Set initial state
 	SetFireActive(bIsActive);
+
+	// Restore saved state
+	UWorldStateSubsystem::ResolveAndRegister(this, WorldStateGuid);
 }
 
 void AFireActor::Tick(float DeltaTime)
@@ -62,8 +83,14 @@ void AFireActor::Tick(float DeltaTime)
 
 void AFireActor::SetFireActive(bool bActive)
 {
+	const bool bChanged = bIsActive != bActive;
 	bIsActive = bActive;
 
+	if (bChanged && HasActorBegunPlay())
+	{
+		UWorldStateSubsystem::NotifyStateChanged(this);
+	}
+
 	if (FireEffect)
 	{
 		if (bActive)
@@ -101,7 +128,7 @@ void AFireActor::OnOverlapBegin(UPrimitiveComponent* OverlappedComponent, AActor
 	if (OtherActor && OtherActor != this)
 	{
 		// Only track actors with health components
-		if (OtherActor->FindComponentByClass<UHealthComponent>())
+		if (UDamageableRegistry::GetHealthComponent(OtherActor))
 		{
 			ActorsInFire.AddUnique(OtherActor);
 		}
@@ -130,7 +157,7 @@ void AFireActor::ApplyDamageToOverlappingActors()
 			continue;
 		}
 
-		UHealthComponent* HealthComp = Actor->FindComponentByClass<UHealthComponent>();
+		UHealthComponent* HealthComp = UDamageableRegistry::GetHealthComponent(Actor);
 		if (HealthComp && !HealthComp->IsDead())
 		{
 			// Apply fire damage
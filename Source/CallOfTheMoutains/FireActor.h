@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "WorldStateInterface.h"
 #include "FireActor.generated.h"
 
 class UBoxComponent;
@@ -11,13 +12,23 @@ class UNiagaraComponent;
 class UAudioComponent;
 
 UCLASS()
-class CALLOFTHEMOUTAINS_API AFireActor : public AActor
+class CALLOFTHEMOUTAINS_API AFireActor : public AActor, public IWorldStateInterface
 {
 	GENERATED_BODY()
 
 public:
 	AFireActor();
 
+	virtual void OnConstruction(const FTransform& Transform) override;
+#if WITH_EDITOR
+	virtual void PostEditImport() override;
+#endif
+
+	// World State (active/extinguished persists in save games)
+	virtual FGuid GetWorldStateGuid() const override { return WorldStateGuid; }
+	virtual uint32 CaptureWorldState() const override { return bIsActive ? 1 : 0; }
+	virtual void RestoreWorldState(uint32 State) override { SetFireActive((State & 1) != 0); }
+
 protected:
 	virtual void BeginPlay() override;
 
@@ -34,6 +45,10 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fire|Damage")
 	bool bIsActive = true;
 
+	// Save game id (assigned when placed in the editor)
+	UPROPERTY(VisibleAnywhere, Category = "Fire|WorldState", AdvancedDisplay)
+	FGuid WorldStateGuid;
+
 	// Functions
 	UFUNCTION(BlueprintCallable, Category = "Fire")
 	void SetFireActive(bool bActive);
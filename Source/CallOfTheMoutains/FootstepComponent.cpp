@@ -1,13 +1,20 @@
 // CallOfTheMoutains - Footstep Component with Physical Surface Detection
 
 #include "FootstepComponent.h"
+#include "FootstepSurfaceCache.h"
 #include "GameFramework/Character.h"
+#include "Components/SkeletalMeshComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Kismet/GameplayStatics.h"
 #include "DrawDebugHelpers.h"
 #include "Sound/SoundBase.h"
 #include "PhysicalMaterials/PhysicalMaterial.h"
 #include "Engine/Engine.h"
+#include "GameFramework/PlayerController.h"
+#include "CallOfTheMoutains.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Footsteps Played"), STAT_FootstepsPlayed, STATGROUP_CallOfTheMoutains);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Footsteps Out Of Range"), STAT_FootstepsOutOfRange, STATGROUP_CallOfTheMoutains);
 
 UFootstepComponent::UFootstepComponent()
 {
@@ -29,6 +36,15 @@ void UFootstepComponent::BeginPlay()
 	{
 		LastFootstepLocation = GetOwner()->GetActorLocation();
 	}
+
+	// Animations that place their own footsteps never need the distance tick
+	if (bNotifiesReplaceAutoFootsteps && (bExpectFootstepNotifies || IsOwnerAnimKnownNotifyDriven()))
+	{
+		SetNotifyDriven();
+	}
+
+	// The tick only drives auto footsteps
+	SetComponentTickEnabled(bAutoFootsteps);
 }
 
 void UFootstepComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
@@ -47,6 +63,13 @@ void UFootstepComponent::TickComponent(float DeltaTime, ELevelTick TickType, FAc
 		return;
 	}
 
+	// Far from the listener, keep counting distance at a coarser interval
+	const float DesiredInterval = IsWithinAudibleRange(GetOwner()->GetActorLocation()) ? 0.0f : OutOfRangeTickInterval;
+	if (GetComponentTickInterval() != DesiredInterval)
+	{
+		SetComponentTickInterval(DesiredInterval);
+	}
+
 	// Only play footsteps when on ground and moving
 	if (!MovementComponent->IsMovingOnGround())
 	{
@@ -125,8 +148,15 @@ void UFootstepComponent::PlayFootstep(FVector FootLocation, bool bIsRightFoot)
 		FootLocation = GetOwner()->GetActorLocation();
 	}
 
-	// Get surface type directly from trace
-	CurrentSurface = TraceSurface(FootLocation);
+	// Nobody would hear it - skip the surface lookup too
+	if (!IsWithinAudibleRange(FootLocation))
+	{
+		INC_DWORD_STAT(STAT_FootstepsOutOfRange);
+		return;
+	}
+
+	// Get surface type (cache, floor result or trace)
+	CurrentSurface = ResolveSurface(FootLocation);
 
 	// Find appropriate sound set
 	const FFootstepSoundSet* SoundSet = SurfaceSounds.Find(CurrentSurface);
@@ -156,6 +186,7 @@ void UFootstepComponent::PlayFootstep(FVector FootLocation, bool bIsRightFoot)
 	float Pitch = CalculatePitch(*SoundSet);
 
 	// Play sound at foot location
+	INC_DWORD_STAT(STAT_FootstepsPlayed);
 	UGameplayStatics::PlaySoundAtLocation(
 		this,
 		Sound,
@@ -168,7 +199,13 @@ void UFootstepComponent::PlayFootstep(FVector FootLocation, bool bIsRightFoot)
 void UFootstepComponent::PlayLandingSound(float ImpactVelocity)
 {
 	FVector Location = GetOwner()->GetActorLocation();
-	CurrentSurface = TraceSurface(Location);
+	if (!IsWithinAudibleRange(Location))
+	{
+		INC_DWORD_STAT(STAT_FootstepsOutOfRange);
+		return;
+	}
+
+	CurrentSurface = ResolveSurface(Location);
 
 	// Find appropriate sound set
 	const FFootstepSoundSet* SoundSet = SurfaceSounds.Find(CurrentSurface);
@@ -211,22 +248,117 @@ void UFootstepComponent::PlayLandingSound(float ImpactVelocity)
 	);
 }
 
+void UFootstepComponent::OnFootstepNotify(const FVector& FootLocation, bool bIsRightFoot, const UClass* AnimClass)
+{
+	UFootstepSurfaceCache* SurfaceCache = AnimClass ? UFootstepSurfaceCache::Get(this) : nullptr;
+	if (SurfaceCache)
+	{
+		SurfaceCache->MarkNotifyDrivenAnimClass(AnimClass);
+	}
+
+	// The animation knows when feet plant - stop guessing from distance
+	if (!bNotifyDriven && bNotifiesReplaceAutoFootsteps)
+	{
+		SetNotifyDriven();
+	}
+
+	PlayFootstep(FootLocation, bIsRightFoot);
+}
+
+void UFootstepComponent::SetNotifyDriven()
+{
+	bNotifyDriven = true;
+	bAutoFootsteps = false;
+	SetComponentTickEnabled(false);
+
+	DistanceTraveled = 0.0f;
+	bIsMoving = false;
+	bWasMoving = false;
+}
+
+bool UFootstepComponent::IsOwnerAnimKnownNotifyDriven() const
+{
+	const ACharacter* Character = Cast<ACharacter>(GetOwner());
+	const USkeletalMeshComponent* Mesh = Character ? Character->GetMesh() : nullptr;
+	const UClass* AnimClass = Mesh ? Mesh->GetAnimClass() : nullptr;
+	const UFootstepSurfaceCache* SurfaceCache = AnimClass ? UFootstepSurfaceCache::Get(this) : nullptr;
+	return SurfaceCache && SurfaceCache->IsNotifyDrivenAnimClass(AnimClass);
+}
+
+bool UFootstepComponent::IsWithinAudibleRange(FVector Location) const
+{
+	if (AudibleRange <= 0.0f)
+	{
+		return true;
+	}
+
+	const APawn* Pawn = Cast<APawn>(GetOwner());
+	if (Pawn && Pawn->IsLocallyControlled() && Pawn->IsPlayerControlled())
+	{
+		return true;
+	}
+
+	const APlayerController* PlayerController = UGameplayStatics::GetPlayerController(this, 0);
+	if (!PlayerController)
+	{
+		return true;
+	}
+
+	FVector ListenerLocation, ListenerFront, ListenerRight;
+	PlayerController->GetAudioListenerPosition(ListenerLocation, ListenerFront, ListenerRight);
+	return FVector::DistSquared(Location, ListenerLocation) <= FMath::Square(AudibleRange);
+}
+
 EPhysicalSurface UFootstepComponent::GetSurfaceAtLocation(FVector Location)
 {
-	return TraceSurface(Location);
+	return ResolveSurface(Location);
+}
+
+EPhysicalSurface UFootstepComponent::ResolveSurface(FVector StartLocation)
+{
+	UFootstepSurfaceCache* SurfaceCache = bUseSurfaceCache ? UFootstepSurfaceCache::Get(this) : nullptr;
+	if (!SurfaceCache)
+	{
+		FHitResult HitResult;
+		return TraceSurface(StartLocation, HitResult) ? UFootstepSurfaceCache::GetHitSurface(HitResult) : SurfaceType_Default;
+	}
+
+	return SurfaceCache->Resolve(StartLocation, GetFreshFloorHit(StartLocation),
+		[this, &StartLocation](FHitResult& OutHit) { return TraceSurface(StartLocation, OutHit); });
+}
+
+const FHitResult* UFootstepComponent::GetFreshFloorHit(const FVector& Location) const
+{
+	// CurrentFloor is recomputed every movement update while walking - stale once airborne
+	if (!MovementComponent || !MovementComponent->IsMovingOnGround())
+	{
+		return nullptr;
+	}
+
+	const FFindFloorResult& Floor = MovementComponent->CurrentFloor;
+	if (!Floor.bBlockingHit || !Floor.HitResult.GetComponent())
+	{
+		return nullptr;
+	}
+
+	if (FVector::DistSquared2D(Floor.HitResult.ImpactPoint, Location) > FMath::Square(FloorReuseRadius))
+	{
+		return nullptr;
+	}
+
+	return &Floor.HitResult;
 }
 
-EPhysicalSurface UFootstepComponent::TraceSurface(FVector StartLocation)
+bool UFootstepComponent::TraceSurface(FVector StartLocation, FHitResult& OutHit)
 {
 	FVector EndLocation = StartLocation - FVector(0.0f, 0.0f, TraceDistance);
 
-	FHitResult HitResult;
 	FCollisionQueryParams QueryParams;
 	QueryParams.AddIgnoredActor(GetOwner());
 	QueryParams.bReturnPhysicalMaterial = true;
 
 	bool bHit = GetWorld()->LineTraceSingleByChannel(
-		HitResult,
+		OutHit,
 		StartLocation,
 		EndLocation,
 		ECC_Visibility,
@@ -248,16 +380,11 @@ EPhysicalSurface UFootstepComponent::TraceSurface(FVector StartLocation)
 
 		if (bHit)
 		{
-			DrawDebugSphere(GetWorld(), HitResult.ImpactPoint, 10.0f, 8, FColor::Yellow, false, 1.0f);
+			DrawDebugSphere(GetWorld(), OutHit.ImpactPoint, 10.0f, 8, FColor::Yellow, false, 1.0f);
 		}
 	}
 
-	if (bHit && HitResult.PhysMaterial.IsValid())
-	{
-		return HitResult.PhysMaterial->SurfaceType;
-	}
-
-	return SurfaceType_Default;
+	return bHit;
 }
 
 USoundBase* UFootstepComponent::GetRandomSound(const FFootstepSoundSet& SoundSet, bool bIsRightFoot)
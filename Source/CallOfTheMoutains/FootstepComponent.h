@@ -44,7 +44,12 @@ struct FFootstepSoundSet
  * Footstep Component - Plays surface-appropriate footstep sounds
  * Attach to any character (player, NPC, AI) and either:
  * - Enable bAutoFootsteps for distance-based footsteps (no anim notify needed)
- * - Call PlayFootstep from animation notifies for precise foot sync
+ * - Place UAnimNotify_Footstep on locomotion animations for steps at the foot bone, in sync
+ *   with the animation. The first notify turns the auto footstep tick off. Components with
+ *   bExpectFootstepNotifies, or whose owner's anim class played notifies before, start with it off.
+ *
+ * Characters other than the local player skip the surface lookup and sound entirely
+ * beyond AudibleRange from the listener.
  *
  * Uses EPhysicalSurface directly from Project Settings > Physics > Physical Surface
  */
@@ -63,7 +68,7 @@ protected:
 public:
 	// ==================== Auto Footstep Settings ====================
 
-	/** Enable automatic footstep sounds based on movement (no animation notify needed) */
+	/** Enable automatic footstep sounds based on movement (no animation notify needed). Read at BeginPlay - without it the component doesn't tick */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Footstep|Auto")
 	bool bAutoFootsteps = true;
 
@@ -79,6 +84,38 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Footstep|Auto", meta = (ClampMin = "20.0", ClampMax = "150.0", EditCondition = "bAutoFootsteps"))
 	float CrouchStepDistance = 80.0f;
 
+	// ==================== Anim Notify Settings ====================
+
+	/** Turn auto footsteps (and the tick) off once an anim notify plays a footstep */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Footstep|Notify")
+	bool bNotifiesReplaceAutoFootsteps = true;
+
+	/**
+	 * The owner's locomotion animations carry footstep notifies - start with auto footsteps and the
+	 * tick off. Anim classes seen playing footstep notifies are remembered, so later spawns of them
+	 * start that way without this.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Footstep|Notify", meta = (EditCondition = "bNotifiesReplaceAutoFootsteps"))
+	bool bExpectFootstepNotifies = false;
+
+	/** Bone sampled for left foot notifies */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Footstep|Notify")
+	FName LeftFootBone = TEXT("foot_l");
+
+	/** Bone sampled for right foot notifies */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Footstep|Notify")
+	FName RightFootBone = TEXT("foot_r");
+
+	// ==================== Distance LOD ====================
+
+	/** Footsteps further than this from the listener are skipped - no trace, no sound (0 = never skip). The local player is never skipped */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Footstep|LOD", meta = (ClampMin = "0.0"))
+	float AudibleRange = 3000.0f;
+
+	/** Auto footstep tick interval while out of audible range (distance still accumulates, just coarser) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Footstep|LOD", meta = (ClampMin = "0.0", ClampMax = "2.0"))
+	float OutOfRangeTickInterval = 0.5f;
+
 	// ==================== Sound Mappings ====================
 
 	/** Map of physical surface types to footstep sounds (uses Project Settings surfaces) */
@@ -107,6 +144,14 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Footstep|Settings", meta = (ClampMin = "10.0", ClampMax = "500.0"))
 	float TraceDistance = 100.0f;
 
+	/** Reuse surfaces from the shared footstep surface cache and the movement component's floor hit instead of tracing every step */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Footstep|Settings")
+	bool bUseSurfaceCache = true;
+
+	/** Furthest the floor hit may be from the step (horizontally) to stand in for a trace */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Footstep|Settings", meta = (ClampMin = "0.0", ClampMax = "200.0", EditCondition = "bUseSurfaceCache"))
+	float FloorReuseRadius = 60.0f;
+
 	/** Minimum time between footstep sounds (prevents spam) */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Footstep|Settings", meta = (ClampMin = "0.0", ClampMax = "1.0"))
 	float MinTimeBetweenSteps = 0.25f;
@@ -134,6 +179,19 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Footstep")
 	void PlayLandingSound(float ImpactVelocity = 0.0f);
 
+	/**
+	 * Called by UAnimNotify_Footstep with the foot bone's location
+	 * @param AnimClass - Anim class of the mesh that played the notify (remembered for later spawns)
+	 */
+	void OnFootstepNotify(const FVector& FootLocation, bool bIsRightFoot, const UClass* AnimClass = nullptr);
+
+	/** Bone a foot's notifies sample */
+	FName GetFootBone(bool bIsRightFoot) const { return bIsRightFoot ? RightFootBone : LeftFootBone; }
+
+	/** Whether a footstep here could be heard (always true for the local player) */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Footstep")
+	bool IsWithinAudibleRange(FVector Location) const;
+
 	/** Get the physical surface type at a location */
 	UFUNCTION(BlueprintCallable, Category = "Footstep")
 	EPhysicalSurface GetSurfaceAtLocation(FVector Location);
@@ -166,8 +224,23 @@ private:
 	bool bWasMoving = false;
 	bool bNextFootIsRight = true;
 
-	/** Perform surface trace and return the physical surface */
-	EPhysicalSurface TraceSurface(FVector StartLocation);
+	/** Footsteps come from anim notifies - the auto footstep tick is off */
+	bool bNotifyDriven = false;
+
+	/** Switch from auto footsteps to notifies, dropping any distance counted toward the next step */
+	void SetNotifyDriven();
+
+	/** Whether the owner's anim class has played footstep notifies before */
+	bool IsOwnerAnimKnownNotifyDriven() const;
+
+	/** Physical surface under a location - cached or floor result when possible, traced otherwise */
+	EPhysicalSurface ResolveSurface(FVector StartLocation);
+
+	/** The movement component's floor hit if it's current and close to Location */
+	const FHitResult* GetFreshFloorHit(const FVector& Location) const;
+
+	/** Perform surface trace */
+	bool TraceSurface(FVector StartLocation, FHitResult& OutHit);
 
 	/** Get a random sound from a sound set for the specified foot */
 	USoundBase* GetRandomSound(const FFootstepSoundSet& SoundSet, bool bIsRightFoot = true);
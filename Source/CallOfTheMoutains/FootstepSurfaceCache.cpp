@@ -0,0 +1,175 @@
+// CallOfTheMoutains - Footstep Surface Cache Implementation
+
+#include "FootstepSurfaceCache.h"
+#include "CallOfTheMoutains.h"
+#include "Components/StaticMeshComponent.h"
+#include "PhysicalMaterials/PhysicalMaterial.h"
+#include "PhysicsEngine/BodySetup.h"
+#include "Engine/World.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Footstep Surface Lookups"), STAT_FootstepSurfaceLookups, STATGROUP_CallOfTheMoutains);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Footstep Surface Traces"), STAT_FootstepSurfaceTraces, STATGROUP_CallOfTheMoutains);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Footstep Surface Cache Hit %"), STAT_FootstepSurfaceHitRate, STATGROUP_CallOfTheMoutains);
+
+UFootstepSurfaceCache* UFootstepSurfaceCache::Get(const UObject* WorldContextObject)
+{
+	UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UFootstepSurfaceCache>() : nullptr;
+}
+
+void UFootstepSurfaceCache::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddUObject(this, &UFootstepSurfaceCache::OnLevelChanged);
+	LevelRemovedHandle = FWorldDelegates::LevelRemovedFromWorld.AddUObject(this, &UFootstepSurfaceCache::OnLevelChanged);
+}
+
+void UFootstepSurfaceCache::Deinitialize()
+{
+	FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+	FWorldDelegates::LevelRemovedFromWorld.Remove(LevelRemovedHandle);
+	Invalidate();
+
+	Super::Deinitialize();
+}
+
+bool UFootstepSurfaceCache::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+// ==================== Lookup ====================
+
+EPhysicalSurface UFootstepSurfaceCache::Resolve(const FVector& TraceStart, const FHitResult* FreshFloor, TFunctionRef<bool(FHitResult&)> Trace)
+{
+	// The movement component already found the ground - use it if it has the material
+	if (FreshFloor && FreshFloor->PhysMaterial.IsValid())
+	{
+		CountLookup(false);
+		return FreshFloor->PhysMaterial->SurfaceType;
+	}
+
+	FFaceKey FaceKey;
+	const bool bHasFaceKey = FreshFloor && MakeFaceKey(*FreshFloor, FaceKey);
+	if (bHasFaceKey)
+	{
+		if (const TEnumAsByte<EPhysicalSurface>* Surface = FaceSurfaces.Find(FaceKey))
+		{
+			CountLookup(false);
+			return *Surface;
+		}
+	}
+
+	const FIntVector Cell = ToCell(TraceStart);
+	if (const TEnumAsByte<EPhysicalSurface>* Surface = CellSurfaces.Find(Cell))
+	{
+		CountLookup(false);
+		return *Surface;
+	}
+
+	FHitResult Hit;
+	const bool bHit = Trace(Hit);
+	CountLookup(true);
+
+	if (!bHit)
+	{
+		// Nothing under the foot isn't worth remembering
+		return SurfaceType_Default;
+	}
+
+	const EPhysicalSurface Surface = GetHitSurface(Hit);
+	UPrimitiveComponent* HitComponent = Hit.GetComponent();
+
+	// The trace starts at the foot, not where the floor sweep touched - only a hit on the same
+	// face (or anywhere on a single-surface body) belongs under the floor's key
+	if (bHasFaceKey && HitComponent == FreshFloor->GetComponent() && Hit.FaceIndex == FreshFloor->FaceIndex)
+	{
+		if (FaceSurfaces.Num() >= MaxEntries)
+		{
+			FaceSurfaces.Reset();
+		}
+		FaceSurfaces.Add(FaceKey, Surface);
+	}
+
+	// Only static geometry stays where the cell says it is
+	if (HitComponent && HitComponent->Mobility == EComponentMobility::Static)
+	{
+		if (CellSurfaces.Num() >= MaxEntries)
+		{
+			CellSurfaces.Reset();
+		}
+		CellSurfaces.Add(Cell, Surface);
+	}
+
+	return Surface;
+}
+
+void UFootstepSurfaceCache::Invalidate()
+{
+	FaceSurfaces.Reset();
+	CellSurfaces.Reset();
+}
+
+EPhysicalSurface UFootstepSurfaceCache::GetHitSurface(const FHitResult& Hit)
+{
+	return Hit.PhysMaterial.IsValid() ? Hit.PhysMaterial->SurfaceType.GetValue() : SurfaceType_Default;
+}
+
+bool UFootstepSurfaceCache::MakeFaceKey(const FHitResult& Hit, FFaceKey& OutKey)
+{
+	UPrimitiveComponent* Component = Hit.GetComponent();
+	if (!Component)
+	{
+		return false;
+	}
+
+	if (Hit.FaceIndex != INDEX_NONE)
+	{
+		OutKey = FFaceKey(Component, Hit.FaceIndex);
+		return true;
+	}
+
+	// Without a face, only simple collision is safe: one physical material for the whole body.
+	// Complex collision and landscapes change surface per face.
+	const UStaticMeshComponent* Mesh = Cast<UStaticMeshComponent>(Component);
+	const UBodySetup* BodySetup = Mesh ? Mesh->GetBodySetup() : nullptr;
+	if (!BodySetup || BodySetup->GetCollisionTraceFlag() == CTF_UseComplexAsSimple)
+	{
+		return false;
+	}
+
+	OutKey = FFaceKey(Component, INDEX_NONE);
+	return true;
+}
+
+FIntVector UFootstepSurfaceCache::ToCell(const FVector& Location) const
+{
+	const float Size = FMath::Max(CellSize, 1.0f);
+	return FIntVector(
+		FMath::FloorToInt(Location.X / Size),
+		FMath::FloorToInt(Location.Y / Size),
+		FMath::FloorToInt(Location.Z / Size));
+}
+
+void UFootstepSurfaceCache::CountLookup(bool bTraced)
+{
+	++Lookups;
+	INC_DWORD_STAT(STAT_FootstepSurfaceLookups);
+
+	if (bTraced)
+	{
+		++Traces;
+		INC_DWORD_STAT(STAT_FootstepSurfaceTraces);
+	}
+
+	SET_FLOAT_STAT(STAT_FootstepSurfaceHitRate, GetHitRate() * 100.0f);
+}
+
+void UFootstepSurfaceCache::OnLevelChanged(ULevel* Level, UWorld* World)
+{
+	if (World == GetWorld())
+	{
+		Invalidate();
+	}
+}
@@ -0,0 +1,92 @@
+// CallOfTheMoutains - Footstep Surface Cache
+// Shared physical surface lookups for footsteps, so most steps need no trace
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Chaos/ChaosEngineInterface.h"
+#include "UObject/ObjectKey.h"
+#include "FootstepSurfaceCache.generated.h"
+
+class UPrimitiveComponent;
+
+/**
+ * Footstep Surface Cache
+ * Every UFootstepComponent in the world shares it. A footstep's surface is taken from, in order:
+ * - the movement component's floor hit, when it carries a physical material
+ * - the floor's component + face index (component alone for simple collision, whose surface
+ *   is the same everywhere)
+ * - the quantized trace start, for static geometry only
+ * and only traced when all of them miss. Streaming a level in or out clears everything.
+ *
+ * It also remembers which anim classes have placed footsteps with notifies, so components
+ * spawned later with the same animation start notify-driven. That set lives as long as the world.
+ */
+UCLASS()
+class CALLOFTHEMOUTAINS_API UFootstepSurfaceCache : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Get the cache for a world context (nullptr if unavailable) */
+	static UFootstepSurfaceCache* Get(const UObject* WorldContextObject);
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	/**
+	 * Surface under a footstep
+	 * @param TraceStart - Where the footstep trace starts (foot or actor location)
+	 * @param FreshFloor - The owner's current floor hit, if valid this frame and near TraceStart
+	 * @param Trace - Runs the surface trace on a miss; returns whether it hit
+	 */
+	EPhysicalSurface Resolve(const FVector& TraceStart, const FHitResult* FreshFloor, TFunctionRef<bool(FHitResult&)> Trace);
+
+	/** Drop every cached surface */
+	void Invalidate();
+
+	/** Share of lookups answered without a trace (0-1) */
+	float GetHitRate() const { return Lookups > 0 ? static_cast<float>(Lookups - Traces) / Lookups : 0.0f; }
+
+	/** Cell size of position entries (cm) */
+	float CellSize = 50.0f;
+
+	/** Entries per map before it's cleared */
+	int32 MaxEntries = 8192;
+
+	/** Physical surface of a hit (SurfaceType_Default without a material) */
+	static EPhysicalSurface GetHitSurface(const FHitResult& Hit);
+
+	/** Record that an anim class places footsteps with notifies */
+	void MarkNotifyDrivenAnimClass(const UClass* AnimClass) { NotifyDrivenAnimClasses.Add(AnimClass); }
+
+	/** Whether an anim class has been seen placing footsteps with notifies in this world */
+	bool IsNotifyDrivenAnimClass(const UClass* AnimClass) const { return NotifyDrivenAnimClasses.Contains(AnimClass); }
+
+private:
+	/** Component + face index (INDEX_NONE for components with one surface) */
+	using FFaceKey = TPair<TObjectKey<UPrimitiveComponent>, int32>;
+
+	TMap<FFaceKey, TEnumAsByte<EPhysicalSurface>> FaceSurfaces;
+	TMap<FIntVector, TEnumAsByte<EPhysicalSurface>> CellSurfaces;
+
+	int64 Lookups = 0;
+	int64 Traces = 0;
+
+	/** Mesh anim classes that have played footstep notifies (not cleared by Invalidate) */
+	TSet<TObjectKey<UClass>> NotifyDrivenAnimClasses;
+
+	FDelegateHandle LevelAddedHandle;
+	FDelegateHandle LevelRemovedHandle;
+
+	/** Face key of a floor hit, if its surface can be cached by component */
+	static bool MakeFaceKey(const FHitResult& Hit, FFaceKey& OutKey);
+
+	FIntVector ToCell(const FVector& Location) const;
+
+	void CountLookup(bool bTraced);
+
+	void OnLevelChanged(ULevel* Level, UWorld* World);
+};
@@ -2,9 +2,11 @@
 
 #include "ForgottenCharacter.h"
 #include "HealthComponent.h"
+#include "WorldStateSubsystem.h"
 #include "FootstepComponent.h"
 #include "MeleeTraceComponent.h"
 #include "TargetableComponent.h"
+#include "AttributeModifierComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Components/CapsuleComponent.h"
 #include "Kismet/GameplayStatics.h"
@@ -38,10 +40,13 @@ AForgottenCharacter::AForgottenCharacter()
 	TargetableComponent = CreateDefaultSubobject<UTargetableComponent>(TEXT("TargetableComponent"));
 	TargetableComponent->TargetOffset = FVector(0.0f, 0.0f, 60.0f); // Chest height
 
+	// Create attribute modifier stack - state speeds below are its base walk speed
+	AttributeModifiers = CreateDefaultSubobject<UAttributeModifierComponent>(TEXT("AttributeModifiers"));
+
 	// Configure movement for slow zombie
+	AttributeModifiers->SetBaseWalkSpeed(PatrolSpeed);
 	if (UCharacterMovementComponent* Movement = GetCharacterMovement())
 	{
-		Movement->MaxWalkSpeed = PatrolSpeed;
 		Movement->bOrientRotationToMovement = true;
 		Movement->RotationRate = FRotator(0.0f, 180.0f, 0.0f);
 	}
@@ -52,6 +57,22 @@ AForgottenCharacter::AForgottenCharacter()
 	bUseControllerRotationRoll = false;
 }
 
+void AForgottenCharacter::OnConstruction(const FTransform& Transform)
+{
+	Super::OnConstruction(Transform);
+
+	UWorldStateSubsystem::AssignEditorGuid(this, WorldStateGuid);
+}
+
+#if WITH_EDITOR
+void AForgottenCharacter::PostEditImport()
+{
+	Super::PostEditImport();
+
+	UWorldStateSubsystem::RegenerateImportedGuid(WorldStateGuid);
+}
+#endif
+
 void AForgottenCharacter::BeginPlay()
 {
 	Super::BeginPlay();
@@ -68,6 +89,9 @@ void AForgottenCharacter::BeginPlay()
 
 	// Start in idle state
 	SetState(EForgottenState::Idle);
+
+	// Enemies killed in the saved game stay dead (may destroy this actor)
+	UWorldStateSubsystem::ResolveAndRegister(this, WorldStateGuid);
 }
 
 void AForgottenCharacter::Tick(float DeltaTime)
@@ -326,24 +350,24 @@ void AForgottenCharacter::SetState(EForgottenState NewState)
 	EForgottenState OldState = CurrentState;
 	CurrentState = NewState;
 
-	// Update movement speed based on state
-	if (UCharacterMovementComponent* Movement = GetCharacterMovement())
+	// Update movement speed based on state (modifier layers apply on top)
+	if (AttributeModifiers)
 	{
 		switch (NewState)
 		{
 		case EForgottenState::Idle:
 		case EForgottenState::Patrolling:
-			Movement->MaxWalkSpeed = PatrolSpeed;
+			AttributeModifiers->SetBaseWalkSpeed(PatrolSpeed);
 			break;
 
 		case EForgottenState::Chasing:
-			Movement->MaxWalkSpeed = ChaseSpeed;
+			AttributeModifiers->SetBaseWalkSpeed(ChaseSpeed);
 			break;
 
 		case EForgottenState::Attacking:
 		case EForgottenState::Staggered:
 		case EForgottenState::Dead:
-			Movement->MaxWalkSpeed = 0.0f;
+			AttributeModifiers->SetBaseWalkSpeed(0.0f);
 			break;
 		}
 	}
@@ -600,6 +624,17 @@ void AForgottenCharacter::OnDeath(AActor* KilledBy, AController* InstigatorContr
 
 	// Destroy after delay (let death animation play)
 	SetLifeSpan(10.0f);
+
+	UWorldStateSubsystem::NotifyStateChanged(this);
+}
+
+void AForgottenCharacter::RestoreWorldState(uint32 State)
+{
+	// The corpse would have been cleaned up long ago - skip the death sequence entirely
+	if ((State & 1) != 0 && !bIsDead)
+	{
+		Destroy();
+	}
 }
 
 void AForgottenCharacter::PlayAmbientSound()
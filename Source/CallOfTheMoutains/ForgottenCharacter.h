@@ -5,12 +5,14 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Character.h"
+#include "WorldStateInterface.h"
 #include "ForgottenCharacter.generated.h"
 
 class UHealthComponent;
 class UFootstepComponent;
 class UMeleeTraceComponent;
 class UTargetableComponent;
+class UAttributeModifierComponent;
 class UAnimMontage;
 class USoundBase;
 
@@ -29,9 +31,10 @@ enum class EForgottenState : uint8
 /**
  * The Forgotten - Basic zombie enemy
  * Slow-moving, pursues player on sight/sound, attacks in melee range
+ * Stays dead across save/load when placed in a level
  */
 UCLASS()
-class CALLOFTHEMOUTAINS_API AForgottenCharacter : public ACharacter
+class CALLOFTHEMOUTAINS_API AForgottenCharacter : public ACharacter, public IWorldStateInterface
 {
 	GENERATED_BODY()
 
@@ -44,6 +47,21 @@ protected:
 public:
 	virtual void Tick(float DeltaTime) override;
 
+	virtual void OnConstruction(const FTransform& Transform) override;
+#if WITH_EDITOR
+	virtual void PostEditImport() override;
+#endif
+
+	// ==================== World State ====================
+
+	/** Save game id (assigned when placed in the editor; spawned enemies aren't persisted) */
+	UPROPERTY(VisibleAnywhere, Category = "WorldState", AdvancedDisplay)
+	FGuid WorldStateGuid;
+
+	virtual FGuid GetWorldStateGuid() const override { return WorldStateGuid; }
+	virtual uint32 CaptureWorldState() const override { return bIsDead ? 1 : 0; }
+	virtual void RestoreWorldState(uint32 State) override;
+
 	// ==================== Components ====================
 
 	/** Health component for damage/death */
@@ -62,6 +80,10 @@ public:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
 	UTargetableComponent* TargetableComponent;
 
+	/** Modifier layers (weather, debuffs) applied on top of the state's walk speed */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
+	UAttributeModifierComponent* AttributeModifiers;
+
 	// ==================== Movement Settings ====================
 
 	/** Normal patrol/idle movement speed */
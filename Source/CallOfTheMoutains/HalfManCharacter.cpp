@@ -2,6 +2,7 @@
 
 #include "HalfManCharacter.h"
 #include "HealthComponent.h"
+#include "WorldStateSubsystem.h"
 #include "FootstepComponent.h"
 #include "MeleeTraceComponent.h"
 #include "TargetableComponent.h"
@@ -41,6 +42,22 @@ AHalfManCharacter::AHalfManCharacter()
 	WakeTriggerSphere->SetGenerateOverlapEvents(true);
 }
 
+void AHalfManCharacter::OnConstruction(const FTransform& Transform)
+{
+	Super::OnConstruction(Transform);
+
+	UWorldStateSubsystem::AssignEditorGuid(this, WorldStateGuid);
+}
+
+#if WITH_EDITOR
+void AHalfManCharacter::PostEditImport()
+{
+	Super::PostEditImport();
+
+	UWorldStateSubsystem::RegenerateImportedGuid(WorldStateGuid);
+}
+#endif
+
 void AHalfManCharacter::BeginPlay()
 {
 	Super::BeginPlay();
@@ -73,6 +90,9 @@ void AHalfManCharacter::BeginPlay()
 
 	// Start in fake dead state
 	SetState(EHalfManState::FakeDead);
+
+	// Enemies killed in the saved game stay dead (may destroy this actor)
+	UWorldStateSubsystem::ResolveAndRegister(this, WorldStateGuid);
 }
 
 void AHalfManCharacter::Tick(float DeltaTime)
@@ -695,6 +715,16 @@ void AHalfManCharacter::OnHealthChanged(float CurrentHealth, float MaxHealth, fl
 void AHalfManCharacter::OnDeath(AActor* KilledBy, AController* InstigatorController)
 {
 	SetState(EHalfManState::Dead);
+	UWorldStateSubsystem::NotifyStateChanged(this);
+}
+
+void AHalfManCharacter::RestoreWorldState(uint32 State)
+{
+	// The corpse would have been cleaned up long ago - skip the death sequence entirely
+	if ((State & 1) != 0 && !bIsDead)
+	{
+		Destroy();
+	}
 }
 
 // ==================== Wake Trigger ====================
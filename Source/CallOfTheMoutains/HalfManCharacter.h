@@ -5,6 +5,7 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Character.h"
+#include "WorldStateInterface.h"
 #include "HalfManCharacter.generated.h"
 
 class UHealthComponent;
@@ -42,9 +43,10 @@ enum class EHalfManState : uint8
  * - Proximity-triggered awakening with dramatic gore effects
  * - Both melee and ranged (bile) attacks
  * - Leaves blood/gore trail while moving
+ * - Stays dead across save/load when placed in a level
  */
 UCLASS()
-class CALLOFTHEMOUTAINS_API AHalfManCharacter : public ACharacter
+class CALLOFTHEMOUTAINS_API AHalfManCharacter : public ACharacter, public IWorldStateInterface
 {
 	GENERATED_BODY()
 
@@ -57,6 +59,21 @@ protected:
 public:
 	virtual void Tick(float DeltaTime) override;
 
+	virtual void OnConstruction(const FTransform& Transform) override;
+#if WITH_EDITOR
+	virtual void PostEditImport() override;
+#endif
+
+	// ==================== World State ====================
+
+	/** Save game id (assigned when placed in the editor; spawned enemies aren't persisted) */
+	UPROPERTY(VisibleAnywhere, Category = "WorldState", AdvancedDisplay)
+	FGuid WorldStateGuid;
+
+	virtual FGuid GetWorldStateGuid() const override { return WorldStateGuid; }
+	virtual uint32 CaptureWorldState() const override { return bIsDead ? 1 : 0; }
+	virtual void RestoreWorldState(uint32 State) override;
+
 	// ==================== Components ====================
 
 	/** Health management component */
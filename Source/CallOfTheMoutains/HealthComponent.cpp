@@ -3,6 +3,8 @@
 #include "HealthComponent.h"
 #include "FloatingHealthBar.h"
 #include "TargetableComponent.h"
+#include "DamageableRegistry.h"
+#include "AttributeModifierComponent.h"
 #include "GameFramework/Actor.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/CharacterMovementComponent.h"
@@ -43,6 +45,19 @@ void UHealthComponent::BeginPlay()
 		CurrentStamina = MaxStamina;
 	}
 
+	// Only looked up - modifier sources create the stack when they first need it, and a stack
+	// created later hands itself over on registration (SetAttributeModifiers)
+	if (!AttributeModifiers && GetOwner())
+	{
+		AttributeModifiers = GetOwner()->FindComponentByClass<UAttributeModifierComponent>();
+	}
+
+	// Publish owner so damage paths can resolve our components in O(1)
+	if (UDamageableRegistry* Registry = UDamageableRegistry::Get(this))
+	{
+		Registry->RegisterDamageable(this);
+	}
+
 	// Create floating health bar if enabled (but not for bosses)
 	if (bShowFloatingHealthBar && !bIsBoss)
 	{
@@ -64,6 +79,16 @@ void UHealthComponent::BeginPlay()
 	}
 }
 
+void UHealthComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UDamageableRegistry* Registry = UDamageableRegistry::Get(this))
+	{
+		Registry->UnregisterDamageable(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
 float UHealthComponent::TakeDamage(float Damage, AActor* DamageCauser, AController* InstigatorController)
 {
 	// Can't damage if already dead or can't be damaged
@@ -260,7 +285,7 @@ void UHealthComponent::HandleDeath(AActor* Killer, AController* InstigatorContro
 	// Immediately make this target non-targetable to clear any lock-on
 	if (Owner)
 	{
-		if (UTargetableComponent* Targetable = Owner->FindComponentByClass<UTargetableComponent>())
+		if (UTargetableComponent* Targetable = UDamageableRegistry::GetTargetableComponent(Owner))
 		{
 			Targetable->SetTargetable(false);
 		}
@@ -303,7 +328,7 @@ float UHealthComponent::CalculateDamage(float RawDamage) const
 	float DamageAfterDefense = FMath::Max(0.0f, RawDamage - Defense);
 
 	// Apply damage multiplier
-	float FinalDamage = DamageAfterDefense * DamageMultiplier;
+	float FinalDamage = DamageAfterDefense * GetEffectiveDamageMultiplier();
 
 	return FinalDamage;
 }
@@ -399,6 +424,16 @@ void UHealthComponent::StartStaminaRegen()
 	bIsRegeneratingStamina = true;
 }
 
+float UHealthComponent::GetEffectiveStaminaRegenRate() const
+{
+	return AttributeModifiers ? AttributeModifiers->GetModifiedValue(EModifiedAttribute::StaminaRegen, StaminaRegenRate) : StaminaRegenRate;
+}
+
+float UHealthComponent::GetEffectiveDamageMultiplier() const
+{
+	return AttributeModifiers ? AttributeModifiers->GetModifiedValue(EModifiedAttribute::DamageTaken, DamageMultiplier) : DamageMultiplier;
+}
+
 void UHealthComponent::UpdateStaminaRegen(float DeltaTime)
 {
 	if (!bIsRegeneratingStamina || !bStaminaRegenEnabled || bIsDead)
@@ -412,7 +447,7 @@ void UHealthComponent::UpdateStaminaRegen(float DeltaTime)
 		return;
 	}
 
-	float RegenAmount = StaminaRegenRate * DeltaTime;
+	float RegenAmount = GetEffectiveStaminaRegenRate() * DeltaTime;
 	float OldStamina = CurrentStamina;
 	CurrentStamina = FMath::Min(CurrentStamina + RegenAmount, MaxStamina);
 
@@ -9,6 +9,7 @@
 
 class UFloatingHealthBar;
 class UTargetableComponent;
+class UAttributeModifierComponent;
 
 // Delegate declarations
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_FourParams(FOnHealthChanged, float, CurrentHealth, float, MaxHealth, float, Delta, AActor*, DamageCauser);
@@ -31,6 +32,7 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:
 	// ==================== Configuration ====================
@@ -55,7 +57,7 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Health", meta = (ClampMin = "0.0"))
 	float Defense = 0.0f;
 
-	/** Damage multiplier (1.0 = normal, 0.5 = half damage, 2.0 = double damage) */
+	/** Damage multiplier (1.0 = normal, 0.5 = half damage, 2.0 = double damage) - DamageTaken modifier layers apply on top */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Health", meta = (ClampMin = "0.0"))
 	float DamageMultiplier = 1.0f;
 
@@ -69,7 +71,7 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stamina", meta = (ClampMin = "0.0"))
 	float StartingStamina = 0.0f;
 
-	/** Stamina regeneration rate per second */
+	/** Stamina regeneration rate per second - StaminaRegen modifier layers apply on top */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stamina", meta = (ClampMin = "0.0"))
 	float StaminaRegenRate = 20.0f;
 
@@ -265,6 +267,18 @@ public:
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Stamina")
 	float GetStaminaPercent() const;
 
+	/** Stamina regeneration rate after modifier layers */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Stamina")
+	float GetEffectiveStaminaRegenRate() const;
+
+	/** Damage multiplier after modifier layers */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Health")
+	float GetEffectiveDamageMultiplier() const;
+
+	/** Owner's modifier stack (set by UAttributeModifierComponent when it registers) */
+	UAttributeModifierComponent* GetAttributeModifiers() const { return AttributeModifiers; }
+	void SetAttributeModifiers(UAttributeModifierComponent* InModifiers) { AttributeModifiers = InModifiers; }
+
 	/** Is stamina at maximum? */
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Stamina")
 	bool IsFullStamina() const { return CurrentStamina >= MaxStamina; }
@@ -296,6 +310,10 @@ protected:
 	/** Is stamina currently regenerating? */
 	bool bIsRegeneratingStamina = false;
 
+	/** Owner's modifier stack (stamina regen and damage taken layers), if it has one */
+	UPROPERTY(Transient)
+	UAttributeModifierComponent* AttributeModifiers;
+
 	// ==================== Floating Health Bar ====================
 
 	/** The widget component for floating health bar */
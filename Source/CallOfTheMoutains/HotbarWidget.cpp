@@ -191,13 +191,12 @@ void UHotbarWidget::UpdateSlot(EHotbarSlot SlotType)
 
 	if (!Icon || !Icon->IsValid()) return;
 
-	FItemData ItemData;
-	if (GetSlotItemData(SlotType, ItemData))
+	if (const FItemData* ItemData = FindSlotItemData(SlotType))
 	{
 		// Use IsNull() to check if path is set, NOT IsValid() which checks if loaded
-		if (!ItemData.Icon.IsNull())
+		if (!ItemData->Icon.IsNull())
 		{
-			UTexture2D* IconTexture = ItemData.Icon.LoadSynchronous();
+			UTexture2D* IconTexture = ItemData->Icon.LoadSynchronous();
 			if (IconTexture && Brush)
 			{
 				Brush->SetResourceObject(IconTexture);
@@ -279,11 +278,11 @@ void UHotbarWidget::OnHotbarChanged(EHotbarSlot SlotType)
 	UpdateSlot(SlotType);
 }
 
-bool UHotbarWidget::GetSlotItemData(EHotbarSlot SlotType, FItemData& OutItemData) const
+const FItemData* UHotbarWidget::FindSlotItemData(EHotbarSlot SlotType) const
 {
 	if (!EquipmentComponent)
 	{
-		return false;
+		return nullptr;
 	}
 
 	FName ItemID = NAME_None;
@@ -315,9 +314,9 @@ bool UHotbarWidget::GetSlotItemData(EHotbarSlot SlotType, FItemData& OutItemData
 
 	if (ItemID.IsNone())
 	{
-		return false;
+		return nullptr;
 	}
 
 	// Get item data from equipment component (it has access to DataTable)
-	return EquipmentComponent->GetItemData(ItemID, OutItemData);
+	return EquipmentComponent->FindItemData(ItemID);
 }
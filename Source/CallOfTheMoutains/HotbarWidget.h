@@ -83,8 +83,8 @@ private:
 	void GetSlotElements(EHotbarSlot SlotType, TSharedPtr<SBorder>*& OutBorder, TSharedPtr<SImage>*& OutIcon,
 		TSharedPtr<STextBlock>*& OutQuantity, FSlateBrush*& OutBrush);
 
-	/** Get item data for slot */
-	bool GetSlotItemData(EHotbarSlot SlotType, FItemData& OutItemData) const;
+	/** Get item data for slot (nullptr if empty) */
+	const FItemData* FindSlotItemData(EHotbarSlot SlotType) const;
 
 	/** Called when hotbar changes */
 	UFUNCTION()
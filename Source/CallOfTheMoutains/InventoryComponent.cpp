@@ -1,10 +1,39 @@
 // CallOfTheMoutains - Inventory Component Implementation
 
 #include "InventoryComponent.h"
+#include "CallOfTheMoutains.h"
 #include "ItemPickup.h"
+#include "ItemDatabaseSubsystem.h"
 #include "Engine/DataTable.h"
 #include "GameFramework/Actor.h"
 #include "UObject/ConstructorHelpers.h"
+#include "Algo/BinarySearch.h"
+
+DECLARE_CYCLE_STAT(TEXT("Inventory Sort"), STAT_InventorySort, STATGROUP_CallOfTheMoutains);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Inventory Index Rebuilds"), STAT_InventoryIndexRebuilds, STATGROUP_CallOfTheMoutains);
+
+namespace
+{
+	/** Map a float onto a uint32 that orders the same way (handles negatives) */
+	uint32 FloatToSortKey(float Value)
+	{
+		uint32 Bits;
+		FMemory::Memcpy(&Bits, &Value, sizeof(Bits));
+		return (Bits & 0x80000000u) ? ~Bits : (Bits | 0x80000000u);
+	}
+
+	/** Slot sort entry - the whole comparison is one 64-bit key, ties keep slot order */
+	struct FInventorySortEntry
+	{
+		uint64 Key;
+		int32 SlotIndex;
+
+		bool operator<(const FInventorySortEntry& Other) const
+		{
+			return Key != Other.Key ? Key < Other.Key : SlotIndex < Other.SlotIndex;
+		}
+	};
+}
 
 UInventoryComponent::UInventoryComponent()
 {
@@ -20,6 +49,7 @@ void UInventoryComponent::BeginPlay()
 
 	// Initialize inventory slots
 	InventorySlots.SetNum(MaxSlots);
+	RebuildSlotIndex();
 
 	// Load ItemDataTable at runtime if not set
 	if (!ItemDataTable)
@@ -28,17 +58,25 @@ void UInventoryComponent::BeginPlay()
 	}
 
 	// Check DataTable status
-	if (!ItemDataTable)
+	const bool bUseDebugItems = !ItemDataTable && bDebugMode;
+	if (bUseDebugItems)
 	{
-		if (bDebugMode)
-		{
-			CreateDebugDataTable();
-			AddDebugItems();
-		}
-		else
-		{
-			UE_LOG(LogTemp, Warning, TEXT("InventoryComponent: ItemDataTable is not set and could not be loaded. Inventory features may not work correctly."));
-		}
+		CreateDebugDataTable();
+	}
+	else if (!ItemDataTable)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("InventoryComponent: ItemDataTable is not set and could not be loaded. Inventory features may not work correctly."));
+	}
+
+	// Item lookups go through the shared item database
+	if (UItemDatabaseSubsystem* ItemDatabase = UItemDatabaseSubsystem::Get(this))
+	{
+		ItemDatabase->RegisterItemTable(ItemDataTable);
+	}
+
+	if (bUseDebugItems)
+	{
+		AddDebugItems();
 	}
 }
 
@@ -165,11 +203,20 @@ int32 UInventoryComponent::AddItem(FName ItemID, int32 Quantity)
 		return 0;
 	}
 
-	FItemData ItemData;
-	if (!GetItemData(ItemID, ItemData))
+	FItemHotData FallbackHotData;
+	const FItemHotData* ItemDataPtr = FindItemHotData(ItemID);
+	if (!ItemDataPtr)
 	{
-		return 0;
+		// No database (editor utilities, early BeginPlay) - build the hot fields from our own table
+		const FItemData* Row = FindItemData(ItemID);
+		if (!Row)
+		{
+			return 0;
+		}
+		FallbackHotData = FItemHotData(*Row);
+		ItemDataPtr = &FallbackHotData;
 	}
+	const FItemHotData& ItemData = *ItemDataPtr;
 
 	int32 RemainingToAdd = Quantity;
 	int32 TotalAdded = 0;
@@ -179,7 +226,7 @@ int32 UInventoryComponent::AddItem(FName ItemID, int32 Quantity)
 	{
 		while (RemainingToAdd > 0)
 		{
-			int32 StackableSlot = FindStackableSlot(ItemID, ItemData);
+			int32 StackableSlot = FindStackableSlot(ItemID, ItemData.MaxStackSize);
 			if (StackableSlot == INDEX_NONE)
 			{
 				break;
@@ -189,6 +236,7 @@ int32 UInventoryComponent::AddItem(FName ItemID, int32 Quantity)
 			int32 ToAdd = FMath::Min(RemainingToAdd, SpaceInSlot);
 
 			InventorySlots[StackableSlot].Quantity += ToAdd;
+			InventorySlots[StackableSlot].AcquiredOrder = NextAcquiredOrder;
 			RemainingToAdd -= ToAdd;
 			TotalAdded += ToAdd;
 		}
@@ -207,12 +255,15 @@ int32 UInventoryComponent::AddItem(FName ItemID, int32 Quantity)
 
 		InventorySlots[EmptySlot].ItemID = ItemID;
 		InventorySlots[EmptySlot].Quantity = ToAdd;
+		InventorySlots[EmptySlot].AcquiredOrder = NextAcquiredOrder;
+		IndexSlot(EmptySlot);
 		RemainingToAdd -= ToAdd;
 		TotalAdded += ToAdd;
 	}
 
 	if (TotalAdded > 0)
 	{
+		++NextAcquiredOrder;
 		OnItemAdded.Broadcast(ItemID, TotalAdded);
 		OnInventoryChanged.Broadcast();
 	}
@@ -230,21 +281,31 @@ int32 UInventoryComponent::RemoveItem(FName ItemID, int32 Quantity)
 	int32 RemainingToRemove = Quantity;
 	int32 TotalRemoved = 0;
 
-	// Remove from all slots containing this item
-	for (int32 i = 0; i < InventorySlots.Num() && RemainingToRemove > 0; ++i)
+	const TArray<int32, TInlineAllocator<2>>* IndexedSlots = ItemSlotIndex.Find(ItemID);
+	if (!IndexedSlots)
 	{
-		if (InventorySlots[i].ItemID == ItemID)
+		return 0;
+	}
+
+	// Remove from all slots containing this item (copy - emptied slots leave the index)
+	const TArray<int32, TInlineAllocator<2>> ItemSlots = *IndexedSlots;
+	for (int32 i : ItemSlots)
+	{
+		if (RemainingToRemove <= 0)
 		{
-			int32 ToRemove = FMath::Min(RemainingToRemove, InventorySlots[i].Quantity);
+			break;
+		}
 
-			InventorySlots[i].Quantity -= ToRemove;
-			RemainingToRemove -= ToRemove;
-			TotalRemoved += ToRemove;
+		int32 ToRemove = FMath::Min(RemainingToRemove, InventorySlots[i].Quantity);
 
-			if (InventorySlots[i].Quantity <= 0)
-			{
-				InventorySlots[i].Clear();
-			}
+		InventorySlots[i].Quantity -= ToRemove;
+		RemainingToRemove -= ToRemove;
+		TotalRemoved += ToRemove;
+
+		if (InventorySlots[i].Quantity <= 0)
+		{
+			UnindexSlot(i);
+			InventorySlots[i].Clear();
 		}
 	}
 
@@ -271,6 +332,7 @@ bool UInventoryComponent::RemoveItemAtSlot(int32 SlotIndex, int32 Quantity)
 
 	if (InventorySlots[SlotIndex].Quantity <= 0)
 	{
+		UnindexSlot(SlotIndex);
 		InventorySlots[SlotIndex].Clear();
 	}
 
@@ -287,14 +349,16 @@ bool UInventoryComponent::HasItem(FName ItemID, int32 Quantity) const
 
 int32 UInventoryComponent::GetItemCount(FName ItemID) const
 {
-	int32 Total = 0;
+	const TArray<int32, TInlineAllocator<2>>* ItemSlots = ItemSlotIndex.Find(ItemID);
+	if (!ItemSlots)
+	{
+		return 0;
+	}
 
-	for (const FInventorySlot& Slot : InventorySlots)
+	int32 Total = 0;
+	for (int32 i : *ItemSlots)
 	{
-		if (Slot.ItemID == ItemID)
-		{
-			Total += Slot.Quantity;
-		}
+		Total += InventorySlots[i].Quantity;
 	}
 
 	return Total;
@@ -302,14 +366,9 @@ int32 UInventoryComponent::GetItemCount(FName ItemID) const
 
 bool UInventoryComponent::GetItemData(FName ItemID, FItemData& OutItemData) const
 {
-	if (!ItemDataTable || ItemID.IsNone())
-	{
-		return false;
-	}
-
-	FItemData* FoundData = ItemDataTable->FindRow<FItemData>(ItemID, TEXT("GetItemData"));
-	if (FoundData)
+	if (const FItemData* FoundData = FindItemData(ItemID))
 	{
+		UItemDatabaseSubsystem::NotifyItemDataCopied();
 		OutItemData = *FoundData;
 		return true;
 	}
@@ -317,6 +376,16 @@ bool UInventoryComponent::GetItemData(FName ItemID, FItemData& OutItemData) cons
 	return false;
 }
 
+const FItemData* UInventoryComponent::FindItemData(FName ItemID) const
+{
+	return UItemDatabaseSubsystem::FindItem(this, ItemID, ItemDataTable);
+}
+
+const FItemHotData* UInventoryComponent::FindItemHotData(FName ItemID) const
+{
+	return UItemDatabaseSubsystem::FindHotData(this, ItemID);
+}
+
 FInventorySlot UInventoryComponent::GetSlotAtIndex(int32 Index) const
 {
 	if (InventorySlots.IsValidIndex(Index))
@@ -334,8 +403,8 @@ TArray<FInventorySlot> UInventoryComponent::GetSlotsByCategory(EItemCategory Cat
 	{
 		if (!Slot.IsEmpty())
 		{
-			FItemData ItemData;
-			if (GetItemData(Slot.ItemID, ItemData) && ItemData.Category == Category)
+			const FItemHotData* ItemData = FindItemHotData(Slot.ItemID);
+			if (ItemData && ItemData->Category == Category)
 			{
 				Result.Add(Slot);
 			}
@@ -353,8 +422,8 @@ TArray<FInventorySlot> UInventoryComponent::GetSlotsByEquipmentSlot(EEquipmentSl
 	{
 		if (!Slot.IsEmpty())
 		{
-			FItemData ItemData;
-			if (GetItemData(Slot.ItemID, ItemData) && ItemData.EquipmentSlot == EquipSlot)
+			const FItemHotData* ItemData = FindItemHotData(Slot.ItemID);
+			if (ItemData && ItemData->EquipmentSlot == EquipSlot)
 			{
 				Result.Add(Slot);
 			}
@@ -366,20 +435,12 @@ TArray<FInventorySlot> UInventoryComponent::GetSlotsByEquipmentSlot(EEquipmentSl
 
 bool UInventoryComponent::IsFull() const
 {
-	return FindEmptySlot() == INDEX_NONE;
+	return UsedSlotCount >= InventorySlots.Num();
 }
 
 int32 UInventoryComponent::GetUsedSlotCount() const
 {
-	int32 Count = 0;
-	for (const FInventorySlot& Slot : InventorySlots)
-	{
-		if (!Slot.IsEmpty())
-		{
-			++Count;
-		}
-	}
-	return Count;
+	return UsedSlotCount;
 }
 
 bool UInventoryComponent::SwapSlots(int32 IndexA, int32 IndexB)
@@ -389,76 +450,162 @@ bool UInventoryComponent::SwapSlots(int32 IndexA, int32 IndexB)
 		return false;
 	}
 
-	FInventorySlot Temp = InventorySlots[IndexA];
-	InventorySlots[IndexA] = InventorySlots[IndexB];
-	InventorySlots[IndexB] = Temp;
+	if (IndexA == IndexB)
+	{
+		return true;
+	}
+
+	UnindexSlot(IndexA);
+	UnindexSlot(IndexB);
+
+	InventorySlots.Swap(IndexA, IndexB);
+
+	IndexSlot(IndexA);
+	IndexSlot(IndexB);
 
 	OnInventoryChanged.Broadcast();
 	return true;
 }
 
-void UInventoryComponent::SortInventory()
+void UInventoryComponent::SortInventory(EInventorySortMode SortMode)
 {
-	// Sort by category, then by name
-	InventorySlots.Sort([this](const FInventorySlot& A, const FInventorySlot& B)
+	SCOPE_CYCLE_COUNTER(STAT_InventorySort);
+
+	// Build one packed key per slot up front so the sort itself only compares integers:
+	// [mode key 32][category 8][name rank 16][unused 8]. Empty slots get all bits set and go last.
+	TArray<FInventorySortEntry> Entries;
+	Entries.SetNumUninitialized(InventorySlots.Num());
+
+	for (int32 i = 0; i < InventorySlots.Num(); ++i)
 	{
-		// Empty slots go to the end
-		if (A.IsEmpty() && !B.IsEmpty()) return false;
-		if (!A.IsEmpty() && B.IsEmpty()) return true;
-		if (A.IsEmpty() && B.IsEmpty()) return false;
+		const FInventorySlot& Slot = InventorySlots[i];
+		FInventorySortEntry& Entry = Entries[i];
+		Entry.SlotIndex = i;
 
-		FItemData DataA, DataB;
-		GetItemData(A.ItemID, DataA);
-		GetItemData(B.ItemID, DataB);
+		if (Slot.IsEmpty())
+		{
+			Entry.Key = MAX_uint64;
+			continue;
+		}
 
-		// Sort by category first
-		if (DataA.Category != DataB.Category)
+		// Unknown items sort as default data
+		static const FItemHotData UnknownItem;
+		const FItemHotData* Found = FindItemHotData(Slot.ItemID);
+		const FItemHotData& ItemData = Found ? *Found : UnknownItem;
+
+		// Descending modes invert the key
+		uint32 ModeKey = 0;
+		switch (SortMode)
 		{
-			return static_cast<uint8>(DataA.Category) < static_cast<uint8>(DataB.Category);
+		case EInventorySortMode::Weight:
+			ModeKey = ~FloatToSortKey(ItemData.Stats.Weight);
+			break;
+		case EInventorySortMode::Rarity:
+			ModeKey = ~static_cast<uint32>(ItemData.Rarity);
+			break;
+		case EInventorySortMode::Damage:
+			ModeKey = ~FloatToSortKey(ItemData.Stats.PhysicalDamage);
+			break;
+		case EInventorySortMode::Recent:
+			ModeKey = ~static_cast<uint32>(FMath::Max(Slot.AcquiredOrder, 0));
+			break;
+		case EInventorySortMode::Category:
+		default:
+			break;
 		}
 
-		// Then by name
-		return DataA.DisplayName.ToString() < DataB.DisplayName.ToString();
-	});
+		Entry.Key = (static_cast<uint64>(ModeKey) << 32)
+			| (static_cast<uint64>(ItemData.Category) << 24)
+			| (static_cast<uint64>(ItemData.NameSortRank) << 8);
+	}
+
+	Entries.Sort();
+
+	TArray<FInventorySlot> SortedSlots;
+	SortedSlots.Reserve(InventorySlots.Num());
+	for (const FInventorySortEntry& Entry : Entries)
+	{
+		SortedSlots.Add(MoveTemp(InventorySlots[Entry.SlotIndex]));
+	}
+	InventorySlots = MoveTemp(SortedSlots);
+	RebuildSlotIndex();
 
 	OnInventoryChanged.Broadcast();
 }
 
 int32 UInventoryComponent::FindSlotWithItem(FName ItemID) const
 {
-	for (int32 i = 0; i < InventorySlots.Num(); ++i)
+	const TArray<int32, TInlineAllocator<2>>* ItemSlots = ItemSlotIndex.Find(ItemID);
+	return ItemSlots ? (*ItemSlots)[0] : INDEX_NONE;
+}
+
+int32 UInventoryComponent::FindEmptySlot() const
+{
+	return FreeSlots.Find(true);
+}
+
+int32 UInventoryComponent::FindStackableSlot(FName ItemID, int32 MaxStackSize) const
+{
+	if (const TArray<int32, TInlineAllocator<2>>* ItemSlots = ItemSlotIndex.Find(ItemID))
 	{
-		if (InventorySlots[i].ItemID == ItemID)
+		for (int32 i : *ItemSlots)
 		{
-			return i;
+			if (InventorySlots[i].Quantity < MaxStackSize)
+			{
+				return i;
+			}
 		}
 	}
 	return INDEX_NONE;
 }
 
-int32 UInventoryComponent::FindEmptySlot() const
+void UInventoryComponent::IndexSlot(int32 SlotIndex)
 {
-	for (int32 i = 0; i < InventorySlots.Num(); ++i)
+	if (!FreeSlots[SlotIndex] || InventorySlots[SlotIndex].IsEmpty())
+	{
+		return;
+	}
+
+	TArray<int32, TInlineAllocator<2>>& ItemSlots = ItemSlotIndex.FindOrAdd(InventorySlots[SlotIndex].ItemID);
+	ItemSlots.Insert(SlotIndex, Algo::LowerBound(ItemSlots, SlotIndex));
+
+	FreeSlots[SlotIndex] = false;
+	++UsedSlotCount;
+}
+
+void UInventoryComponent::UnindexSlot(int32 SlotIndex)
+{
+	if (FreeSlots[SlotIndex])
+	{
+		return;
+	}
+
+	const FName ItemID = InventorySlots[SlotIndex].ItemID;
+	if (TArray<int32, TInlineAllocator<2>>* ItemSlots = ItemSlotIndex.Find(ItemID))
 	{
-		if (InventorySlots[i].IsEmpty())
+		ItemSlots->RemoveSingle(SlotIndex);
+		if (ItemSlots->Num() == 0)
 		{
-			return i;
+			ItemSlotIndex.Remove(ItemID);
 		}
 	}
-	return INDEX_NONE;
+
+	FreeSlots[SlotIndex] = true;
+	--UsedSlotCount;
 }
 
-int32 UInventoryComponent::FindStackableSlot(FName ItemID, const FItemData& ItemData) const
+void UInventoryComponent::RebuildSlotIndex()
 {
+	INC_DWORD_STAT(STAT_InventoryIndexRebuilds);
+
+	ItemSlotIndex.Reset();
+	FreeSlots.Init(true, InventorySlots.Num());
+	UsedSlotCount = 0;
+
 	for (int32 i = 0; i < InventorySlots.Num(); ++i)
 	{
-		if (InventorySlots[i].ItemID == ItemID &&
-			InventorySlots[i].Quantity < ItemData.MaxStackSize)
-		{
-			return i;
-		}
+		IndexSlot(i);
 	}
-	return INDEX_NONE;
 }
 
 AItemPickup* UInventoryComponent::DropItem(FName ItemID, int32 Quantity, FVector DropOffset)
@@ -479,14 +626,14 @@ AItemPickup* UInventoryComponent::DropItem(FName ItemID, int32 Quantity, FVector
 	int32 ActualDrop = FMath::Min(Quantity, CurrentCount);
 
 	// Get item data for validation
-	FItemData ItemData;
-	if (!GetItemData(ItemID, ItemData))
+	const FItemData* ItemData = FindItemData(ItemID);
+	if (!ItemData)
 	{
 		return nullptr;
 	}
 
 	// Check if item can be dropped
-	if (!ItemData.bCanDrop)
+	if (!ItemData->bCanDrop)
 	{
 		return nullptr;
 	}
@@ -528,7 +675,7 @@ AItemPickup* UInventoryComponent::DropItem(FName ItemID, int32 Quantity, FVector
 	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
 
 	// Use custom pickup class if specified, otherwise default
-	TSubclassOf<AItemPickup> PickupClassToSpawn = ItemData.PickupClass;
+	TSubclassOf<AItemPickup> PickupClassToSpawn = ItemData->PickupClass;
 	if (!PickupClassToSpawn)
 	{
 		PickupClassToSpawn = AItemPickup::StaticClass();
@@ -541,9 +688,9 @@ AItemPickup* UInventoryComponent::DropItem(FName ItemID, int32 Quantity, FVector
 		Pickup->ItemDataTable = ItemDataTable;
 
 		// Set the visual mesh from item data
-		if (ItemData.WorldMesh.IsValid())
+		if (ItemData->WorldMesh.IsValid())
 		{
-			UStaticMesh* Mesh = ItemData.WorldMesh.LoadSynchronous();
+			UStaticMesh* Mesh = ItemData->WorldMesh.LoadSynchronous();
 			if (Mesh && Pickup->ItemMesh)
 			{
 				Pickup->ItemMesh->SetStaticMesh(Mesh);
@@ -578,6 +725,7 @@ void UInventoryComponent::ClearInventory()
 	{
 		Slot.Clear();
 	}
+	RebuildSlotIndex();
 	OnInventoryChanged.Broadcast();
 }
 
@@ -598,5 +746,14 @@ void UInventoryComponent::SetInventorySlots(const TArray<FInventorySlot>& NewSlo
 		InventorySlots[i].Clear();
 	}
 
+	RebuildSlotIndex();
+
+	// Continue acquisition order after the newest loaded slot
+	NextAcquiredOrder = 1;
+	for (const FInventorySlot& Slot : InventorySlots)
+	{
+		NextAcquiredOrder = FMath::Max(NextAcquiredOrder, Slot.AcquiredOrder + 1);
+	}
+
 	OnInventoryChanged.Broadcast();
 }
@@ -87,10 +87,16 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Inventory")
 	int32 GetItemCount(FName ItemID) const;
 
-	/** Get item data from data table */
+	/** Get a copy of item data (Blueprint wrapper - C++ should use FindItemData) */
 	UFUNCTION(BlueprintCallable, Category = "Inventory")
 	bool GetItemData(FName ItemID, FItemData& OutItemData) const;
 
+	/** Item data row without copying (nullptr if not found) */
+	const FItemData* FindItemData(FName ItemID) const;
+
+	/** Hot item fields from the item database - prefer this in loops (nullptr if not found) */
+	const FItemHotData* FindItemHotData(FName ItemID) const;
+
 	/** Get all inventory slots */
 	UFUNCTION(BlueprintCallable, Category = "Inventory")
 	TArray<FInventorySlot> GetAllSlots() const { return InventorySlots; }
@@ -119,9 +125,9 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Inventory")
 	bool SwapSlots(int32 IndexA, int32 IndexB);
 
-	/** Sort inventory by category and name */
+	/** Sort inventory - every mode falls back to category, then display name */
 	UFUNCTION(BlueprintCallable, Category = "Inventory")
-	void SortInventory();
+	void SortInventory(EInventorySortMode SortMode = EInventorySortMode::Category);
 
 	/** Clear all inventory slots */
 	UFUNCTION(BlueprintCallable, Category = "Inventory")
@@ -151,5 +157,29 @@ protected:
 	int32 FindEmptySlot() const;
 
 	/** Find slot with stackable space for item */
-	int32 FindStackableSlot(FName ItemID, const FItemData& ItemData) const;
+	int32 FindStackableSlot(FName ItemID, int32 MaxStackSize) const;
+
+	/** Stamp for the next AddItem (recently acquired sorting) */
+	int32 NextAcquiredOrder = 1;
+
+	// ==================== Slot Index ====================
+	// Kept in step with InventorySlots by every mutation, so queries don't scan the slots
+
+	/** Occupied slot indices per item, ascending */
+	TMap<FName, TArray<int32, TInlineAllocator<2>>> ItemSlotIndex;
+
+	/** One bit per slot, set when the slot is free */
+	TBitArray<> FreeSlots;
+
+	/** Number of occupied slots */
+	int32 UsedSlotCount = 0;
+
+	/** Add a slot that just became occupied to the index */
+	void IndexSlot(int32 SlotIndex);
+
+	/** Remove a slot from the index - call before its ItemID is changed or cleared */
+	void UnindexSlot(int32 SlotIndex);
+
+	/** Rebuild the whole index after InventorySlots was replaced or reordered */
+	void RebuildSlotIndex();
 };
@@ -950,10 +950,9 @@ void UInventoryWidget::UpdateFilteredItems()
 	{
 		if (AllSlots[i].IsEmpty()) continue;
 
-		FItemData ItemData;
-		if (InventoryComponent->GetItemData(AllSlots[i].ItemID, ItemData))
+		if (const FItemHotData* ItemData = InventoryComponent->FindItemHotData(AllSlots[i].ItemID))
 		{
-			if (ItemMatchesFilter(ItemData))
+			if (ItemMatchesFilter(*ItemData))
 			{
 				FilteredSlotIndices.Add(i);
 			}
@@ -967,7 +966,7 @@ void UInventoryWidget::UpdateFilteredItems()
 	}
 }
 
-bool UInventoryWidget::ItemMatchesFilter(const FItemData& ItemData) const
+bool UInventoryWidget::ItemMatchesFilter(const FItemHotData& ItemData) const
 {
 	switch (CurrentTab)
 	{
@@ -1006,13 +1005,12 @@ void UInventoryWidget::RefreshInventoryGrid()
 				EEquipmentSlot EquipSlot = FilteredEquipSlots[DisplayIdx];
 				FName EquippedID = EquipmentComponent->GetEquippedItem(EquipSlot);
 
-				FItemData ItemData;
-				if (EquipmentComponent->GetItemData(EquippedID, ItemData))
+				if (const FItemData* ItemData = EquipmentComponent->FindItemData(EquippedID))
 				{
 					// Load and display icon
-					if (!ItemData.Icon.IsNull())
+					if (!ItemData->Icon.IsNull())
 					{
-						UTexture2D* IconTexture = ItemData.Icon.LoadSynchronous();
+						UTexture2D* IconTexture = ItemData->Icon.LoadSynchronous();
 						if (IconTexture)
 						{
 							SlotBrushes[DisplayIdx].SetResourceObject(IconTexture);
@@ -1025,7 +1023,7 @@ void UInventoryWidget::RefreshInventoryGrid()
 						{
 							const FSlateBrush* WhiteBrush = FCoreStyle::Get().GetBrush("GenericWhiteBox");
 							SlotBrushes[DisplayIdx] = *WhiteBrush;
-							SlotBrushes[DisplayIdx].TintColor = FSlateColor(GetRarityColor(ItemData.Rarity) * 0.6f);
+							SlotBrushes[DisplayIdx].TintColor = FSlateColor(GetRarityColor(ItemData->Rarity) * 0.6f);
 							SlotBrushes[DisplayIdx].DrawAs = ESlateBrushDrawType::Box;
 							SlotIcons[DisplayIdx]->SetImage(&SlotBrushes[DisplayIdx]);
 							SlotIcons[DisplayIdx]->SetVisibility(EVisibility::Visible);
@@ -1035,7 +1033,7 @@ void UInventoryWidget::RefreshInventoryGrid()
 					{
 						const FSlateBrush* WhiteBrush = FCoreStyle::Get().GetBrush("GenericWhiteBox");
 						SlotBrushes[DisplayIdx] = *WhiteBrush;
-						SlotBrushes[DisplayIdx].TintColor = FSlateColor(GetRarityColor(ItemData.Rarity) * 0.6f);
+						SlotBrushes[DisplayIdx].TintColor = FSlateColor(GetRarityColor(ItemData->Rarity) * 0.6f);
 						SlotBrushes[DisplayIdx].DrawAs = ESlateBrushDrawType::Box;
 						SlotIcons[DisplayIdx]->SetImage(&SlotBrushes[DisplayIdx]);
 						SlotIcons[DisplayIdx]->SetVisibility(EVisibility::Visible);
@@ -1050,7 +1048,7 @@ void UInventoryWidget::RefreshInventoryGrid()
 					// Border color by rarity
 					if (SlotBorders.IsValidIndex(DisplayIdx) && SlotBorders[DisplayIdx].IsValid())
 					{
-						SlotBorders[DisplayIdx]->SetBorderBackgroundColor(GetRarityColor(ItemData.Rarity));
+						SlotBorders[DisplayIdx]->SetBorderBackgroundColor(GetRarityColor(ItemData->Rarity));
 					}
 
 					// Always show equipped badge on Equipped tab
@@ -1096,13 +1094,12 @@ void UInventoryWidget::RefreshInventoryGrid()
 			int32 ActualSlotIdx = FilteredSlotIndices[DisplayIdx];
 			const FInventorySlot& InvSlot = AllSlots[ActualSlotIdx];
 
-			FItemData ItemData;
-			if (InventoryComponent->GetItemData(InvSlot.ItemID, ItemData))
+			if (const FItemData* ItemData = InventoryComponent->FindItemData(InvSlot.ItemID))
 			{
 				// Load and display icon - use IsNull() NOT IsValid()
-				if (!ItemData.Icon.IsNull())
+				if (!ItemData->Icon.IsNull())
 				{
-					UTexture2D* IconTexture = ItemData.Icon.LoadSynchronous();
+					UTexture2D* IconTexture = ItemData->Icon.LoadSynchronous();
 					if (IconTexture)
 					{
 						SlotBrushes[DisplayIdx].SetResourceObject(IconTexture);
@@ -1127,7 +1124,7 @@ void UInventoryWidget::RefreshInventoryGrid()
 					// No icon path set - show colored placeholder box
 					const FSlateBrush* WhiteBrush = FCoreStyle::Get().GetBrush("GenericWhiteBox");
 					SlotBrushes[DisplayIdx] = *WhiteBrush;
-					SlotBrushes[DisplayIdx].TintColor = FSlateColor(GetRarityColor(ItemData.Rarity) * 0.6f);
+					SlotBrushes[DisplayIdx].TintColor = FSlateColor(GetRarityColor(ItemData->Rarity) * 0.6f);
 					SlotBrushes[DisplayIdx].DrawAs = ESlateBrushDrawType::Box;
 					SlotIcons[DisplayIdx]->SetImage(&SlotBrushes[DisplayIdx]);
 					SlotIcons[DisplayIdx]->SetVisibility(EVisibility::Visible);
@@ -1146,7 +1143,7 @@ void UInventoryWidget::RefreshInventoryGrid()
 				// Border color by rarity
 				if (SlotBorders.IsValidIndex(DisplayIdx) && SlotBorders[DisplayIdx].IsValid())
 				{
-					SlotBorders[DisplayIdx]->SetBorderBackgroundColor(GetRarityColor(ItemData.Rarity));
+					SlotBorders[DisplayIdx]->SetBorderBackgroundColor(GetRarityColor(ItemData->Rarity));
 				}
 
 				// Equipped badge - check if this item is equipped in ANY slot
@@ -1230,10 +1227,9 @@ void UInventoryWidget::UpdateSelectionHighlight()
 			int32 ActualIdx = FilteredSlotIndices[i];
 			if (AllSlots.IsValidIndex(ActualIdx) && !AllSlots[ActualIdx].IsEmpty())
 			{
-				FItemData ItemData;
-				if (InventoryComponent->GetItemData(AllSlots[ActualIdx].ItemID, ItemData))
+				if (const FItemHotData* ItemData = InventoryComponent->FindItemHotData(AllSlots[ActualIdx].ItemID))
 				{
-					BorderColor = GetRarityColor(ItemData.Rarity);
+					BorderColor = GetRarityColor(ItemData->Rarity);
 				}
 			}
 		}
@@ -1257,22 +1253,21 @@ void UInventoryWidget::UpdateItemDetails()
 		FName EquippedItemID = EquipmentComponent->GetEquippedItem(EquipSlot);
 		if (!EquippedItemID.IsNone())
 		{
-			FItemData ItemData;
-			if (EquipmentComponent->GetItemData(EquippedItemID, ItemData))
+			if (const FItemData* ItemData = EquipmentComponent->FindItemData(EquippedItemID))
 			{
 				// Show equipped item details
 				if (DetailItemName.IsValid())
 				{
-					DetailItemName->SetText(ItemData.DisplayName);
-					DetailItemName->SetColorAndOpacity(FSlateColor(GetRarityColor(ItemData.Rarity)));
+					DetailItemName->SetText(ItemData->DisplayName);
+					DetailItemName->SetColorAndOpacity(FSlateColor(GetRarityColor(ItemData->Rarity)));
 				}
 
 				if (DetailItemType.IsValid())
 				{
 					FString TypeStr = TEXT("Equipped");
-					switch (ItemData.Category)
+					switch (ItemData->Category)
 					{
-					case EItemCategory::Equipment: TypeStr = ItemData.IsWeapon() ? TEXT("Weapon (Equipped)") : TEXT("Armor (Equipped)"); break;
+					case EItemCategory::Equipment: TypeStr = ItemData->IsWeapon() ? TEXT("Weapon (Equipped)") : TEXT("Armor (Equipped)"); break;
 					default: TypeStr = TEXT("Item (Equipped)"); break;
 					}
 					DetailItemType->SetText(FText::FromString(TypeStr));
@@ -1281,9 +1276,9 @@ void UInventoryWidget::UpdateItemDetails()
 				// Icon
 				if (DetailItemIcon.IsValid())
 				{
-					if (!ItemData.Icon.IsNull())
+					if (!ItemData->Icon.IsNull())
 					{
-						UTexture2D* IconTexture = ItemData.Icon.LoadSynchronous();
+						UTexture2D* IconTexture = ItemData->Icon.LoadSynchronous();
 						if (IconTexture)
 						{
 							DetailIconBrush.SetResourceObject(IconTexture);
@@ -1297,7 +1292,7 @@ void UInventoryWidget::UpdateItemDetails()
 					{
 						const FSlateBrush* WhiteBrush = FCoreStyle::Get().GetBrush("GenericWhiteBox");
 						DetailIconBrush = *WhiteBrush;
-						DetailIconBrush.TintColor = FSlateColor(GetRarityColor(ItemData.Rarity) * 0.5f);
+						DetailIconBrush.TintColor = FSlateColor(GetRarityColor(ItemData->Rarity) * 0.5f);
 						DetailIconBrush.DrawAs = ESlateBrushDrawType::Box;
 						DetailItemIcon->SetImage(&DetailIconBrush);
 						DetailItemIcon->SetVisibility(EVisibility::Visible);
@@ -1308,14 +1303,14 @@ void UInventoryWidget::UpdateItemDetails()
 				if (DetailItemStats.IsValid())
 				{
 					FString StatsStr;
-					if (ItemData.Stats.PhysicalDamage > 0)
-						StatsStr += FString::Printf(TEXT("Attack: %.0f\n"), ItemData.Stats.PhysicalDamage);
-					if (ItemData.Stats.PhysicalDefense > 0)
-						StatsStr += FString::Printf(TEXT("Defense: %.0f\n"), ItemData.Stats.PhysicalDefense);
-					if (ItemData.Stats.Poise > 0)
-						StatsStr += FString::Printf(TEXT("Poise: %.0f\n"), ItemData.Stats.Poise);
-					if (ItemData.Stats.Weight > 0)
-						StatsStr += FString::Printf(TEXT("Weight: %.1f\n"), ItemData.Stats.Weight);
+					if (ItemData->Stats.PhysicalDamage > 0)
+						StatsStr += FString::Printf(TEXT("Attack: %.0f\n"), ItemData->Stats.PhysicalDamage);
+					if (ItemData->Stats.PhysicalDefense > 0)
+						StatsStr += FString::Printf(TEXT("Defense: %.0f\n"), ItemData->Stats.PhysicalDefense);
+					if (ItemData->Stats.Poise > 0)
+						StatsStr += FString::Printf(TEXT("Poise: %.0f\n"), ItemData->Stats.Poise);
+					if (ItemData->Stats.Weight > 0)
+						StatsStr += FString::Printf(TEXT("Weight: %.1f\n"), ItemData->Stats.Weight);
 					DetailItemStats->SetText(FText::FromString(StatsStr));
 				}
 
@@ -1326,7 +1321,7 @@ void UInventoryWidget::UpdateItemDetails()
 
 				if (DetailItemDesc.IsValid())
 				{
-					DetailItemDesc->SetText(ItemData.Description);
+					DetailItemDesc->SetText(ItemData->Description);
 				}
 
 				return;
@@ -1363,9 +1358,9 @@ void UInventoryWidget::UpdateItemDetails()
 	if (!AllSlots.IsValidIndex(ActualSlotIdx)) return;
 
 	const FInventorySlot& InvSlot = AllSlots[ActualSlotIdx];
-	FItemData ItemData;
-
-	if (!InventoryComponent->GetItemData(InvSlot.ItemID, ItemData)) return;
+	const FItemData* ItemDataPtr = InventoryComponent->FindItemData(InvSlot.ItemID);
+	if (!ItemDataPtr) return;
+	const FItemData& ItemData = *ItemDataPtr;
 
 	// Name with rarity color
 	if (DetailItemName.IsValid())
@@ -1511,13 +1506,12 @@ void UInventoryWidget::RefreshEquipmentSlotIcons()
 
 		if (!EquippedItemID.IsNone())
 		{
-			FItemData ItemData;
-			if (EquipmentComponent->GetItemData(EquippedItemID, ItemData))
+			if (const FItemData* ItemData = EquipmentComponent->FindItemData(EquippedItemID))
 			{
 				// Load icon
-				if (!ItemData.Icon.IsNull())
+				if (!ItemData->Icon.IsNull())
 				{
-					UTexture2D* IconTexture = ItemData.Icon.LoadSynchronous();
+					UTexture2D* IconTexture = ItemData->Icon.LoadSynchronous();
 					if (IconTexture)
 					{
 						BrushPtr->SetResourceObject(IconTexture);
@@ -1536,7 +1530,7 @@ void UInventoryWidget::RefreshEquipmentSlotIcons()
 					// No icon - show colored placeholder
 					const FSlateBrush* WhiteBrush = FCoreStyle::Get().GetBrush("GenericWhiteBox");
 					*BrushPtr = *WhiteBrush;
-					BrushPtr->TintColor = FSlateColor(GetRarityColor(ItemData.Rarity) * 0.6f);
+					BrushPtr->TintColor = FSlateColor(GetRarityColor(ItemData->Rarity) * 0.6f);
 					BrushPtr->DrawAs = ESlateBrushDrawType::Box;
 					(*IconPtr)->SetImage(BrushPtr);
 					(*IconPtr)->SetVisibility(EVisibility::Visible);
@@ -1545,7 +1539,7 @@ void UInventoryWidget::RefreshEquipmentSlotIcons()
 				// Set border color by rarity
 				if (BorderPtr && BorderPtr->IsValid())
 				{
-					(*BorderPtr)->SetBorderBackgroundColor(GetRarityColor(ItemData.Rarity));
+					(*BorderPtr)->SetBorderBackgroundColor(GetRarityColor(ItemData->Rarity));
 				}
 			}
 		}
@@ -1586,10 +1580,9 @@ void UInventoryWidget::UpdateEquipmentHighlight()
 			FName EquippedItemID = EquipmentComponent ? EquipmentComponent->GetEquippedItem(SlotType) : NAME_None;
 			if (!EquippedItemID.IsNone())
 			{
-				FItemData ItemData;
-				if (EquipmentComponent->GetItemData(EquippedItemID, ItemData))
+				if (const FItemHotData* ItemData = EquipmentComponent->FindItemHotData(EquippedItemID))
 				{
-					(*BorderPtr)->SetBorderBackgroundColor(GetRarityColor(ItemData.Rarity));
+					(*BorderPtr)->SetBorderBackgroundColor(GetRarityColor(ItemData->Rarity));
 				}
 				else
 				{
@@ -1772,11 +1765,12 @@ void UInventoryWidget::TryEquipSelected()
 	}
 
 	FName ItemID = AllSlots[ActualIdx].ItemID;
-	FItemData ItemData;
-	if (!InventoryComponent->GetItemData(ItemID, ItemData))
+	const FItemHotData* ItemDataPtr = InventoryComponent->FindItemHotData(ItemID);
+	if (!ItemDataPtr)
 	{
 		return;
 	}
+	const FItemHotData& ItemData = *ItemDataPtr;
 
 	// Equipment - equip it
 	if (ItemData.IsEquipment())
@@ -1996,8 +1990,9 @@ void UInventoryWidget::PopulateActionOptions()
 		if (!AllSlots.IsValidIndex(ActualIdx)) return;
 
 		const FInventorySlot& InvSlot = AllSlots[ActualIdx];
-		FItemData ItemData;
-		if (!InventoryComponent->GetItemData(InvSlot.ItemID, ItemData)) return;
+		const FItemHotData* ItemDataPtr = InventoryComponent->FindItemHotData(InvSlot.ItemID);
+		if (!ItemDataPtr) return;
+		const FItemHotData& ItemData = *ItemDataPtr;
 
 		// Build options based on item type
 		if (ItemData.IsEquipment())
@@ -2196,8 +2191,7 @@ void UInventoryWidget::TryUnequipSelected()
 	if (!AllSlots.IsValidIndex(ActualIdx)) return;
 
 	FName ItemID = AllSlots[ActualIdx].ItemID;
-	FItemData ItemData;
-	if (!InventoryComponent->GetItemData(ItemID, ItemData)) return;
+	if (!InventoryComponent->FindItemData(ItemID)) return;
 
 	// Find which slot it's equipped in and unequip (check ALL slots)
 	TArray<EEquipmentSlot> SlotsToCheck = {
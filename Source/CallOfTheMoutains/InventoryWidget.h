@@ -187,7 +187,7 @@ private:
 	// Helpers
 	static FLinearColor GetRarityColor(EItemRarity Rarity);
 	static FString GetCategoryName(EInventoryTab Tab);
-	bool ItemMatchesFilter(const FItemData& ItemData) const;
+	bool ItemMatchesFilter(const FItemHotData& ItemData) const;
 
 	// Layout constants
 	static constexpr float SLOT_SIZE = 64.0f;
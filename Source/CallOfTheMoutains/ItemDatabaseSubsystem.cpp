@@ -0,0 +1,219 @@
+// CallOfTheMoutains - Item Database Subsystem Implementation
+
+#include "ItemDatabaseSubsystem.h"
+#include "CallOfTheMoutains.h"
+#include "Engine/DataTable.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "Internationalization/Internationalization.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Item Data Lookups"), STAT_ItemDataLookups, STATGROUP_CallOfTheMoutains);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Item Data Copies"), STAT_ItemDataCopies, STATGROUP_CallOfTheMoutains);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Item Database Items"), STAT_ItemDatabaseItems, STATGROUP_CallOfTheMoutains);
+
+UItemDatabaseSubsystem* UItemDatabaseSubsystem::Get(const UObject* WorldContextObject)
+{
+	UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+	return GameInstance ? GameInstance->GetSubsystem<UItemDatabaseSubsystem>() : nullptr;
+}
+
+void UItemDatabaseSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	RegisterItemTable(LoadObject<UDataTable>(nullptr, TEXT("/Game/BluePrints/Data/ItemData")));
+
+	// Name collation depends on the active culture
+	FInternationalization::Get().OnCultureChanged().AddUObject(this, &UItemDatabaseSubsystem::RebuildNameSortRanks);
+}
+
+void UItemDatabaseSubsystem::Deinitialize()
+{
+	FInternationalization::Get().OnCultureChanged().RemoveAll(this);
+
+#if WITH_EDITOR
+	for (UDataTable* Table : SourceTables)
+	{
+		if (Table)
+		{
+			Table->OnDataTableChanged().RemoveAll(this);
+		}
+	}
+#endif
+
+	SourceTables.Empty();
+	HotData.Empty();
+	ColdData.Empty();
+	ItemIndices.Empty();
+
+	Super::Deinitialize();
+}
+
+void UItemDatabaseSubsystem::RegisterItemTable(UDataTable* Table)
+{
+	if (!Table || SourceTables.Contains(Table))
+	{
+		return;
+	}
+
+	if (Table->GetRowStruct() != FItemData::StaticStruct())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("ItemDatabase: %s does not use FItemData rows"), *Table->GetName());
+		return;
+	}
+
+	SourceTables.Add(Table);
+	AppendTable(Table);
+	RebuildNameSortRanks();
+
+#if WITH_EDITOR
+	// Row pointers are invalidated when a table is edited during PIE
+	Table->OnDataTableChanged().AddUObject(this, &UItemDatabaseSubsystem::Rebuild);
+#endif
+}
+
+void UItemDatabaseSubsystem::AppendTable(const UDataTable* Table)
+{
+	const TMap<FName, uint8*>& RowMap = Table->GetRowMap();
+
+	HotData.Reserve(HotData.Num() + RowMap.Num());
+	ColdData.Reserve(ColdData.Num() + RowMap.Num());
+	ItemIndices.Reserve(ItemIndices.Num() + RowMap.Num());
+
+	for (const TPair<FName, uint8*>& Row : RowMap)
+	{
+		if (ItemIndices.Contains(Row.Key))
+		{
+			continue;
+		}
+
+		if (HotData.Num() >= InvalidItemIndex)
+		{
+			UE_LOG(LogTemp, Error, TEXT("ItemDatabase: More than %d items - remaining rows of %s are ignored"), InvalidItemIndex, *Table->GetName());
+			break;
+		}
+
+		const FItemData* ItemData = reinterpret_cast<const FItemData*>(Row.Value);
+		ItemIndices.Add(Row.Key, static_cast<FItemIndex>(HotData.Num()));
+		HotData.Emplace(*ItemData);
+		ColdData.Add(ItemData);
+	}
+
+	SET_DWORD_STAT(STAT_ItemDatabaseItems, HotData.Num());
+}
+
+void UItemDatabaseSubsystem::Rebuild()
+{
+	HotData.Reset();
+	ColdData.Reset();
+	ItemIndices.Reset();
+
+	for (const UDataTable* Table : SourceTables)
+	{
+		if (Table)
+		{
+			AppendTable(Table);
+		}
+	}
+
+	RebuildNameSortRanks();
+}
+
+void UItemDatabaseSubsystem::RebuildNameSortRanks()
+{
+	TArray<FItemIndex> Order;
+	Order.SetNumUninitialized(ColdData.Num());
+	for (int32 Index = 0; Index < Order.Num(); ++Index)
+	{
+		Order[Index] = static_cast<FItemIndex>(Index);
+	}
+
+	// FText::CompareTo collates with the current culture's rules - done once here, not per sort
+	Order.Sort([this](FItemIndex A, FItemIndex B)
+	{
+		return ColdData[A]->DisplayName.CompareTo(ColdData[B]->DisplayName) < 0;
+	});
+
+	uint16 Rank = 0;
+	for (int32 Position = 0; Position < Order.Num(); ++Position)
+	{
+		// Equal names share a rank
+		if (Position > 0 && ColdData[Order[Position]]->DisplayName.CompareTo(ColdData[Order[Position - 1]]->DisplayName) != 0)
+		{
+			++Rank;
+		}
+		HotData[Order[Position]].NameSortRank = Rank;
+	}
+}
+
+FItemIndex UItemDatabaseSubsystem::FindItemIndex(FName ItemID) const
+{
+	if (ItemID.IsNone())
+	{
+		return InvalidItemIndex;
+	}
+
+	INC_DWORD_STAT(STAT_ItemDataLookups);
+	const FItemIndex* Index = ItemIndices.Find(ItemID);
+	return Index ? *Index : InvalidItemIndex;
+}
+
+const FItemData* UItemDatabaseSubsystem::FindItem(const UObject* WorldContextObject, FName ItemID, const UDataTable* FallbackTable)
+{
+	if (ItemID.IsNone())
+	{
+		return nullptr;
+	}
+
+	if (const UItemDatabaseSubsystem* Database = Get(WorldContextObject))
+	{
+		if (const FItemData* ItemData = Database->FindItem(ItemID))
+		{
+			return ItemData;
+		}
+	}
+
+	// Rows only in the caller's table (or no database yet)
+	return FallbackTable ? FallbackTable->FindRow<FItemData>(ItemID, TEXT("ItemDatabase")) : nullptr;
+}
+
+const FItemHotData* UItemDatabaseSubsystem::FindHotData(const UObject* WorldContextObject, FName ItemID)
+{
+	const UItemDatabaseSubsystem* Database = Get(WorldContextObject);
+	return Database ? Database->FindHotData(ItemID) : nullptr;
+}
+
+bool UItemDatabaseSubsystem::K2_GetItemData(FName ItemID, FItemData& OutItemData) const
+{
+	if (const FItemData* ItemData = FindItem(ItemID))
+	{
+		NotifyItemDataCopied();
+		OutItemData = *ItemData;
+		return true;
+	}
+	return false;
+}
+
+FText UItemDatabaseSubsystem::GetItemDisplayName(FName ItemID) const
+{
+	const FItemData* ItemData = FindItem(ItemID);
+	return ItemData ? ItemData->DisplayName : FText::GetEmpty();
+}
+
+EItemCategory UItemDatabaseSubsystem::GetItemCategory(FName ItemID) const
+{
+	const FItemHotData* Hot = FindHotData(ItemID);
+	return Hot ? Hot->Category : EItemCategory::None;
+}
+
+FItemStats UItemDatabaseSubsystem::GetItemStats(FName ItemID) const
+{
+	const FItemHotData* Hot = FindHotData(ItemID);
+	return Hot ? Hot->Stats : FItemStats();
+}
+
+void UItemDatabaseSubsystem::NotifyItemDataCopied()
+{
+	INC_DWORD_STAT(STAT_ItemDataCopies);
+}
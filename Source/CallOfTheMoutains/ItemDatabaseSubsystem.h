@@ -0,0 +1,123 @@
+// CallOfTheMoutains - Item Database Subsystem
+// Game-instance item registry flattened from the item DataTable(s)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "ItemTypes.h"
+#include "ItemDatabaseSubsystem.generated.h"
+
+class UDataTable;
+
+/** Compact index of an item in the database */
+using FItemIndex = uint16;
+
+/**
+ * Item Database
+ * Registered item tables are flattened once into parallel arrays indexed by a
+ * compact FItemIndex:
+ * - HotData: category, slots, weapon type, stack size, rarity, FItemStats and a display name
+ *   collation rank (rebuilt when the culture changes), packed densely
+ * - ColdData: pointer to the full FItemData row (text, soft asset references)
+ * Each row name maps to its index, so lookups never go through UDataTable::FindRow.
+ *
+ * Inventory, equipment and pickups register their tables at BeginPlay; rows already
+ * present keep their first definition. Returned pointers are transient - don't store them.
+ */
+UCLASS()
+class CALLOFTHEMOUTAINS_API UItemDatabaseSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static constexpr FItemIndex InvalidItemIndex = MAX_uint16;
+
+	/** Get the database for a world context (nullptr if unavailable) */
+	static UItemDatabaseSubsystem* Get(const UObject* WorldContextObject);
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	/** Add a table's rows to the database (rows already present are skipped) */
+	void RegisterItemTable(UDataTable* Table);
+
+	/** First registered table */
+	UFUNCTION(BlueprintCallable, Category = "Items")
+	UDataTable* GetItemTable() const { return SourceTables.Num() > 0 ? SourceTables[0] : nullptr; }
+
+	/** Number of items in the database */
+	int32 GetNumItems() const { return HotData.Num(); }
+
+	// ==================== Index Access ====================
+
+	/** Compact index for an item (InvalidItemIndex if not found) */
+	FItemIndex FindItemIndex(FName ItemID) const;
+
+	/** Hot fields by index */
+	const FItemHotData* GetHotData(FItemIndex Index) const { return HotData.IsValidIndex(Index) ? &HotData[Index] : nullptr; }
+
+	/** Full row by index */
+	const FItemData* GetItemData(FItemIndex Index) const { return ColdData.IsValidIndex(Index) ? ColdData[Index] : nullptr; }
+
+	// ==================== ID Access ====================
+
+	/** Full item row by ID - no copy (nullptr if not found) */
+	const FItemData* FindItem(FName ItemID) const { return GetItemData(FindItemIndex(ItemID)); }
+
+	/** Hot fields by ID (nullptr if not found) */
+	const FItemHotData* FindHotData(FName ItemID) const { return GetHotData(FindItemIndex(ItemID)); }
+
+	/**
+	 * Full item row lookup used by components holding their own table.
+	 * Reads from the database first; FallbackTable is read when no database is available
+	 * or the database doesn't have the row.
+	 */
+	static const FItemData* FindItem(const UObject* WorldContextObject, FName ItemID, const UDataTable* FallbackTable);
+
+	/** Hot fields lookup for a world context (nullptr if not found or no database) */
+	static const FItemHotData* FindHotData(const UObject* WorldContextObject, FName ItemID);
+
+	// ==================== Blueprint Access ====================
+
+	/** Copy of an item row (Blueprint only - C++ should use FindItem) */
+	UFUNCTION(BlueprintCallable, Category = "Items", meta = (DisplayName = "Get Item Data"))
+	bool K2_GetItemData(FName ItemID, FItemData& OutItemData) const;
+
+	/** Whether an item exists in the database */
+	UFUNCTION(BlueprintPure, Category = "Items")
+	bool HasItem(FName ItemID) const { return FindItemIndex(ItemID) != InvalidItemIndex; }
+
+	/** Display name of an item (empty if not found) */
+	UFUNCTION(BlueprintPure, Category = "Items")
+	FText GetItemDisplayName(FName ItemID) const;
+
+	/** Category of an item */
+	UFUNCTION(BlueprintPure, Category = "Items")
+	EItemCategory GetItemCategory(FName ItemID) const;
+
+	/** Stats of an item (defaults if not found) */
+	UFUNCTION(BlueprintPure, Category = "Items")
+	FItemStats GetItemStats(FName ItemID) const;
+
+	/** Count a full FItemData copy (Blueprint wrappers) in the item data stats */
+	static void NotifyItemDataCopied();
+
+protected:
+	/** Tables the database was built from (kept alive so ColdData stays valid) */
+	UPROPERTY()
+	TArray<UDataTable*> SourceTables;
+
+	TArray<FItemHotData> HotData;
+	TArray<const FItemData*> ColdData;
+	TMap<FName, FItemIndex> ItemIndices;
+
+	/** Flatten a table's rows onto the end of the arrays */
+	void AppendTable(const UDataTable* Table);
+
+	/** Rebuild every array from the registered tables (a source table changed) */
+	void Rebuild();
+
+	/** Recompute NameSortRank for every item in the current culture's collation order */
+	void RebuildNameSortRanks();
+};
@@ -1,21 +1,24 @@
 // CallOfTheMoutains - Item Pickup Implementation
-// Overlap-based detection with E key to pick up
+// Overlap-based detection feeding the pickup focus subsystem
 
 #include "ItemPickup.h"
 #include "InventoryComponent.h"
 #include "EquipmentComponent.h"
+#include "PickupFocusSubsystem.h"
+#include "ItemDatabaseSubsystem.h"
+#include "WorldStateSubsystem.h"
 #include "Components/SphereComponent.h"
 #include "Components/StaticMeshComponent.h"
 #include "Components/PointLightComponent.h"
 #include "GameFramework/Pawn.h"
-#include "GameFramework/PlayerController.h"
 #include "Engine/DataTable.h"
 #include "TimerManager.h"
 #include "UObject/ConstructorHelpers.h"
 
 AItemPickup::AItemPickup()
 {
-	PrimaryActorTick.bCanEverTick = true;
+	// Focus and E-key input are event driven (UPickupFocusSubsystem + player controller)
+	PrimaryActorTick.bCanEverTick = false;
 
 	// NOTE: Do NOT use ConstructorHelpers here - causes circular dependency crash
 	// ItemDataTable will be loaded in BeginPlay or set in Blueprint
@@ -47,6 +50,22 @@ AItemPickup::AItemPickup()
 	RarityLight->SetLightColor(FLinearColor::White);
 }
 
+void AItemPickup::OnConstruction(const FTransform& Transform)
+{
+	Super::OnConstruction(Transform);
+
+	UWorldStateSubsystem::AssignEditorGuid(this, WorldStateGuid);
+}
+
+#if WITH_EDITOR
+void AItemPickup::PostEditImport()
+{
+	Super::PostEditImport();
+
+	UWorldStateSubsystem::RegenerateImportedGuid(WorldStateGuid);
+}
+#endif
+
 void AItemPickup::BeginPlay()
 {
 	Super::BeginPlay();
@@ -57,6 +76,12 @@ void AItemPickup::BeginPlay()
 		ItemDataTable = LoadObject<UDataTable>(nullptr, TEXT("/Game/BluePrints/Data/ItemData"));
 	}
 
+	// Item lookups go through the shared item database
+	if (UItemDatabaseSubsystem* ItemDatabase = UItemDatabaseSubsystem::Get(this))
+	{
+		ItemDatabase->RegisterItemTable(ItemDataTable);
+	}
+
 	// Update sphere radius from property
 	InteractionSphere->SetSphereRadius(InteractionRadius);
 
@@ -71,16 +96,19 @@ void AItemPickup::BeginPlay()
 		RarityLight->SetAttenuationRadius(LightRadius);
 	}
 	UpdateRarityLight();
+
+	// Restore collection state from the save (may destroy this pickup)
+	UWorldStateSubsystem::ResolveAndRegister(this, WorldStateGuid);
 }
 
-void AItemPickup::Tick(float DeltaTime)
+void AItemPickup::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	Super::Tick(DeltaTime);
-
-	if (!bIsCollected)
+	if (UPickupFocusSubsystem* FocusSubsystem = UPickupFocusSubsystem::Get(this))
 	{
-		CheckForPickupInput();
+		FocusSubsystem->RemovePickup(this);
 	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 FLinearColor AItemPickup::GetRarityColor(EItemRarity Rarity)
@@ -114,10 +142,9 @@ void AItemPickup::UpdateRarityLight()
 		return;
 	}
 
-	FItemData ItemData;
-	if (GetItemData(ItemData))
+	if (const FItemHotData* ItemData = UItemDatabaseSubsystem::FindHotData(this, ItemID))
 	{
-		FLinearColor RarityColor = GetRarityColor(ItemData.Rarity);
+		FLinearColor RarityColor = GetRarityColor(ItemData->Rarity);
 		RarityLight->SetLightColor(RarityColor);
 	}
 	else
@@ -127,29 +154,6 @@ void AItemPickup::UpdateRarityLight()
 	}
 }
 
-void AItemPickup::CheckForPickupInput()
-{
-	if (!OverlappingPawn)
-	{
-		return;
-	}
-
-	// Get player controller for input
-	APlayerController* PC = Cast<APlayerController>(OverlappingPawn->GetController());
-	if (!PC)
-	{
-		return;
-	}
-
-	// Check E key press (not hold)
-	bool bEDown = PC->IsInputKeyDown(EKeys::E);
-	if (bEDown && !bEKeyWasDown)
-	{
-		TryPickup(OverlappingPawn);
-	}
-	bEKeyWasDown = bEDown;
-}
-
 void AItemPickup::OnInteractionBeginOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor,
 	UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
 {
@@ -166,6 +170,11 @@ void AItemPickup::OnInteractionBeginOverlap(UPrimitiveComponent* OverlappedCompo
 
 	OverlappingPawn = Pawn;
 	OnPickupFocused.Broadcast(this, true);
+
+	if (UPickupFocusSubsystem* FocusSubsystem = UPickupFocusSubsystem::Get(this))
+	{
+		FocusSubsystem->AddCandidate(Pawn, this);
+	}
 }
 
 void AItemPickup::OnInteractionEndOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor,
@@ -175,9 +184,16 @@ void AItemPickup::OnInteractionEndOverlap(UPrimitiveComponent* OverlappedCompone
 	if (Pawn && Pawn == OverlappingPawn)
 	{
 		OverlappingPawn = nullptr;
-		bEKeyWasDown = false;
 		OnPickupFocused.Broadcast(this, false);
 	}
+
+	if (Pawn)
+	{
+		if (UPickupFocusSubsystem* FocusSubsystem = UPickupFocusSubsystem::Get(this))
+		{
+			FocusSubsystem->RemoveCandidate(Pawn, this);
+		}
+	}
 }
 
 bool AItemPickup::TryPickup(APawn* Interactor)
@@ -243,13 +259,21 @@ bool AItemPickup::TryPickup(APawn* Interactor)
 		OverlappingPawn = nullptr;
 		OnPickupFocused.Broadcast(this, false);
 
+		if (UPickupFocusSubsystem* FocusSubsystem = UPickupFocusSubsystem::Get(this))
+		{
+			FocusSubsystem->RemovePickup(this);
+		}
+
 		if (bRespawns)
 		{
 			HidePickup();
 			GetWorldTimerManager().SetTimer(RespawnTimerHandle, this, &AItemPickup::Respawn, RespawnDelay, false);
+			UWorldStateSubsystem::NotifyStateChanged(this);
 		}
 		else
 		{
+			bIsCollected = true;
+			UWorldStateSubsystem::NotifyStateChanged(this);
 			Destroy();
 		}
 
@@ -261,14 +285,9 @@ bool AItemPickup::TryPickup(APawn* Interactor)
 
 bool AItemPickup::GetItemData(FItemData& OutItemData) const
 {
-	if (!ItemDataTable || ItemID.IsNone())
-	{
-		return false;
-	}
-
-	FItemData* FoundData = ItemDataTable->FindRow<FItemData>(ItemID, TEXT("GetItemData"));
-	if (FoundData)
+	if (const FItemData* FoundData = FindItemData())
 	{
+		UItemDatabaseSubsystem::NotifyItemDataCopied();
 		OutItemData = *FoundData;
 		return true;
 	}
@@ -276,14 +295,18 @@ bool AItemPickup::GetItemData(FItemData& OutItemData) const
 	return false;
 }
 
+const FItemData* AItemPickup::FindItemData() const
+{
+	return UItemDatabaseSubsystem::FindItem(this, ItemID, ItemDataTable);
+}
+
 FText AItemPickup::GetPickupPrompt() const
 {
-	FItemData ItemData;
 	FString ItemName;
 
-	if (GetItemData(ItemData))
+	if (const FItemData* ItemData = FindItemData())
 	{
-		ItemName = ItemData.DisplayName.ToString();
+		ItemName = ItemData->DisplayName.ToString();
 	}
 	else
 	{
@@ -312,6 +335,12 @@ void AItemPickup::SetItem(FName NewItemID, int32 NewQuantity)
 void AItemPickup::HidePickup()
 {
 	bIsCollected = true;
+
+	if (UPickupFocusSubsystem* FocusSubsystem = UPickupFocusSubsystem::Get(this))
+	{
+		FocusSubsystem->RemovePickup(this);
+	}
+
 	SetActorHiddenInGame(true);
 	SetActorEnableCollision(false);
 }
@@ -326,4 +355,35 @@ void AItemPickup::ShowPickup()
 void AItemPickup::Respawn()
 {
 	ShowPickup();
+	UWorldStateSubsystem::NotifyStateChanged(this);
+}
+
+uint32 AItemPickup::CaptureWorldState() const
+{
+	return bIsCollected ? 1 : 0;
+}
+
+void AItemPickup::RestoreWorldState(uint32 State)
+{
+	const bool bCollected = (State & 1) != 0;
+	if (bCollected == bIsCollected)
+	{
+		return;
+	}
+
+	if (!bCollected)
+	{
+		GetWorldTimerManager().ClearTimer(RespawnTimerHandle);
+		ShowPickup();
+	}
+	else if (bRespawns)
+	{
+		// Remaining respawn time isn't saved - a loaded pickup waits the full delay
+		HidePickup();
+		GetWorldTimerManager().SetTimer(RespawnTimerHandle, this, &AItemPickup::Respawn, RespawnDelay, false);
+	}
+	else
+	{
+		Destroy();
+	}
 }
@@ -6,6 +6,7 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
 #include "ItemTypes.h"
+#include "WorldStateInterface.h"
 #include "ItemPickup.generated.h"
 
 class USphereComponent;
@@ -17,20 +18,32 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnPickupFocused, AItemPickup*, Pic
 
 /**
  * World-placed item pickup
- * Uses overlap detection - shows prompt when player is nearby
- * Press E to pick up
+ * Uses overlap detection - reports nearby players to UPickupFocusSubsystem (no tick)
+ * Press E to pick up the focused pickup (handled by the player controller)
+ * Collection persists in save games (UWorldStateSubsystem) for level-placed pickups
  */
 UCLASS()
-class CALLOFTHEMOUTAINS_API AItemPickup : public AActor
+class CALLOFTHEMOUTAINS_API AItemPickup : public AActor, public IWorldStateInterface
 {
 	GENERATED_BODY()
 
 public:
 	AItemPickup();
 
+	virtual void OnConstruction(const FTransform& Transform) override;
+#if WITH_EDITOR
+	virtual void PostEditImport() override;
+#endif
+
+	// ==================== World State ====================
+
+	virtual FGuid GetWorldStateGuid() const override { return WorldStateGuid; }
+	virtual uint32 CaptureWorldState() const override;
+	virtual void RestoreWorldState(uint32 State) override;
+
 protected:
 	virtual void BeginPlay() override;
-	virtual void Tick(float DeltaTime) override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:
 	// ==================== Components ====================
@@ -83,6 +96,10 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Item|Light")
 	float LightRadius = 200.0f;
 
+	/** Save game id (assigned when placed in the editor) */
+	UPROPERTY(VisibleAnywhere, Category = "Item|WorldState", AdvancedDisplay)
+	FGuid WorldStateGuid;
+
 	// ==================== Events ====================
 
 	UPROPERTY(BlueprintAssignable, Category = "Item")
@@ -90,10 +107,13 @@ public:
 
 	// ==================== Functions ====================
 
-	/** Get the item data for this pickup */
+	/** Get a copy of the item data for this pickup (Blueprint wrapper - C++ should use FindItemData) */
 	UFUNCTION(BlueprintCallable, Category = "Item")
 	bool GetItemData(FItemData& OutItemData) const;
 
+	/** Item data row for this pickup without copying (nullptr if not found) */
+	const FItemData* FindItemData() const;
+
 	/** Get the interaction prompt text */
 	UFUNCTION(BlueprintCallable, Category = "Item")
 	FText GetPickupPrompt() const;
@@ -151,18 +171,12 @@ private:
 	/** Show the pickup */
 	void ShowPickup();
 
-	/** Handle E key input for pickup */
-	void CheckForPickupInput();
-
 	// State
 	bool bIsCollected = false;
 
 	UPROPERTY()
 	APawn* OverlappingPawn = nullptr;
 
-	// Input tracking
-	bool bEKeyWasDown = false;
-
 	// Timer handle for respawn
 	FTimerHandle RespawnTimerHandle;
 };
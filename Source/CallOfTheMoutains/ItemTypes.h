@@ -314,6 +314,41 @@ struct FItemData : public FTableRowBase
 	bool IsToggleItem() const { return bIsToggleItem; }
 };
 
+/**
+ * Hot subset of FItemData, flattened by the item database into a dense array.
+ * Gameplay loops (stacking, filtering, weight, stats, weapon types) read this
+ * instead of touching the full row with its text and soft asset references.
+ */
+struct FItemHotData
+{
+	FItemStats Stats;
+	int32 MaxStackSize = 1;
+	EItemCategory Category = EItemCategory::None;
+	EEquipmentSlot EquipmentSlot = EEquipmentSlot::None;
+	EWeaponType WeaponType = EWeaponType::None;
+	EItemRarity Rarity = EItemRarity::Common;
+
+	/** Position of the display name in culture-aware collation order (set by the item database) */
+	uint16 NameSortRank = 0;
+
+	FItemHotData() = default;
+
+	explicit FItemHotData(const FItemData& ItemData)
+		: Stats(ItemData.Stats)
+		, MaxStackSize(ItemData.MaxStackSize)
+		, Category(ItemData.Category)
+		, EquipmentSlot(ItemData.EquipmentSlot)
+		, WeaponType(ItemData.WeaponType)
+		, Rarity(ItemData.Rarity)
+	{
+	}
+
+	bool IsEquipment() const { return Category == EItemCategory::Equipment && EquipmentSlot != EEquipmentSlot::None; }
+	bool IsConsumable() const { return Category == EItemCategory::Consumable; }
+	bool IsWeapon() const { return EquipmentSlot == EEquipmentSlot::PrimaryWeapon || EquipmentSlot == EEquipmentSlot::OffHand; }
+	bool IsStackable() const { return MaxStackSize > 1; }
+};
+
 /**
  * Inventory slot - holds item reference and quantity
  */
@@ -328,8 +363,26 @@ struct FInventorySlot
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, SaveGame, Category = "Inventory")
 	int32 Quantity = 0;
 
+	/** When items were last added to this slot (higher = more recent) - used by the Recent sort */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, SaveGame, Category = "Inventory")
+	int32 AcquiredOrder = 0;
+
 	bool IsEmpty() const { return ItemID.IsNone() || Quantity <= 0; }
-	void Clear() { ItemID = NAME_None; Quantity = 0; }
+	void Clear() { ItemID = NAME_None; Quantity = 0; AcquiredOrder = 0; }
+};
+
+/**
+ * Inventory sort modes
+ * Every mode falls back to category, then display name
+ */
+UENUM(BlueprintType)
+enum class EInventorySortMode : uint8
+{
+	Category		UMETA(DisplayName = "Category"),
+	Weight			UMETA(DisplayName = "Weight (Heaviest First)"),
+	Rarity			UMETA(DisplayName = "Rarity (Rarest First)"),
+	Damage			UMETA(DisplayName = "Damage (Highest First)"),
+	Recent			UMETA(DisplayName = "Recently Acquired")
 };
 
 /**
@@ -1,6 +1,7 @@
 // CallOfTheMoutains - Lamp Actor Implementation
 
 #include "LampActor.h"
+#include "WorldStateSubsystem.h"
 #include "Components/PointLightComponent.h"
 #include "Components/StaticMeshComponent.h"
 #include "Components/SceneComponent.h"
@@ -33,6 +34,22 @@ ALampActor::ALampActor()
 	LampLight->SetVisibility(false);
 }
 
+void ALampActor::OnConstruction(const FTransform& Transform)
+{
+	Super::OnConstruction(Transform);
+
+	UWorldStateSubsystem::AssignEditorGuid(this, WorldStateGuid);
+}
+
+#if WITH_EDITOR
+void ALampActor::PostEditImport()
+{
+	Super::PostEditImport();
+
+	UWorldStateSubsystem::RegenerateImportedGuid(WorldStateGuid);
+}
+#endif
+
 void ALampActor::BeginPlay()
 {
 	Super::BeginPlay();
@@ -43,6 +60,16 @@ void ALampActor::BeginPlay()
 
 	// Ensure lamp starts in the correct state
 	UpdateLightState();
+
+	// Restore saved state
+	UWorldStateSubsystem::ResolveAndRegister(this, WorldStateGuid);
+}
+
+void ALampActor::RestoreWorldState(uint32 State)
+{
+	// Silent - no on/off sound when loading
+	bIsLampOn = (State & 1) != 0;
+	UpdateLightState();
 }
 
 void ALampActor::ToggleLamp()
@@ -63,6 +90,7 @@ void ALampActor::TurnOn()
 	{
 		bIsLampOn = true;
 		UpdateLightState();
+		UWorldStateSubsystem::NotifyStateChanged(this);
 
 		// Play turn on sound
 		if (TurnOnSound)
@@ -78,6 +106,7 @@ void ALampActor::TurnOff()
 	{
 		bIsLampOn = false;
 		UpdateLightState();
+		UWorldStateSubsystem::NotifyStateChanged(this);
 
 		// Play turn off sound
 		if (TurnOffSound)
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "WorldStateInterface.h"
 #include "LampActor.generated.h"
 
 class UPointLightComponent;
@@ -19,15 +20,27 @@ class USoundBase;
  * - Toggle on/off functionality
  * - Attaches to player's hand socket when equipped
  * - Configurable light color, intensity, and radius
+ * - On/off state persists in save games when placed in a level
  */
 UCLASS(Blueprintable)
-class CALLOFTHEMOUTAINS_API ALampActor : public AActor
+class CALLOFTHEMOUTAINS_API ALampActor : public AActor, public IWorldStateInterface
 {
 	GENERATED_BODY()
 
 public:
 	ALampActor();
 
+	virtual void OnConstruction(const FTransform& Transform) override;
+#if WITH_EDITOR
+	virtual void PostEditImport() override;
+#endif
+
+	// ==================== World State ====================
+
+	virtual FGuid GetWorldStateGuid() const override { return WorldStateGuid; }
+	virtual uint32 CaptureWorldState() const override { return bIsLampOn ? 1 : 0; }
+	virtual void RestoreWorldState(uint32 State) override;
+
 protected:
 	virtual void BeginPlay() override;
 
@@ -68,6 +81,10 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lamp")
 	FName AttachSocketName = TEXT("weapon_l");
 
+	/** Save game id (assigned when placed in the editor; spawned lamps aren't persisted) */
+	UPROPERTY(VisibleAnywhere, Category = "Lamp|WorldState", AdvancedDisplay)
+	FGuid WorldStateGuid;
+
 	// ==================== Audio ====================
 
 	/** Sound to play when lamp turns on */
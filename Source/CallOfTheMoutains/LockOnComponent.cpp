@@ -2,12 +2,20 @@
 
 #include "LockOnComponent.h"
 #include "TargetableComponent.h"
+#include "TargetSpatialHash.h"
+#include "CallOfTheMoutains.h"
 #include "HealthComponent.h"
+#include "DamageableRegistry.h"
 #include "GameFramework/Character.h"
 #include "Kismet/GameplayStatics.h"
 #include "Kismet/KismetMathLibrary.h"
 #include "DrawDebugHelpers.h"
 #include "Engine/World.h"
+#include "WorldCollision.h"
+
+DECLARE_CYCLE_STAT(TEXT("Lock On Target Query"), STAT_LockOnTargetQuery, STATGROUP_CallOfTheMoutains);
+DECLARE_CYCLE_STAT(TEXT("Lock On Overlap Query"), STAT_LockOnOverlapQuery, STATGROUP_CallOfTheMoutains);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Lock On LOS Traces"), STAT_LockOnLineOfSightTraces, STATGROUP_CallOfTheMoutains);
 
 ULockOnComponent::ULockOnComponent()
 {
@@ -23,16 +31,35 @@ void ULockOnComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActo
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
+	// Candidate traces submitted last frame (acquire/switch/retarget)
+	ResolvePendingCandidates();
+
+	// While a retarget is pending the dead target is held (no LOS traces, no validity check)
+	// until the candidates resolve, so listeners see a single Acquired or Lost
+	if (CurrentTarget && !bRetargetPending)
+	{
+		UpdateCurrentTargetLineOfSight(DeltaTime);
+	}
+
 	// Check if current target is still valid
-	if (CurrentTarget && !IsTargetValid())
+	if (CurrentTarget && !bRetargetPending && !IsTargetValid())
 	{
-		// If target died and auto-retarget is enabled, try to find a nearby target
+		// If target died and auto-retarget is enabled, try to find a nearby target.
+		// A synchronous switch leaves a valid target; an async one resolves next frame.
 		if (bAutoRetargetOnDeath && IsTargetDead())
 		{
 			if (!TrySwitchToNearbyTarget())
 			{
 				ReleaseLockOn();
 			}
+			else if (PendingCandidates.Num() > 0)
+			{
+				bRetargetPending = true;
+			}
+			else if (!IsTargetValid())
+			{
+				ReleaseLockOn();
+			}
 		}
 		else
 		{
@@ -54,15 +81,15 @@ void ULockOnComponent::ToggleLockOn()
 {
 	if (IsLockedOn())
 	{
+		PendingCandidates.Reset();
+		PendingCandidateHandles.Reset();
 		ReleaseLockOn();
 	}
 	else
 	{
-		AActor* BestTarget = FindBestTarget();
-		if (BestTarget)
-		{
-			LockOnToTarget(BestTarget);
-		}
+		TArray<UTargetableComponent*> Ranked;
+		RankBestTargets(Ranked);
+		SelectFirstVisibleTarget(Ranked);
 	}
 }
 
@@ -73,17 +100,32 @@ bool ULockOnComponent::LockOnToTarget(AActor* Target)
 		return false;
 	}
 
-	UTargetableComponent* TargetComp = Target->FindComponentByClass<UTargetableComponent>();
-	if (!TargetComp || !TargetComp->IsTargetable())
+	UTargetSpatialHash* SpatialHash = UTargetSpatialHash::Get(this);
+	UTargetableComponent* TargetComp = SpatialHash ? SpatialHash->FindTarget(Target) : nullptr;
+	if (!TargetComp)
+	{
+		TargetComp = Target->FindComponentByClass<UTargetableComponent>();
+	}
+
+	return LockOnToTargetComponent(TargetComp);
+}
+
+bool ULockOnComponent::LockOnToTargetComponent(UTargetableComponent* TargetComp)
+{
+	AActor* Target = TargetComp ? TargetComp->GetOwner() : nullptr;
+	if (!Target || !TargetComp->IsTargetable())
 	{
 		return false;
 	}
 
-	// Release previous target
-	if (CurrentTarget)
+	// Hand over from the previous target - a switch only broadcasts OnLockOnAcquired
+	if (CurrentTargetComponent)
 	{
-		ReleaseLockOn();
+		CurrentTargetComponent->NotifyTargetLost();
 	}
+	CurrentTargetTraceHandle = FTraceHandle();
+	TimeWithoutLineOfSight = 0.0f;
+	bRetargetPending = false;
 
 	// Set new target
 	CurrentTarget = Target;
@@ -108,6 +150,9 @@ void ULockOnComponent::ReleaseLockOn()
 	AActor* OldTarget = CurrentTarget;
 	CurrentTarget = nullptr;
 	CurrentTargetComponent = nullptr;
+	CurrentTargetTraceHandle = FTraceHandle();
+	TimeWithoutLineOfSight = 0.0f;
+	bRetargetPending = false;
 
 	if (OldTarget)
 	{
@@ -122,33 +167,36 @@ void ULockOnComponent::SwitchTarget(float Direction)
 		return;
 	}
 
-	TArray<AActor*> AllTargets = FindAllTargetsInRange();
+	TArray<UTargetableComponent*> Ranked;
+	RankSwitchTargets(Direction, Ranked);
+	SelectFirstVisibleTarget(Ranked);
+}
 
-	// Remove current target from list
-	AllTargets.Remove(CurrentTarget);
+void ULockOnComponent::RankSwitchTargets(float Direction, TArray<UTargetableComponent*>& OutRanked) const
+{
+	OutRanked = FindAllTargetsInRange();
 
-	if (AllTargets.Num() == 0)
-	{
-		return;
-	}
+	// Remove current target from list
+	OutRanked.Remove(CurrentTargetComponent);
 
-	// Simple cycling: just pick the next target in the list
-	// For directional switching, sort by angle to camera right vector
 	AActor* TraceOwner = GetTraceOwner();
-	if (!TraceOwner)
+	if (OutRanked.Num() == 0 || !TraceOwner || !CurrentTarget)
 	{
+		OutRanked.Reset();
 		return;
 	}
 
+	// Directional switching: score by how far to the right (or left) of the current target
 	FVector PlayerLocation = TraceOwner->GetActorLocation();
 	FVector PlayerRight = TraceOwner->GetActorRightVector();
 	FVector ToCurrentTarget = (CurrentTarget->GetActorLocation() - PlayerLocation).GetSafeNormal();
 
-	AActor* BestTarget = AllTargets[0]; // Default to first
-	float BestScore = -FLT_MAX;
+	TMap<UTargetableComponent*, float> Scores;
+	Scores.Reserve(OutRanked.Num());
 
-	for (AActor* Target : AllTargets)
+	for (UTargetableComponent* TargetComp : OutRanked)
 	{
+		AActor* Target = TargetComp->GetOwner();
 		FVector ToTarget = (Target->GetActorLocation() - PlayerLocation).GetSafeNormal();
 
 		// Score based on how much to the right (or left) this target is relative to current
@@ -156,19 +204,13 @@ void ULockOnComponent::SwitchTarget(float Direction)
 
 		// Distance tiebreaker - prefer closer
 		float Distance = FVector::Dist(PlayerLocation, Target->GetActorLocation());
-		float Score = AngleScore - (Distance * 0.0001f);
-
-		if (Score > BestScore)
-		{
-			BestScore = Score;
-			BestTarget = Target;
-		}
+		Scores.Add(TargetComp, AngleScore - (Distance * 0.0001f));
 	}
 
-	if (BestTarget)
+	OutRanked.Sort([&Scores](const UTargetableComponent& A, const UTargetableComponent& B)
 	{
-		LockOnToTarget(BestTarget);
-	}
+		return Scores.FindRef(&A) > Scores.FindRef(&B);
+	});
 }
 
 FVector ULockOnComponent::GetTargetLookAtLocation() const
@@ -203,17 +245,14 @@ AActor* ULockOnComponent::GetTraceOwner() const
 	return OverrideOwner ? OverrideOwner : GetOwner();
 }
 
-AActor* ULockOnComponent::FindBestTarget() const
+void ULockOnComponent::RankBestTargets(TArray<UTargetableComponent*>& OutRanked) const
 {
-	TArray<AActor*> AllTargets = FindAllTargetsInRange();
-
-	AActor* BestTarget = nullptr;
-	float BestScore = -FLT_MAX;
+	OutRanked.Reset();
 
 	AActor* TraceOwner = GetTraceOwner();
 	if (!TraceOwner)
 	{
-		return nullptr;
+		return;
 	}
 
 	FVector PlayerLocation = TraceOwner->GetActorLocation();
@@ -228,10 +267,26 @@ AActor* ULockOnComponent::FindBestTarget() const
 		}
 	}
 
-	for (AActor* Target : AllTargets)
+	// Spatial hash does the range + cone filter in one pass; the overlap path is filtered by angle below
+	TArray<UTargetableComponent*> AllTargets;
+	UTargetSpatialHash* SpatialHash = bUseSpatialHash ? UTargetSpatialHash::Get(this) : nullptr;
+	if (SpatialHash)
+	{
+		SCOPE_CYCLE_COUNTER(STAT_LockOnTargetQuery);
+		SpatialHash->QueryTargetsInCone(PlayerLocation, PlayerForward, MaxLockOnDistance, MaxLockOnAngle, AllTargets, TraceOwner);
+	}
+	else
+	{
+		AllTargets = FindAllTargetsInRangeOverlap();
+	}
+
+	TMap<UTargetableComponent*, float> Scores;
+	Scores.Reserve(AllTargets.Num());
+
+	for (UTargetableComponent* TargetComp : AllTargets)
 	{
-		UTargetableComponent* TargetComp = Target->FindComponentByClass<UTargetableComponent>();
-		if (!TargetComp)
+		AActor* Target = TargetComp->GetOwner();
+		if (Target == GetOwner())
 		{
 			continue;
 		}
@@ -241,7 +296,7 @@ AActor* ULockOnComponent::FindBestTarget() const
 		ToTarget.Normalize();
 
 		// Calculate angle from forward
-		float DotProduct = FVector::DotProduct(PlayerForward, ToTarget);
+		float DotProduct = FMath::Clamp(FVector::DotProduct(PlayerForward, ToTarget), -1.0f, 1.0f);
 		float Angle = FMath::Acos(DotProduct) * (180.0f / PI);
 
 		// Skip if outside max angle
@@ -257,19 +312,130 @@ AActor* ULockOnComponent::FindBestTarget() const
 
 		float TotalScore = (AngleScore * 0.5f) + (DistanceScore * 0.3f) + (PriorityScore * 0.2f);
 
-		if (TotalScore > BestScore)
+		Scores.Add(TargetComp, TotalScore);
+		OutRanked.Add(TargetComp);
+	}
+
+	OutRanked.Sort([&Scores](const UTargetableComponent& A, const UTargetableComponent& B)
+	{
+		return Scores.FindRef(&A) > Scores.FindRef(&B);
+	});
+}
+
+bool ULockOnComponent::SelectFirstVisibleTarget(const TArray<UTargetableComponent*>& Ranked)
+{
+	PendingCandidates.Reset();
+	PendingCandidateHandles.Reset();
+
+	if (Ranked.Num() == 0)
+	{
+		return false;
+	}
+
+	if (!bRequireLineOfSight)
+	{
+		return LockOnToTargetComponent(Ranked[0]);
+	}
+
+	// One submission for the whole query - all candidate traces go out this frame
+	PendingCandidatesFrame = GFrameCounter;
+	const int32 NumCandidates = FMath::Min(Ranked.Num(), MaxLineOfSightCandidates);
+	for (int32 i = 0; i < NumCandidates; ++i)
+	{
+		PendingCandidates.Add(Ranked[i]);
+		PendingCandidateHandles.Add(SubmitLineOfSightTrace(Ranked[i]->GetOwner()));
+	}
+
+	return true;
+}
+
+void ULockOnComponent::ResolvePendingCandidates()
+{
+	// Async trace data only exists from the frame after submission - the component
+	// can tick again in the submit frame (e.g. input before tick), so wait for a later one
+	if (PendingCandidates.Num() == 0 || GFrameCounter <= PendingCandidatesFrame)
+	{
+		return;
+	}
+
+	UTargetableComponent* Selected = nullptr;
+
+	// Candidates are ranked, so the first clear one wins; a candidate whose data is missing
+	// a frame later (expired handle, destroyed actor) is dropped rather than counted as blocked
+	for (int32 i = 0; i < PendingCandidates.Num(); ++i)
+	{
+		UTargetableComponent* Candidate = PendingCandidates[i].Get();
+		bool bClear = false;
+		if (Candidate && Candidate->IsTargetable() && QueryLineOfSightResult(PendingCandidateHandles[i], bClear) && bClear)
 		{
-			BestScore = TotalScore;
-			BestTarget = Target;
+			Selected = Candidate;
+			break;
 		}
 	}
 
-	return BestTarget;
+	PendingCandidates.Reset();
+	PendingCandidateHandles.Reset();
+
+	if (Selected && LockOnToTargetComponent(Selected))
+	{
+		return;
+	}
+
+	// Nothing visible to retarget to - now the dead target is really lost
+	if (bRetargetPending)
+	{
+		ReleaseLockOn();
+	}
+}
+
+void ULockOnComponent::UpdateCurrentTargetLineOfSight(float DeltaTime)
+{
+	if (!bRequireLineOfSight)
+	{
+		TimeWithoutLineOfSight = 0.0f;
+		return;
+	}
+
+	// Hysteresis: a blocked result only accumulates time, IsTargetValid breaks lock past the tolerance
+	bool bClear = false;
+	if (CurrentTargetTraceHandle.IsValid() && QueryLineOfSightResult(CurrentTargetTraceHandle, bClear))
+	{
+		TimeWithoutLineOfSight = bClear ? 0.0f : TimeWithoutLineOfSight + DeltaTime;
+	}
+
+	CurrentTargetTraceHandle = SubmitLineOfSightTrace(CurrentTarget);
+}
+
+TArray<UTargetableComponent*> ULockOnComponent::FindAllTargetsInRange() const
+{
+	UTargetSpatialHash* SpatialHash = bUseSpatialHash ? UTargetSpatialHash::Get(this) : nullptr;
+	if (!SpatialHash)
+	{
+		return FindAllTargetsInRangeOverlap();
+	}
+
+	TArray<UTargetableComponent*> ValidTargets;
+
+	AActor* TraceOwner = GetTraceOwner();
+	if (!TraceOwner)
+	{
+		return ValidTargets;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_LockOnTargetQuery);
+
+	SpatialHash->QueryTargetsInRadius(TraceOwner->GetActorLocation(), MaxLockOnDistance, ValidTargets, TraceOwner);
+	ValidTargets.RemoveAllSwap([this](const UTargetableComponent* TargetComp)
+	{
+		return TargetComp->GetOwner() == GetOwner();
+	});
+
+	return ValidTargets;
 }
 
-TArray<AActor*> ULockOnComponent::FindAllTargetsInRange() const
+TArray<UTargetableComponent*> ULockOnComponent::FindAllTargetsInRangeOverlap() const
 {
-	TArray<AActor*> ValidTargets;
+	TArray<UTargetableComponent*> ValidTargets;
 
 	AActor* TraceOwner = GetTraceOwner();
 	if (!TraceOwner)
@@ -277,6 +443,8 @@ TArray<AActor*> ULockOnComponent::FindAllTargetsInRange() const
 		return ValidTargets;
 	}
 
+	SCOPE_CYCLE_COUNTER(STAT_LockOnOverlapQuery);
+
 	FVector PlayerLocation = TraceOwner->GetActorLocation();
 
 	// Use ObjectType query to find pawns AND world dynamic actors (like Endless Front BearCharacter does)
@@ -315,7 +483,7 @@ TArray<AActor*> ULockOnComponent::FindAllTargetsInRange() const
 				continue;
 			}
 
-			ValidTargets.Add(OverlapActor);
+			ValidTargets.AddUnique(TargetComp);
 		}
 	}
 
@@ -347,6 +515,12 @@ bool ULockOnComponent::IsTargetValid() const
 		return false;
 	}
 
+	// Line of sight blocked for longer than the tolerance
+	if (bRequireLineOfSight && TimeWithoutLineOfSight > LineOfSightLossTolerance)
+	{
+		return false;
+	}
+
 	return true;
 }
 
@@ -365,19 +539,18 @@ float ULockOnComponent::GetAngleToTarget(AActor* Target) const
 	return FMath::Acos(DotProduct) * (180.0f / PI);
 }
 
-bool ULockOnComponent::HasLineOfSightTo(AActor* Target) const
+FTraceHandle ULockOnComponent::SubmitLineOfSightTrace(AActor* Target) const
 {
 	AActor* TraceOwner = GetTraceOwner();
 	if (!Target || !TraceOwner)
 	{
-		return false;
+		return FTraceHandle();
 	}
 
 	FVector Start = TraceOwner->GetActorLocation() + FVector(0, 0, 50.0f); // Eye level
 	FVector End = Target->GetActorLocation() + FVector(0, 0, 50.0f);
 
-	FHitResult HitResult;
-	FCollisionQueryParams QueryParams;
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(LockOnLineOfSight), false);
 	QueryParams.AddIgnoredActor(TraceOwner);
 	QueryParams.AddIgnoredActor(GetOwner());
 	QueryParams.AddIgnoredActor(Target);
@@ -388,16 +561,28 @@ bool ULockOnComponent::HasLineOfSightTo(AActor* Target) const
 		QueryParams.AddIgnoredActor(CurrentTarget);
 	}
 
-	bool bHit = GetWorld()->LineTraceSingleByChannel(
-		HitResult,
+	INC_DWORD_STAT(STAT_LockOnLineOfSightTraces);
+
+	return GetWorld()->AsyncLineTraceByChannel(
+		EAsyncTraceType::Single,
 		Start,
 		End,
 		ECC_Visibility,
 		QueryParams
 	);
+}
+
+bool ULockOnComponent::QueryLineOfSightResult(const FTraceHandle& Handle, bool& bOutClear) const
+{
+	FTraceDatum TraceData;
+	if (!Handle.IsValid() || !GetWorld()->QueryTraceData(Handle, TraceData))
+	{
+		return false;
+	}
 
-	// No hit means clear line of sight
-	return !bHit;
+	// No blocking hit means clear line of sight
+	bOutClear = !TraceData.OutHits.ContainsByPredicate([](const FHitResult& Hit) { return Hit.bBlockingHit; });
+	return true;
 }
 
 bool ULockOnComponent::IsTargetDead() const
@@ -408,7 +593,7 @@ bool ULockOnComponent::IsTargetDead() const
 	}
 
 	// Check if target has a HealthComponent and is dead
-	UHealthComponent* HealthComp = CurrentTarget->FindComponentByClass<UHealthComponent>();
+	UHealthComponent* HealthComp = UDamageableRegistry::GetHealthComponent(CurrentTarget);
 	if (HealthComp && HealthComp->IsDead())
 	{
 		return true;
@@ -432,35 +617,23 @@ bool ULockOnComponent::TrySwitchToNearbyTarget()
 	}
 
 	// Get all valid targets in range (excluding the current one)
-	TArray<AActor*> AllTargets = FindAllTargetsInRange();
-	AllTargets.Remove(CurrentTarget);
+	TArray<UTargetableComponent*> AllTargets = FindAllTargetsInRange();
+	AllTargets.Remove(CurrentTargetComponent);
 
 	if (AllTargets.Num() == 0)
 	{
 		return false;
 	}
 
-	// Find the closest target to the current target's position (not to the player)
+	// Rank by distance to the current target's position (not to the player)
 	// This gives a more natural "next enemy" feel
 	FVector CurrentTargetLocation = CurrentTarget ? CurrentTarget->GetActorLocation() : TraceOwner->GetActorLocation();
 
-	AActor* ClosestTarget = nullptr;
-	float ClosestDistance = FLT_MAX;
-
-	for (AActor* Target : AllTargets)
-	{
-		float Distance = FVector::Dist(CurrentTargetLocation, Target->GetActorLocation());
-		if (Distance < ClosestDistance)
-		{
-			ClosestDistance = Distance;
-			ClosestTarget = Target;
-		}
-	}
-
-	if (ClosestTarget)
+	AllTargets.Sort([&CurrentTargetLocation](const UTargetableComponent& A, const UTargetableComponent& B)
 	{
-		return LockOnToTarget(ClosestTarget);
-	}
+		return FVector::DistSquared(CurrentTargetLocation, A.GetOwner()->GetActorLocation())
+			< FVector::DistSquared(CurrentTargetLocation, B.GetOwner()->GetActorLocation());
+	});
 
-	return false;
+	return SelectFirstVisibleTarget(AllTargets);
 }
@@ -51,13 +51,29 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lock On|Settings")
 	FVector CameraTargetOffset = FVector(0.0f, 0.0f, 50.0f);
 
+	/** Require line of sight to acquire and keep a target (checked with async traces, resolved next frame) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lock On|Settings")
+	bool bRequireLineOfSight = true;
+
+	/** How long line of sight can stay blocked before lock breaks (seconds) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lock On|Settings", meta = (ClampMin = "0.0", EditCondition = "bRequireLineOfSight"))
+	float LineOfSightLossTolerance = 0.5f;
+
+	/** Max candidates line-of-sight tested per acquire/switch query (best-scored first) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lock On|Settings", meta = (ClampMin = "1", EditCondition = "bRequireLineOfSight"))
+	int32 MaxLineOfSightCandidates = 6;
+
+	/** Query the world's target spatial hash instead of a physics overlap (disable to compare costs via "stat CallOfTheMoutains") */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lock On|Settings")
+	bool bUseSpatialHash = true;
+
 	/** Enable debug drawing */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lock On|Debug")
 	bool bDebugDraw = false;
 
 	// ==================== Functions ====================
 
-	/** Toggle lock-on (finds nearest target or releases current) */
+	/** Toggle lock-on (finds nearest target or releases current). With line of sight required, the lock lands next frame. */
 	UFUNCTION(BlueprintCallable, Category = "Lock On")
 	void ToggleLockOn();
 
@@ -105,7 +121,7 @@ public:
 
 	DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnLockOnStateChanged, AActor*, Target);
 
-	/** Called when lock-on is acquired */
+	/** Called when lock-on is acquired (also on a switch - the previous target gets no OnLockOnLost) */
 	UPROPERTY(BlueprintAssignable, Category = "Lock On")
 	FOnLockOnStateChanged OnLockOnAcquired;
 
@@ -123,11 +139,45 @@ private:
 	UPROPERTY()
 	AActor* OverrideOwner = nullptr;
 
-	/** Find the best target to lock onto */
-	AActor* FindBestTarget() const;
+	/** Async line-of-sight trace on the current target (resolved next tick) */
+	FTraceHandle CurrentTargetTraceHandle;
+
+	/** Consecutive time the current target's line of sight has been blocked */
+	float TimeWithoutLineOfSight = 0.0f;
+
+	/** Ranked candidates awaiting line-of-sight results, and their traces (same order) */
+	TArray<TWeakObjectPtr<UTargetableComponent>> PendingCandidates;
+	TArray<FTraceHandle> PendingCandidateHandles;
+
+	/** GFrameCounter when the candidate traces were submitted (results readable from the next frame) */
+	uint64 PendingCandidatesFrame = 0;
 
-	/** Find all valid targets in range */
-	TArray<AActor*> FindAllTargetsInRange() const;
+	/** Current target died and retarget candidates are in flight - OnLockOnLost is held until they resolve */
+	bool bRetargetPending = false;
+
+	/** Candidates for a fresh lock, best first */
+	void RankBestTargets(TArray<UTargetableComponent*>& OutRanked) const;
+
+	/** Candidates for a directional switch, best first */
+	void RankSwitchTargets(float Direction, TArray<UTargetableComponent*>& OutRanked) const;
+
+	/** Lock the first visible candidate - immediately, or next tick once the batched traces resolve */
+	bool SelectFirstVisibleTarget(const TArray<UTargetableComponent*>& Ranked);
+
+	/** Consume last frame's candidate traces and lock the best visible one */
+	void ResolvePendingCandidates();
+
+	/** Consume last frame's current-target trace, update the hysteresis timer and submit the next trace */
+	void UpdateCurrentTargetLineOfSight(float DeltaTime);
+
+	/** Find all valid targets in range (spatial hash, or physics overlap fallback) */
+	TArray<UTargetableComponent*> FindAllTargetsInRange() const;
+
+	/** Physics overlap path used when the spatial hash is unavailable or disabled */
+	TArray<UTargetableComponent*> FindAllTargetsInRangeOverlap() const;
+
+	/** Lock onto an already-resolved targetable component */
+	bool LockOnToTargetComponent(UTargetableComponent* TargetComp);
 
 	/** Check if target is still valid */
 	bool IsTargetValid() const;
@@ -135,12 +185,15 @@ private:
 	/** Check if target is dead (for auto-retarget logic) */
 	bool IsTargetDead() const;
 
-	/** Try to switch to a nearby target. Returns true if switched successfully. */
+	/** Try to switch to a nearby target. Returns true if switched, or if candidates are awaiting line-of-sight results. */
 	bool TrySwitchToNearbyTarget();
 
 	/** Get the angle to a target from player's forward vector */
 	float GetAngleToTarget(AActor* Target) const;
 
-	/** Check line of sight to target */
-	bool HasLineOfSightTo(AActor* Target) const;
+	/** Submit an async line-of-sight trace to target */
+	FTraceHandle SubmitLineOfSightTrace(AActor* Target) const;
+
+	/** Read a line-of-sight trace submitted last frame. Returns false if the result isn't available. */
+	bool QueryLineOfSightResult(const FTraceHandle& Handle, bool& bOutClear) const;
 };
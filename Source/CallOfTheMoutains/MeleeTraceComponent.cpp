@@ -1,14 +1,20 @@
 // CallOfTheMoutains - Melee Trace Component Implementation
 
 #include "MeleeTraceComponent.h"
+#include "MeleeTraceSubsystem.h"
+#include "CallOfTheMoutains.h"
 #include "EquipmentComponent.h"
 #include "HealthComponent.h"
+#include "DamageableRegistry.h"
 #include "ItemTypes.h"
 #include "GameFramework/Character.h"
 #include "Components/SkeletalMeshComponent.h"
-#include "Kismet/KismetSystemLibrary.h"
 #include "Kismet/GameplayStatics.h"
 #include "DrawDebugHelpers.h"
+#include "Engine/World.h"
+#include "Engine/OverlapResult.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Melee Scene Queries"), STAT_MeleeSceneQueries, STATGROUP_CallOfTheMoutains);
 
 UMeleeTraceComponent::UMeleeTraceComponent()
 {
@@ -38,6 +44,17 @@ void UMeleeTraceComponent::BeginPlay()
 	ActorsToIgnore.AddUnique(GetOwner());
 }
 
+void UMeleeTraceComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	// Make sure the subsystem never dispatches to a dead component
+	if (UMeleeTraceSubsystem* TraceSubsystem = UMeleeTraceSubsystem::Get(this))
+	{
+		TraceSubsystem->UnregisterTrace(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void UMeleeTraceComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
@@ -58,7 +75,7 @@ void UMeleeTraceComponent::StartTrace()
 	UE_LOG(LogTemp, Warning, TEXT("MeleeTrace: StartTrace called - MeshSource: %s, StartSocket: %s, TraceMode: %s"),
 		MeshSource == EMeleeTraceMeshSource::WeaponMesh ? TEXT("WeaponMesh") : TEXT("CharacterMesh"),
 		*StartSocket.ToString(),
-		TraceMode == EMeleeTraceMode::Linear ? TEXT("Linear") : TEXT("Spherical"));
+		*UEnum::GetValueAsString(TraceMode));
 
 	// Re-cache equipment component if needed (controller might not have been ready at BeginPlay)
 	if (!CachedEquipmentComponent)
@@ -73,11 +90,22 @@ void UMeleeTraceComponent::StartTrace()
 	}
 
 	bIsTracing = true;
+	++TraceGeneration;
 	bHasPreviousLocations = false;
 	HitActorsThisTrace.Empty();
+	SceneQueryCount = 0;
+	RefreshQueryParams();
 
-	// Enable tick
-	SetComponentTickEnabled(true);
+	// Batch with every other active trace, or tick ourselves if the subsystem is unavailable
+	UMeleeTraceSubsystem* TraceSubsystem = bUseTraceSubsystem ? UMeleeTraceSubsystem::Get(this) : nullptr;
+	if (TraceSubsystem)
+	{
+		TraceSubsystem->RegisterTrace(this);
+	}
+	else
+	{
+		SetComponentTickEnabled(true);
+	}
 
 	// Broadcast event
 	OnMeleeTraceStarted.Broadcast();
@@ -89,7 +117,7 @@ void UMeleeTraceComponent::StartTrace()
 		UE_LOG(LogTemp, Warning, TEXT("MeleeTrace: Found start socket at %s"), *StartLoc.ToString());
 		PrevStartLocation = StartLoc;
 
-		if (TraceMode == EMeleeTraceMode::Linear && GetSocketLocation(EndSocket, EndLoc))
+		if (UsesEndSocket() && GetSocketLocation(EndSocket, EndLoc))
 		{
 			PrevEndLocation = EndLoc;
 		}
@@ -114,7 +142,11 @@ void UMeleeTraceComponent::StopTrace()
 	bIsTracing = false;
 	bHasPreviousLocations = false;
 
-	// Disable tick
+	// Leave the batch / disable tick
+	if (UMeleeTraceSubsystem* TraceSubsystem = UMeleeTraceSubsystem::Get(this))
+	{
+		TraceSubsystem->UnregisterTrace(this);
+	}
 	SetComponentTickEnabled(false);
 
 	// Broadcast event
@@ -194,20 +226,45 @@ bool UMeleeTraceComponent::GetSocketLocation(FName SocketName, FVector& OutLocat
 }
 
 void UMeleeTraceComponent::PerformTrace()
+{
+	TArray<FMeleeTraceQuery> Queries;
+	if (!BuildTraceQueries(Queries))
+	{
+		return;
+	}
+
+	// Run this component's queries immediately (subsystem batching bypassed)
+	TArray<FOverlapResult> Overlaps;
+	TArray<FHitResult> Hits;
+	for (const FMeleeTraceQuery& Query : Queries)
+	{
+		ExecuteQuery(Query, Overlaps, Hits);
+		if (Query.bSweep)
+		{
+			ProcessSweepResults(Query, Hits);
+		}
+		else
+		{
+			ProcessOverlapResults(Query, Overlaps);
+		}
+	}
+}
+
+bool UMeleeTraceComponent::BuildTraceQueries(TArray<FMeleeTraceQuery>& OutQueries)
 {
 	FVector CurrentStartLoc, CurrentEndLoc;
 
 	// Get current socket locations
 	if (!GetSocketLocation(StartSocket, CurrentStartLoc))
 	{
-		return;
+		return false;
 	}
 
-	if (TraceMode == EMeleeTraceMode::Linear)
+	if (UsesEndSocket())
 	{
 		if (!GetSocketLocation(EndSocket, CurrentEndLoc))
 		{
-			return;
+			return false;
 		}
 	}
 	else
@@ -215,8 +272,22 @@ void UMeleeTraceComponent::PerformTrace()
 		CurrentEndLoc = CurrentStartLoc;
 	}
 
+	const int32 FirstNewQuery = OutQueries.Num();
+
+	// Swept mode covers the whole motion since last frame with its own substeps
+	if (TraceMode == EMeleeTraceMode::Swept)
+	{
+		if (bHasPreviousLocations)
+		{
+			AddSweptQueries(PrevStartLocation, PrevEndLocation, CurrentStartLoc, CurrentEndLoc, OutQueries);
+		}
+		else
+		{
+			AddSweptQueries(CurrentStartLoc, CurrentEndLoc, CurrentStartLoc, CurrentEndLoc, OutQueries);
+		}
+	}
 	// If we have previous locations, interpolate
-	if (bHasPreviousLocations)
+	else if (bHasPreviousLocations)
 	{
 		for (int32 i = 0; i <= InterpolationSteps; ++i)
 		{
@@ -227,11 +298,11 @@ void UMeleeTraceComponent::PerformTrace()
 
 			if (TraceMode == EMeleeTraceMode::Linear)
 			{
-				PerformLinearTrace(InterpStart, InterpEnd);
+				AddLinearQueries(InterpStart, InterpEnd, OutQueries);
 			}
 			else
 			{
-				PerformSphericalTrace(InterpStart);
+				AddSphericalQuery(InterpStart, OutQueries);
 			}
 		}
 	}
@@ -240,11 +311,11 @@ void UMeleeTraceComponent::PerformTrace()
 		// First frame - just do current position
 		if (TraceMode == EMeleeTraceMode::Linear)
 		{
-			PerformLinearTrace(CurrentStartLoc, CurrentEndLoc);
+			AddLinearQueries(CurrentStartLoc, CurrentEndLoc, OutQueries);
 		}
 		else
 		{
-			PerformSphericalTrace(CurrentStartLoc);
+			AddSphericalQuery(CurrentStartLoc, OutQueries);
 		}
 	}
 
@@ -252,211 +323,181 @@ void UMeleeTraceComponent::PerformTrace()
 	PrevStartLocation = CurrentStartLoc;
 	PrevEndLocation = CurrentEndLoc;
 	bHasPreviousLocations = true;
+
+	const int32 NumNewQueries = OutQueries.Num() - FirstNewQuery;
+	SceneQueryCount += NumNewQueries;
+	INC_DWORD_STAT_BY(STAT_MeleeSceneQueries, NumNewQueries);
+
+	return true;
 }
 
-void UMeleeTraceComponent::PerformLinearTrace(const FVector& Start, const FVector& End)
+void UMeleeTraceComponent::AddLinearQueries(const FVector& Start, const FVector& End, TArray<FMeleeTraceQuery>& OutQueries) const
 {
 	// Sample multiple points along the weapon and do sphere overlaps at each
 	// This follows the weapon's shape and rotation properly
 
-	TArray<AActor*> IgnoreActors = ActorsToIgnore;
-	IgnoreActors.Add(GetOwner());
-
 	// Number of sample points along the weapon (more = more accurate but slower)
 	const int32 NumSamples = 4;
-	bool bAnyHit = false;
 
 	for (int32 i = 0; i <= NumSamples; ++i)
 	{
 		float Alpha = static_cast<float>(i) / static_cast<float>(NumSamples);
-		FVector SamplePoint = FMath::Lerp(Start, End, Alpha);
-
-		TArray<AActor*> OverlappingActors;
-		bool bHit = UKismetSystemLibrary::SphereOverlapActors(
-			this,
-			SamplePoint,
-			TraceRadius,
-			ObjectTypes,
-			nullptr,
-			IgnoreActors,
-			OverlappingActors
-		);
-
-		if (bHit)
-		{
-			bAnyHit = true;
-			for (AActor* HitActor : OverlappingActors)
-			{
-				if (HitActor)
-				{
-					ProcessHitActor(HitActor, SamplePoint);
-				}
-			}
-		}
 
-		// Debug draw sphere at each sample point
-		if (bDrawDebug)
-		{
-			DrawDebugSphere(
-				GetWorld(),
-				SamplePoint,
-				TraceRadius,
-				8,
-				bHit ? FColor::Red : FColor::Green,
-				false,
-				0.0f // No duration - redraws each frame to follow sockets
-			);
-		}
+		FMeleeTraceQuery& Query = OutQueries.AddDefaulted_GetRef();
+		Query.Start = FMath::Lerp(Start, End, Alpha);
+		Query.End = Query.Start;
+		Query.Shape = FCollisionShape::MakeSphere(TraceRadius);
+		Query.bSweep = false;
 	}
 
 	// Draw line connecting the sockets
 	if (bDrawDebug)
 	{
-		DrawDebugLine(
-			GetWorld(),
-			Start,
-			End,
-			bAnyHit ? FColor::Red : FColor::Green,
-			false,
-			0.0f
-		);
+		DrawDebugLine(GetWorld(), Start, End, FColor::Green, false, 0.0f);
 	}
 }
 
-void UMeleeTraceComponent::PerformSphericalTrace(const FVector& Center)
+void UMeleeTraceComponent::AddSphericalQuery(const FVector& Center, TArray<FMeleeTraceQuery>& OutQueries) const
 {
-	// Use sphere overlap to detect both blocking AND overlapping actors
-	TArray<AActor*> OverlappingActors;
-	TArray<AActor*> IgnoreActors = ActorsToIgnore;
-	IgnoreActors.Add(GetOwner());
-
-	bool bHit = UKismetSystemLibrary::SphereOverlapActors(
-		this,
-		Center,
-		TraceRadius,
-		ObjectTypes,
-		nullptr, // ActorClassFilter
-		IgnoreActors,
-		OverlappingActors
-	);
-
-	// Debug draw
-	if (bDrawDebug)
+	FMeleeTraceQuery& Query = OutQueries.AddDefaulted_GetRef();
+	Query.Start = Center;
+	Query.End = Center;
+	Query.Shape = FCollisionShape::MakeSphere(TraceRadius);
+	Query.bSweep = false;
+}
+
+void UMeleeTraceComponent::AddSweptQueries(const FVector& FromStart, const FVector& FromEnd, const FVector& ToStart, const FVector& ToEnd, TArray<FMeleeTraceQuery>& OutQueries) const
+{
+	// Substeps approximate the blade's rotation - a capsule sweep can only translate
+	const int32 NumSubsteps = FMath::Max(1, InterpolationSteps);
+
+	for (int32 Step = 0; Step < NumSubsteps; ++Step)
 	{
-		DrawDebugSphere(
-			GetWorld(),
-			Center,
-			TraceRadius,
-			12,
-			bHit ? FColor::Red : FColor::Blue,
-			false,
-			DebugDrawDuration
-		);
+		const float AlphaFrom = static_cast<float>(Step) / static_cast<float>(NumSubsteps);
+		const float AlphaTo = static_cast<float>(Step + 1) / static_cast<float>(NumSubsteps);
+		const float AlphaMid = (AlphaFrom + AlphaTo) * 0.5f;
+
+		// Capsule axis follows the blade at the middle of the substep
+		const FVector BladeBase = FMath::Lerp(FromStart, ToStart, AlphaMid);
+		const FVector BladeTip = FMath::Lerp(FromEnd, ToEnd, AlphaMid);
+		const FVector BladeAxis = (BladeTip - BladeBase).GetSafeNormal();
+
+		FMeleeTraceQuery& Query = OutQueries.AddDefaulted_GetRef();
+		Query.Start = (FMath::Lerp(FromStart, ToStart, AlphaFrom) + FMath::Lerp(FromEnd, ToEnd, AlphaFrom)) * 0.5f;
+		Query.End = (FMath::Lerp(FromStart, ToStart, AlphaTo) + FMath::Lerp(FromEnd, ToEnd, AlphaTo)) * 0.5f;
+		Query.Rotation = BladeAxis.IsNearlyZero() ? FQuat::Identity : FQuat::FindBetweenNormals(FVector::UpVector, BladeAxis);
+		Query.Shape = FCollisionShape::MakeCapsule(TraceRadius, FVector::Dist(BladeBase, BladeTip) * 0.5f + TraceRadius);
+		Query.bSweep = true;
 	}
+}
 
-	if (bHit)
+void UMeleeTraceComponent::RefreshQueryParams()
+{
+	CachedObjectQueryParams = FCollisionObjectQueryParams();
+	for (const TEnumAsByte<EObjectTypeQuery>& ObjectType : ObjectTypes)
 	{
-		for (AActor* HitActor : OverlappingActors)
-		{
-			if (HitActor)
-			{
-				ProcessHitActor(HitActor, Center);
-			}
-		}
+		CachedObjectQueryParams.AddObjectTypesToQuery(UEngineTypes::ConvertToCollisionChannel(ObjectType));
 	}
+
+	CachedQueryParams = FCollisionQueryParams(SCENE_QUERY_STAT(MeleeTrace), false, GetOwner());
+	CachedQueryParams.AddIgnoredActors(ActorsToIgnore);
 }
 
-void UMeleeTraceComponent::ProcessHitActor(AActor* HitActor, const FVector& HitLocation)
+void UMeleeTraceComponent::ExecuteQuery(const FMeleeTraceQuery& Query, TArray<FOverlapResult>& OutOverlaps, TArray<FHitResult>& OutHits) const
 {
-	if (!HitActor)
+	OutOverlaps.Reset();
+	OutHits.Reset();
+
+	UWorld* World = GetWorld();
+	if (!World)
 	{
 		return;
 	}
 
-	// Check if we already hit this actor
-	if (!bAllowMultipleHitsPerActor && HitActorsThisTrace.Contains(HitActor))
+	if (Query.bSweep)
 	{
-		return;
+		World->SweepMultiByObjectType(OutHits, Query.Start, Query.End, Query.Rotation, CachedObjectQueryParams, Query.Shape, CachedQueryParams);
 	}
+	else
+	{
+		World->OverlapMultiByObjectType(OutOverlaps, Query.Start, Query.Rotation, CachedObjectQueryParams, Query.Shape, CachedQueryParams);
+	}
+}
 
-	// Add to hit list
-	HitActorsThisTrace.Add(HitActor);
-
-	// Calculate base damage
-	float FinalDamage = CalculateDamage();
-	bool bWasParried = false;
-	bool bWasBlocked = false;
-
-	// Check if the target has EquipmentComponent for parry/block
-	UEquipmentComponent* TargetEquipment = nullptr;
+void UMeleeTraceComponent::ProcessOverlapResults(const FMeleeTraceQuery& Query, TArrayView<const FOverlapResult> Overlaps)
+{
+	if (!bIsTracing)
+	{
+		return;
+	}
 
-	// First check if target is a pawn with a controller
-	if (APawn* TargetPawn = Cast<APawn>(HitActor))
+	// Overlaps are per primitive - only report each actor once per query
+	TArray<AActor*, TInlineAllocator<8>> QueryActors;
+	for (const FOverlapResult& Overlap : Overlaps)
 	{
-		if (AController* TargetController = TargetPawn->GetController())
+		AActor* HitActor = Overlap.GetActor();
+		if (HitActor && !QueryActors.Contains(HitActor))
 		{
-			TargetEquipment = TargetController->FindComponentByClass<UEquipmentComponent>();
+			QueryActors.Add(HitActor);
+			ProcessHitActor(HitActor, Query.Start);
 		}
 	}
-	// Also check directly on the actor
-	if (!TargetEquipment)
+
+	// Debug draw sphere at each sample point
+	if (bDrawDebug)
 	{
-		TargetEquipment = HitActor->FindComponentByClass<UEquipmentComponent>();
+		DrawDebugSphere(
+			GetWorld(),
+			Query.Start,
+			TraceRadius,
+			TraceMode == EMeleeTraceMode::Spherical ? 12 : 8,
+			QueryActors.Num() > 0 ? FColor::Red : FColor::Green,
+			false,
+			TraceMode == EMeleeTraceMode::Spherical ? DebugDrawDuration : 0.0f // Linear redraws each frame to follow sockets
+		);
 	}
+}
 
-	// If target has equipment, check for parry/block
-	if (TargetEquipment)
+void UMeleeTraceComponent::ProcessSweepResults(const FMeleeTraceQuery& Query, TArrayView<const FHitResult> Hits)
+{
+	if (!bIsTracing)
 	{
-		FDamageModifierResult DamageResult = TargetEquipment->ModifyIncomingDamage(FinalDamage, GetOwner());
-		FinalDamage = DamageResult.ModifiedDamage;
-		bWasParried = DamageResult.bWasParried;
-		bWasBlocked = DamageResult.bWasBlocked;
-
-		// If parried, we don't apply damage (already handled in ModifyIncomingDamage)
-		if (bWasParried)
-		{
-			// Create hit result struct for broadcast (no damage)
-			FMeleeHitResult MeleeHit;
-			MeleeHit.bHit = true;
-			MeleeHit.HitActor = HitActor;
-			MeleeHit.HitComponent = nullptr;
-			MeleeHit.HitLocation = HitLocation;
-			MeleeHit.HitNormal = FVector::ZeroVector;
-			MeleeHit.BoneName = NAME_None;
-			MeleeHit.AppliedDamage = 0.0f;
-
-			OnMeleeHit.Broadcast(MeleeHit);
-			return;
-		}
+		return;
 	}
 
-	// Try to apply damage via HealthComponent
-	bool bAppliedDamage = false;
-	if (UHealthComponent* HealthComp = HitActor->FindComponentByClass<UHealthComponent>())
+	// Sweep results are sorted by impact time
+	for (const FHitResult& Hit : Hits)
 	{
-		AController* InstigatorController = nullptr;
-		if (APawn* OwnerPawn = Cast<APawn>(GetOwner()))
+		ProcessHit(Hit);
+
+		if (bDrawDebug)
 		{
-			InstigatorController = OwnerPawn->GetController();
+			DrawDebugPoint(GetWorld(), Hit.ImpactPoint, 12.0f, FColor::Yellow, false, DebugDrawDuration);
 		}
-
-		HealthComp->TakeDamage(FinalDamage, GetOwner(), InstigatorController);
-		bAppliedDamage = true;
 	}
 
-	// Also try UE's damage system
-	if (!bAppliedDamage && DamageTypeClass)
+	if (bDrawDebug)
 	{
-		UGameplayStatics::ApplyDamage(
-			HitActor,
-			FinalDamage,
-			Cast<APawn>(GetOwner()) ? Cast<APawn>(GetOwner())->GetController() : nullptr,
-			GetOwner(),
-			DamageTypeClass
+		DrawDebugCapsule(
+			GetWorld(),
+			Query.End,
+			Query.Shape.GetCapsuleHalfHeight(),
+			TraceRadius,
+			Query.Rotation,
+			Hits.Num() > 0 ? FColor::Red : FColor::Green,
+			false,
+			0.0f
 		);
 	}
+}
+
+void UMeleeTraceComponent::ProcessHitActor(AActor* HitActor, const FVector& HitLocation)
+{
+	if (!HitActor)
+	{
+		return;
+	}
 
-	// Create hit result struct for broadcast
 	FMeleeHitResult MeleeHit;
 	MeleeHit.bHit = true;
 	MeleeHit.HitActor = HitActor;
@@ -464,10 +505,8 @@ void UMeleeTraceComponent::ProcessHitActor(AActor* HitActor, const FVector& HitL
 	MeleeHit.HitLocation = HitLocation;
 	MeleeHit.HitNormal = FVector::ZeroVector;
 	MeleeHit.BoneName = NAME_None;
-	MeleeHit.AppliedDamage = FinalDamage;
 
-	// Broadcast hit event
-	OnMeleeHit.Broadcast(MeleeHit);
+	ApplyMeleeHit(MeleeHit);
 }
 
 void UMeleeTraceComponent::ProcessHit(const FHitResult& Hit)
@@ -478,6 +517,25 @@ void UMeleeTraceComponent::ProcessHit(const FHitResult& Hit)
 		return;
 	}
 
+	FMeleeHitResult MeleeHit;
+	MeleeHit.bHit = true;
+	MeleeHit.HitActor = HitActor;
+	MeleeHit.HitComponent = Hit.GetComponent();
+	MeleeHit.HitLocation = Hit.ImpactPoint;
+	MeleeHit.HitNormal = Hit.ImpactNormal;
+	MeleeHit.BoneName = Hit.BoneName;
+
+	ApplyMeleeHit(MeleeHit);
+}
+
+void UMeleeTraceComponent::ApplyMeleeHit(FMeleeHitResult& MeleeHit)
+{
+	AActor* HitActor = MeleeHit.HitActor;
+	if (!HitActor)
+	{
+		return;
+	}
+
 	// Check if we already hit this actor
 	if (!bAllowMultipleHitsPerActor && HitActorsThisTrace.Contains(HitActor))
 	{
@@ -487,12 +545,30 @@ void UMeleeTraceComponent::ProcessHit(const FHitResult& Hit)
 	// Add to hit list
 	HitActorsThisTrace.Add(HitActor);
 
-	// Calculate and apply damage
+	// Calculate base damage
 	float FinalDamage = CalculateDamage();
 
+	// Check if the target has EquipmentComponent for parry/block (controller first, then actor)
+	UEquipmentComponent* TargetEquipment = UDamageableRegistry::GetEquipmentComponent(HitActor);
+
+	// If target has equipment, check for parry/block
+	if (TargetEquipment)
+	{
+		FDamageModifierResult DamageResult = TargetEquipment->ModifyIncomingDamage(FinalDamage, GetOwner());
+		FinalDamage = DamageResult.ModifiedDamage;
+
+		// If parried, we don't apply damage (already handled in ModifyIncomingDamage)
+		if (DamageResult.bWasParried)
+		{
+			MeleeHit.AppliedDamage = 0.0f;
+			OnMeleeHit.Broadcast(MeleeHit);
+			return;
+		}
+	}
+
 	// Try to apply damage via HealthComponent
 	bool bAppliedDamage = false;
-	if (UHealthComponent* HealthComp = HitActor->FindComponentByClass<UHealthComponent>())
+	if (UHealthComponent* HealthComp = UDamageableRegistry::GetHealthComponent(HitActor))
 	{
 		AController* InstigatorController = nullptr;
 		if (APawn* OwnerPawn = Cast<APawn>(GetOwner()))
@@ -516,14 +592,6 @@ void UMeleeTraceComponent::ProcessHit(const FHitResult& Hit)
 		);
 	}
 
-	// Create hit result struct
-	FMeleeHitResult MeleeHit;
-	MeleeHit.bHit = true;
-	MeleeHit.HitActor = HitActor;
-	MeleeHit.HitComponent = Hit.GetComponent();
-	MeleeHit.HitLocation = Hit.ImpactPoint;
-	MeleeHit.HitNormal = Hit.ImpactNormal;
-	MeleeHit.BoneName = Hit.BoneName;
 	MeleeHit.AppliedDamage = FinalDamage;
 
 	// Broadcast hit event
@@ -537,12 +605,11 @@ float UMeleeTraceComponent::CalculateDamage() const
 	// Try to get weapon damage from equipment
 	if (bUseWeaponDamage && CachedEquipmentComponent)
 	{
-		FItemData ItemData;
-		if (CachedEquipmentComponent->GetEquippedItemData(EEquipmentSlot::PrimaryWeapon, ItemData))
+		if (const FItemHotData* ItemData = CachedEquipmentComponent->FindEquippedItemHotData(EEquipmentSlot::PrimaryWeapon))
 		{
-			if (ItemData.Stats.PhysicalDamage > 0.0f)
+			if (ItemData->Stats.PhysicalDamage > 0.0f)
 			{
-				FinalDamage = ItemData.Stats.PhysicalDamage;
+				FinalDamage = ItemData->Stats.PhysicalDamage;
 			}
 		}
 	}
@@ -637,7 +704,7 @@ void UMeleeTraceComponent::DrawDebugTrace(const FVector& Start, const FVector& E
 
 	FColor Color = bHit ? FColor::Red : FColor::Green;
 
-	if (TraceMode == EMeleeTraceMode::Linear)
+	if (UsesEndSocket())
 	{
 		DrawDebugCapsule(
 			GetWorld(),
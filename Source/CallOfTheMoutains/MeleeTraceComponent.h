@@ -5,11 +5,14 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "CollisionQueryParams.h"
+#include "CollisionShape.h"
 #include "MeleeTraceComponent.generated.h"
 
 class USkeletalMeshComponent;
 class UEquipmentComponent;
 class UHealthComponent;
+struct FOverlapResult;
 
 /**
  * Trace mode for melee detection
@@ -21,7 +24,10 @@ enum class EMeleeTraceMode : uint8
 	Linear		UMETA(DisplayName = "Linear (Socket to Socket)"),
 
 	/** Sphere trace from single socket with radius (e.g., fist/hand) */
-	Spherical	UMETA(DisplayName = "Spherical (Single Socket + Radius)")
+	Spherical	UMETA(DisplayName = "Spherical (Single Socket + Radius)"),
+
+	/** Capsule along the two sockets swept from last frame's pose (one sweep per substep, real impact points) */
+	Swept		UMETA(DisplayName = "Swept (Continuous Capsule)")
 };
 
 /**
@@ -67,6 +73,19 @@ struct FMeleeHitResult
 	float AppliedDamage = 0.0f;
 };
 
+/**
+ * One physics query produced by a melee trace for the current frame
+ * (sphere overlap for Linear/Spherical, capsule sweep for Swept)
+ */
+struct FMeleeTraceQuery
+{
+	FVector Start = FVector::ZeroVector;
+	FVector End = FVector::ZeroVector;
+	FQuat Rotation = FQuat::Identity;
+	FCollisionShape Shape;
+	bool bSweep = false;
+};
+
 // Delegates
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnMeleeHit, const FMeleeHitResult&, HitResult);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnMeleeTraceStarted);
@@ -87,6 +106,7 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
@@ -147,6 +167,10 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Melee Trace|Trace", meta = (ClampMin = "1", ClampMax = "10"))
 	int32 InterpolationSteps = 3;
 
+	/** Run through the world's UMeleeTraceSubsystem (one batched tick for all attackers) instead of ticking this component */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Melee Trace|Trace")
+	bool bUseTraceSubsystem = true;
+
 	/** Can hit the same actor multiple times per trace activation? */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Melee Trace|Trace")
 	bool bAllowMultipleHitsPerActor = false;
@@ -217,6 +241,36 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Melee Trace")
 	void SetWeaponMesh(USkeletalMeshComponent* NewWeaponMesh);
 
+	/** Number of physics scene queries issued since the current trace started (for profiling trace modes) */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Melee Trace|Debug")
+	int32 GetSceneQueryCount() const { return SceneQueryCount; }
+
+	/** Does the current trace mode use both StartSocket and EndSocket? */
+	bool UsesEndSocket() const { return TraceMode != EMeleeTraceMode::Spherical; }
+
+	// ==================== Batched Tracing (used by UMeleeTraceSubsystem) ====================
+
+	/** Sample sockets and append this frame's queries. Returns false if sockets couldn't be resolved. */
+	bool BuildTraceQueries(TArray<FMeleeTraceQuery>& OutQueries);
+
+	/** Run a single query synchronously with this component's collision settings */
+	void ExecuteQuery(const FMeleeTraceQuery& Query, TArray<FOverlapResult>& OutOverlaps, TArray<FHitResult>& OutHits) const;
+
+	/** Apply overlap results for a query (game thread) */
+	void ProcessOverlapResults(const FMeleeTraceQuery& Query, TArrayView<const FOverlapResult> Overlaps);
+
+	/** Apply sweep results for a query in impact order (game thread) */
+	void ProcessSweepResults(const FMeleeTraceQuery& Query, TArrayView<const FHitResult> Hits);
+
+	/** Object types to query, built from ObjectTypes at StartTrace */
+	const FCollisionObjectQueryParams& GetObjectQueryParams() const { return CachedObjectQueryParams; }
+
+	/** Query params (owner + ActorsToIgnore ignored), built at StartTrace */
+	const FCollisionQueryParams& GetQueryParams() const { return CachedQueryParams; }
+
+	/** Bumped by every StartTrace - async results of an earlier swing carry an older value */
+	uint32 GetTraceGeneration() const { return TraceGeneration; }
+
 protected:
 	/** Is currently tracing? */
 	bool bIsTracing = false;
@@ -226,6 +280,16 @@ protected:
 	FVector PrevEndLocation = FVector::ZeroVector;
 	bool bHasPreviousLocations = false;
 
+	/** Scene queries issued since StartTrace */
+	int32 SceneQueryCount = 0;
+
+	/** Swing counter, see GetTraceGeneration */
+	uint32 TraceGeneration = 0;
+
+	/** Collision params cached at StartTrace */
+	FCollisionObjectQueryParams CachedObjectQueryParams;
+	FCollisionQueryParams CachedQueryParams;
+
 	/** Actors already hit this trace (to prevent duplicate hits) */
 	UPROPERTY()
 	TSet<AActor*> HitActorsThisTrace;
@@ -241,14 +305,20 @@ protected:
 	/** Get socket world location from target mesh */
 	bool GetSocketLocation(FName SocketName, FVector& OutLocation) const;
 
-	/** Perform the trace and return hits */
+	/** Build and run this frame's queries immediately (when not batched by the subsystem) */
 	void PerformTrace();
 
-	/** Perform linear trace between two points */
-	void PerformLinearTrace(const FVector& Start, const FVector& End);
+	/** Add sphere overlaps sampled along a line between two points */
+	void AddLinearQueries(const FVector& Start, const FVector& End, TArray<FMeleeTraceQuery>& OutQueries) const;
 
-	/** Perform spherical trace at a point */
-	void PerformSphericalTrace(const FVector& Center);
+	/** Add a sphere overlap at a point */
+	void AddSphericalQuery(const FVector& Center, TArray<FMeleeTraceQuery>& OutQueries) const;
+
+	/** Add capsule sweeps moving the Start-End capsule from the previous pose to the current pose */
+	void AddSweptQueries(const FVector& FromStart, const FVector& FromEnd, const FVector& ToStart, const FVector& ToEnd, TArray<FMeleeTraceQuery>& OutQueries) const;
+
+	/** Rebuild cached collision params from ObjectTypes/ActorsToIgnore */
+	void RefreshQueryParams();
 
 	/** Process a hit result and apply damage */
 	void ProcessHit(const FHitResult& Hit);
@@ -256,6 +326,9 @@ protected:
 	/** Process a hit actor directly (for overlap-based detection) */
 	void ProcessHitActor(AActor* HitActor, const FVector& HitLocation);
 
+	/** Shared hit handling - parry/block, damage and broadcast. MeleeHit.HitActor must be set. */
+	void ApplyMeleeHit(FMeleeHitResult& MeleeHit);
+
 	/** Calculate final damage to apply */
 	float CalculateDamage() const;
 
@@ -0,0 +1,245 @@
+// CallOfTheMoutains - Melee Trace Subsystem Implementation
+
+#include "MeleeTraceSubsystem.h"
+#include "CallOfTheMoutains.h"
+#include "Engine/World.h"
+#include "WorldCollision.h"
+
+DECLARE_CYCLE_STAT(TEXT("Melee Trace Batch"), STAT_MeleeTraceBatch, STATGROUP_CallOfTheMoutains);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Melee Active Traces"), STAT_MeleeActiveTraces, STATGROUP_CallOfTheMoutains);
+
+UMeleeTraceSubsystem* UMeleeTraceSubsystem::Get(const UObject* WorldContextObject)
+{
+	UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UMeleeTraceSubsystem>() : nullptr;
+}
+
+void UMeleeTraceSubsystem::Deinitialize()
+{
+	ActiveTraces.Empty();
+	Batch.Empty();
+	PendingAsyncBatch.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UMeleeTraceSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+bool UMeleeTraceSubsystem::IsTickable() const
+{
+	return ActiveTraces.Num() > 0 || PendingAsyncBatch.Num() > 0;
+}
+
+TStatId UMeleeTraceSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UMeleeTraceSubsystem, STATGROUP_Tickables);
+}
+
+void UMeleeTraceSubsystem::RegisterTrace(UMeleeTraceComponent* TraceComponent)
+{
+	if (TraceComponent)
+	{
+		ActiveTraces.AddUnique(TraceComponent);
+	}
+}
+
+void UMeleeTraceSubsystem::UnregisterTrace(UMeleeTraceComponent* TraceComponent)
+{
+	ActiveTraces.Remove(TraceComponent);
+}
+
+void UMeleeTraceSubsystem::SetUseAsyncQueries(bool bEnable)
+{
+	bUseAsyncQueries = bEnable;
+}
+
+void UMeleeTraceSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	SCOPE_CYCLE_COUNTER(STAT_MeleeTraceBatch);
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+
+	// Async results from last frame go out first so hit order stays frame-ordered
+	ResolvePendingAsyncBatch();
+
+	// Drop components destroyed without unregistering
+	ActiveTraces.RemoveAll([](const TWeakObjectPtr<UMeleeTraceComponent>& Trace) { return !Trace.IsValid(); });
+	SET_DWORD_STAT(STAT_MeleeActiveTraces, ActiveTraces.Num());
+
+	GatherQueries();
+	LastBatchQueryCount = Batch.Num();
+
+	if (Batch.Num() > 0)
+	{
+		if (bUseAsyncQueries)
+		{
+			SubmitBatchAsync();
+		}
+		else
+		{
+			ExecuteBatchSync();
+		}
+	}
+
+	LastBatchTimeMs = static_cast<float>(FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles));
+}
+
+void UMeleeTraceSubsystem::GatherQueries()
+{
+	Batch.Reset();
+
+	TArray<FMeleeTraceQuery> ComponentQueries;
+	for (const TWeakObjectPtr<UMeleeTraceComponent>& Trace : ActiveTraces)
+	{
+		UMeleeTraceComponent* TraceComponent = Trace.Get();
+		if (!TraceComponent || !TraceComponent->IsTracing())
+		{
+			continue;
+		}
+
+		ComponentQueries.Reset();
+		if (!TraceComponent->BuildTraceQueries(ComponentQueries))
+		{
+			continue;
+		}
+
+		for (const FMeleeTraceQuery& Query : ComponentQueries)
+		{
+			FBatchedQuery& Batched = Batch.AddDefaulted_GetRef();
+			Batched.Component = TraceComponent;
+			Batched.TraceGeneration = TraceComponent->GetTraceGeneration();
+			Batched.Query = Query;
+		}
+	}
+}
+
+void UMeleeTraceSubsystem::ExecuteBatchSync()
+{
+	BatchOverlaps.Reset();
+	BatchHits.Reset();
+
+	// Issue every query back to back, then dispatch - keeps the physics scene hot
+	TArray<FOverlapResult> QueryOverlaps;
+	TArray<FHitResult> QueryHits;
+	for (FBatchedQuery& Batched : Batch)
+	{
+		UMeleeTraceComponent* TraceComponent = Batched.Component.Get();
+		if (!TraceComponent)
+		{
+			continue;
+		}
+
+		TraceComponent->ExecuteQuery(Batched.Query, QueryOverlaps, QueryHits);
+		if (Batched.Query.bSweep)
+		{
+			Batched.ResultStart = BatchHits.Num();
+			Batched.ResultNum = QueryHits.Num();
+			BatchHits.Append(QueryHits);
+		}
+		else
+		{
+			Batched.ResultStart = BatchOverlaps.Num();
+			Batched.ResultNum = QueryOverlaps.Num();
+			BatchOverlaps.Append(QueryOverlaps);
+		}
+	}
+
+	for (const FBatchedQuery& Batched : Batch)
+	{
+		UMeleeTraceComponent* TraceComponent = Batched.Component.Get();
+		if (!TraceComponent)
+		{
+			continue;
+		}
+
+		if (Batched.Query.bSweep)
+		{
+			TraceComponent->ProcessSweepResults(Batched.Query, TArrayView<const FHitResult>(BatchHits.GetData() + Batched.ResultStart, Batched.ResultNum));
+		}
+		else
+		{
+			TraceComponent->ProcessOverlapResults(Batched.Query, TArrayView<const FOverlapResult>(BatchOverlaps.GetData() + Batched.ResultStart, Batched.ResultNum));
+		}
+	}
+}
+
+void UMeleeTraceSubsystem::SubmitBatchAsync()
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	for (FBatchedQuery& Batched : Batch)
+	{
+		UMeleeTraceComponent* TraceComponent = Batched.Component.Get();
+		if (!TraceComponent)
+		{
+			continue;
+		}
+
+		const FMeleeTraceQuery& Query = Batched.Query;
+		if (Query.bSweep)
+		{
+			Batched.AsyncHandle = World->AsyncSweepByObjectType(EAsyncTraceType::Multi, Query.Start, Query.End, Query.Rotation,
+				TraceComponent->GetObjectQueryParams(), Query.Shape, TraceComponent->GetQueryParams());
+		}
+		else
+		{
+			Batched.AsyncHandle = World->AsyncOverlapByObjectType(Query.Start, Query.Rotation,
+				TraceComponent->GetObjectQueryParams(), Query.Shape, TraceComponent->GetQueryParams());
+		}
+	}
+
+	PendingAsyncBatch.Append(Batch);
+}
+
+void UMeleeTraceSubsystem::ResolvePendingAsyncBatch()
+{
+	if (PendingAsyncBatch.Num() == 0)
+	{
+		return;
+	}
+
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		PendingAsyncBatch.Reset();
+		return;
+	}
+
+	for (const FBatchedQuery& Batched : PendingAsyncBatch)
+	{
+		// Component may have stopped tracing since submission - ProcessXResults ignores those.
+		// If it started the next swing since, these results belong to the old one.
+		UMeleeTraceComponent* TraceComponent = Batched.Component.Get();
+		if (!TraceComponent || TraceComponent->GetTraceGeneration() != Batched.TraceGeneration)
+		{
+			continue;
+		}
+
+		if (Batched.Query.bSweep)
+		{
+			FTraceDatum TraceData;
+			if (World->QueryTraceData(Batched.AsyncHandle, TraceData))
+			{
+				TraceComponent->ProcessSweepResults(Batched.Query, TraceData.OutHits);
+			}
+		}
+		else
+		{
+			FOverlapDatum OverlapData;
+			if (World->QueryOverlapData(Batched.AsyncHandle, OverlapData))
+			{
+				TraceComponent->ProcessOverlapResults(Batched.Query, OverlapData.OutOverlaps);
+			}
+		}
+	}
+
+	PendingAsyncBatch.Reset();
+}
@@ -0,0 +1,104 @@
+// CallOfTheMoutains - Melee Trace Subsystem
+// Runs every active melee trace in the world from a single tick with batched physics queries
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/OverlapResult.h"
+#include "MeleeTraceComponent.h"
+#include "MeleeTraceSubsystem.generated.h"
+
+/**
+ * Melee Trace Subsystem
+ * UMeleeTraceComponents register from StartTrace and unregister from StopTrace.
+ * Each frame all registered traces build their queries, the queries run as one batch
+ * (synchronously or on the async scene-query path) and results are dispatched back
+ * to the owning components on the game thread.
+ */
+UCLASS()
+class CALLOFTHEMOUTAINS_API UMeleeTraceSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Get the subsystem for a world context (nullptr if unavailable) */
+	static UMeleeTraceSubsystem* Get(const UObject* WorldContextObject);
+
+	virtual void Deinitialize() override;
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override;
+
+	/** Add a component to the batch (called from StartTrace) */
+	void RegisterTrace(UMeleeTraceComponent* TraceComponent);
+
+	/** Remove a component from the batch (called from StopTrace/EndPlay) */
+	void UnregisterTrace(UMeleeTraceComponent* TraceComponent);
+
+	/** Use the async scene-query path - results are dispatched one frame later */
+	UFUNCTION(BlueprintCallable, Category = "Melee Trace")
+	void SetUseAsyncQueries(bool bEnable);
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Melee Trace")
+	bool IsUsingAsyncQueries() const { return bUseAsyncQueries; }
+
+	/** Number of traces currently registered */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Melee Trace")
+	int32 GetActiveTraceCount() const { return ActiveTraces.Num(); }
+
+	/** Game thread time spent in the last batch (ms) */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Melee Trace")
+	float GetLastBatchTimeMs() const { return LastBatchTimeMs; }
+
+	/** Number of queries issued by the last batch */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Melee Trace")
+	int32 GetLastBatchQueryCount() const { return LastBatchQueryCount; }
+
+private:
+	/** A query in the current batch and where its results live */
+	struct FBatchedQuery
+	{
+		TWeakObjectPtr<UMeleeTraceComponent> Component;
+
+		/** Component's trace generation when the query was built */
+		uint32 TraceGeneration = 0;
+
+		FMeleeTraceQuery Query;
+		FTraceHandle AsyncHandle;
+		int32 ResultStart = 0;
+		int32 ResultNum = 0;
+	};
+
+	/** Registered traces */
+	TArray<TWeakObjectPtr<UMeleeTraceComponent>> ActiveTraces;
+
+	/** Queries built this frame (reused between frames to avoid allocations) */
+	TArray<FBatchedQuery> Batch;
+
+	/** Async queries submitted last frame, resolved at the start of this frame */
+	TArray<FBatchedQuery> PendingAsyncBatch;
+
+	/** Flattened results for the synchronous batch */
+	TArray<FOverlapResult> BatchOverlaps;
+	TArray<FHitResult> BatchHits;
+
+	bool bUseAsyncQueries = false;
+	float LastBatchTimeMs = 0.0f;
+	int32 LastBatchQueryCount = 0;
+
+	/** Collect queries from every registered trace into Batch */
+	void GatherQueries();
+
+	/** Run Batch synchronously then dispatch results */
+	void ExecuteBatchSync();
+
+	/** Submit Batch to the async scene-query path */
+	void SubmitBatchAsync();
+
+	/** Dispatch results of last frame's async batch */
+	void ResolvePendingAsyncBatch();
+};
@@ -0,0 +1,195 @@
+// CallOfTheMoutains - Pickup Focus Subsystem Implementation
+
+#include "PickupFocusSubsystem.h"
+#include "ItemPickup.h"
+#include "CallOfTheMoutains.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Pickup Focus Reranks"), STAT_PickupFocusReranks, STATGROUP_CallOfTheMoutains);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Pickup Focus Tracked Pawns"), STAT_PickupFocusTrackedPawns, STATGROUP_CallOfTheMoutains);
+
+UPickupFocusSubsystem* UPickupFocusSubsystem::Get(const UObject* WorldContextObject)
+{
+	UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UPickupFocusSubsystem>() : nullptr;
+}
+
+void UPickupFocusSubsystem::Deinitialize()
+{
+	PawnStates.Empty();
+	NumMultiCandidatePawns = 0;
+
+	Super::Deinitialize();
+}
+
+bool UPickupFocusSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+bool UPickupFocusSubsystem::IsTickable() const
+{
+	return NumMultiCandidatePawns > 0;
+}
+
+TStatId UPickupFocusSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UPickupFocusSubsystem, STATGROUP_Tickables);
+}
+
+void UPickupFocusSubsystem::AddCandidate(APawn* Pawn, AItemPickup* Pickup)
+{
+	if (!Pawn || !Pickup)
+	{
+		return;
+	}
+
+	FPawnFocusState& State = PawnStates.FindOrAdd(Pawn);
+	State.Pawn = Pawn;
+	State.Candidates.AddUnique(Pickup);
+
+	Rerank(State);
+	UpdateMultiCandidateCount();
+}
+
+void UPickupFocusSubsystem::RemoveCandidate(APawn* Pawn, AItemPickup* Pickup)
+{
+	FPawnFocusState* State = PawnStates.Find(Pawn);
+	if (!State)
+	{
+		return;
+	}
+
+	State->Candidates.Remove(Pickup);
+	Rerank(*State);
+
+	if (State->Candidates.Num() == 0)
+	{
+		PawnStates.Remove(Pawn);
+	}
+
+	UpdateMultiCandidateCount();
+}
+
+void UPickupFocusSubsystem::RemovePickup(AItemPickup* Pickup)
+{
+	for (auto It = PawnStates.CreateIterator(); It; ++It)
+	{
+		FPawnFocusState& State = It.Value();
+		if (State.Candidates.Remove(Pickup) > 0)
+		{
+			Rerank(State);
+		}
+
+		if (State.Candidates.Num() == 0)
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	UpdateMultiCandidateCount();
+}
+
+AItemPickup* UPickupFocusSubsystem::GetFocusedPickup(const APawn* Pawn) const
+{
+	const FPawnFocusState* State = PawnStates.Find(Pawn);
+	return State ? State->Focused.Get() : nullptr;
+}
+
+void UPickupFocusSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	SET_DWORD_STAT(STAT_PickupFocusTrackedPawns, PawnStates.Num());
+
+	const float RerankDistanceSq = RerankDistance * RerankDistance;
+
+	for (auto It = PawnStates.CreateIterator(); It; ++It)
+	{
+		FPawnFocusState& State = It.Value();
+		APawn* Pawn = State.Pawn.Get();
+		if (!Pawn)
+		{
+			It.RemoveCurrent();
+			continue;
+		}
+
+		// A single candidate is always the focus - ranking only matters with two or more
+		if (State.Candidates.Num() < 2)
+		{
+			continue;
+		}
+
+		if (FVector::DistSquared(Pawn->GetActorLocation(), State.LastRankLocation) > RerankDistanceSq)
+		{
+			Rerank(State);
+		}
+	}
+
+	UpdateMultiCandidateCount();
+}
+
+void UPickupFocusSubsystem::Rerank(FPawnFocusState& State)
+{
+	INC_DWORD_STAT(STAT_PickupFocusReranks);
+
+	APawn* Pawn = State.Pawn.Get();
+	AItemPickup* Closest = nullptr;
+
+	if (Pawn)
+	{
+		const FVector PawnLocation = Pawn->GetActorLocation();
+		State.LastRankLocation = PawnLocation;
+
+		float ClosestDistSq = FLT_MAX;
+
+		State.Candidates.RemoveAllSwap([](const TWeakObjectPtr<AItemPickup>& Candidate) { return !Candidate.IsValid(); });
+		for (const TWeakObjectPtr<AItemPickup>& Candidate : State.Candidates)
+		{
+			AItemPickup* Pickup = Candidate.Get();
+			if (Pickup->IsCollected())
+			{
+				continue;
+			}
+
+			const float DistSq = FVector::DistSquared(PawnLocation, Pickup->GetActorLocation());
+			if (DistSq < ClosestDistSq)
+			{
+				ClosestDistSq = DistSq;
+				Closest = Pickup;
+			}
+		}
+	}
+
+	AItemPickup* Previous = State.Focused.Get();
+	if (Closest == Previous)
+	{
+		return;
+	}
+
+	State.Focused = Closest;
+
+	// Lost focus on previous pickup, then gained focus on the new one
+	if (Previous)
+	{
+		OnPickupFocusChanged.Broadcast(Pawn, Previous, false);
+	}
+
+	if (Closest)
+	{
+		OnPickupFocusChanged.Broadcast(Pawn, Closest, true);
+	}
+}
+
+void UPickupFocusSubsystem::UpdateMultiCandidateCount()
+{
+	NumMultiCandidatePawns = 0;
+	for (const TPair<TObjectKey<APawn>, FPawnFocusState>& Pair : PawnStates)
+	{
+		if (Pair.Value.Candidates.Num() >= 2)
+		{
+			++NumMultiCandidatePawns;
+		}
+	}
+}
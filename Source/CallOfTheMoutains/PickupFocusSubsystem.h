@@ -0,0 +1,81 @@
+// CallOfTheMoutains - Pickup Focus Subsystem
+// Tracks which item pickup each player pawn is focused on, driven by pickup overlap events
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "PickupFocusSubsystem.generated.h"
+
+class AItemPickup;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnPawnPickupFocusChanged, APawn*, Pawn, AItemPickup*, Pickup, bool, bFocused);
+
+/**
+ * Pickup Focus Subsystem
+ * AItemPickup reports pawns entering/leaving its interaction sphere. Each pawn keeps a small
+ * candidate set of in-range pickups; the nearest one is focused. Candidates are re-ranked when
+ * the set changes, or when the pawn has moved more than RerankDistance since the last ranking.
+ * Only pawns with two or more candidates are checked each tick.
+ */
+UCLASS()
+class CALLOFTHEMOUTAINS_API UPickupFocusSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Get the subsystem for a world context (nullptr if unavailable) */
+	static UPickupFocusSubsystem* Get(const UObject* WorldContextObject);
+
+	virtual void Deinitialize() override;
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override;
+
+	/** Pawn entered a pickup's interaction sphere */
+	void AddCandidate(APawn* Pawn, AItemPickup* Pickup);
+
+	/** Pawn left a pickup's interaction sphere */
+	void RemoveCandidate(APawn* Pawn, AItemPickup* Pickup);
+
+	/** Pickup was collected/hidden/destroyed - drop it from every pawn */
+	void RemovePickup(AItemPickup* Pickup);
+
+	/** Currently focused pickup for a pawn (nullptr if none in range) */
+	UFUNCTION(BlueprintCallable, Category = "Interaction")
+	AItemPickup* GetFocusedPickup(const APawn* Pawn) const;
+
+	/** Distance a pawn must move before its candidates are re-ranked */
+	UFUNCTION(BlueprintCallable, Category = "Interaction")
+	void SetRerankDistance(float NewDistance) { RerankDistance = FMath::Max(0.0f, NewDistance); }
+
+	/** Broadcast when a pawn's focused pickup changes */
+	UPROPERTY(BlueprintAssignable, Category = "Interaction")
+	FOnPawnPickupFocusChanged OnPickupFocusChanged;
+
+private:
+	struct FPawnFocusState
+	{
+		TWeakObjectPtr<APawn> Pawn;
+		TArray<TWeakObjectPtr<AItemPickup>> Candidates;
+		TWeakObjectPtr<AItemPickup> Focused;
+		FVector LastRankLocation = FVector::ZeroVector;
+	};
+
+	TMap<TObjectKey<APawn>, FPawnFocusState> PawnStates;
+
+	/** Pawns with two or more candidates (the only ones that can need a re-rank) */
+	int32 NumMultiCandidatePawns = 0;
+
+	float RerankDistance = 25.0f;
+
+	/** Pick the nearest uncollected candidate and broadcast if focus changed */
+	void Rerank(FPawnFocusState& State);
+
+	/** Recount pawns that need distance checks */
+	void UpdateMultiCandidateCount();
+};
@@ -6,9 +6,38 @@
 #include "HealthComponent.h"
 #include "DayNightManager.h"
 #include "WeatherSystem.h"
+#include "SaveJournal.h"
+#include "COTMSaveArchive.h"
+#include "SaveSlotSubsystem.h"
+#include "WorldStateSubsystem.h"
 #include "GameFramework/PlayerController.h"
 #include "GameFramework/Pawn.h"
 #include "Kismet/GameplayStatics.h"
+#include "CallOfTheMoutains.h"
+#include "Async/Async.h"
+
+DECLARE_CYCLE_STAT(TEXT("Save Snapshot"), STAT_SaveSnapshot, STATGROUP_CallOfTheMoutains);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Save Write Time (ms)"), STAT_SaveWriteTimeMs, STATGROUP_CallOfTheMoutains);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Saves Written"), STAT_SavesWritten, STATGROUP_CallOfTheMoutains);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Save Journal Records"), STAT_SaveJournalRecords, STATGROUP_CallOfTheMoutains);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Save Bytes Written"), STAT_SaveBytesWritten, STATGROUP_CallOfTheMoutains);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Saves Coalesced"), STAT_SavesCoalesced, STATGROUP_CallOfTheMoutains);
+
+namespace
+{
+	/** Slot cache entry for a snapshot that was just written */
+	FCOTMSaveSlotInfo MakeSlotInfo(const UCOTMSaveGame* Snapshot, const FString& SlotName)
+	{
+		FCOTMSaveSlotInfo Info;
+		Info.bValid = true;
+		Info.SlotName = SlotName;
+		Info.SaveTimestamp = Snapshot->SaveTimestamp;
+		Info.PlayTimeSeconds = Snapshot->PlayTimeSeconds;
+		Info.SchemaVersion = FCOTMSaveArchive::SchemaVersion;
+		Info.JournalSnapshotId = Snapshot->JournalSnapshotId;
+		return Info;
+	}
+}
 
 USaveGameManager::USaveGameManager()
 {
@@ -27,16 +56,23 @@ void USaveGameManager::BeginPlay()
 		return;
 	}
 
-	// Load existing save if enabled
-	if (bLoadOnBeginPlay && DoesSaveExist())
+	// Load existing save if enabled (a profile without a save just finishes the load empty)
+	if (bLoadOnBeginPlay)
 	{
-		// Delay load slightly to ensure all components are initialized
+		// Read the file while the level starts up; apply once all components are initialized
+		LoadGameAsync();
+
 		FTimerHandle LoadTimerHandle;
 		GetWorld()->GetTimerManager().SetTimer(LoadTimerHandle, [this]()
 		{
-			LoadGame();
+			bReadyToApplyLoad = true;
+			TryApplyPendingLoad();
 		}, 0.5f, false);
 	}
+	else
+	{
+		bReadyToApplyLoad = true;
+	}
 
 	// Start auto-save timer if enabled
 	if (bAutoSaveEnabled)
@@ -60,11 +96,16 @@ void USaveGameManager::EndPlay(const EEndPlayReason::Type EndPlayReason)
 	GetWorld()->GetTimerManager().ClearTimer(ChangeEventSaveTimerHandle);
 
 	// Save on quit if enabled (skip on excluded levels)
-	if (bSaveOnEndPlay && EndPlayReason == EEndPlayReason::Quit && !IsCurrentLevelExcluded())
+	if (bSaveOnEndPlay && EndPlayReason == EEndPlayReason::Quit && !IsCurrentLevelExcluded() && !bLoadPending)
 	{
-		SaveGame();
+		SaveGameBlocking();
 	}
 
+	// The snapshot must outlive its write
+	bSaveQueued = false;
+	bAutosaveQueued = false;
+	WaitForInFlightSave();
+
 	Super::EndPlay(EndPlayReason);
 }
 
@@ -96,6 +137,11 @@ void USaveGameManager::CacheComponents()
 }
 
 bool USaveGameManager::SaveGame()
+{
+	return RequestSave(false);
+}
+
+bool USaveGameManager::RequestSave(bool bRotateAutosave)
 {
 	// Skip on excluded levels
 	if (IsCurrentLevelExcluded())
@@ -103,31 +149,44 @@ bool USaveGameManager::SaveGame()
 		return false;
 	}
 
-	// Re-cache components in case they changed
-	CacheComponents();
+	// One write at a time - later requests collapse into a single save of the latest state
+	if (IsSaveInProgress() || bLoadPending)
+	{
+		if (bSaveQueued)
+		{
+			++CoalescedSaveCount;
+			INC_DWORD_STAT(STAT_SavesCoalesced);
+		}
+		bSaveQueued = true;
+		bAutosaveQueued |= bRotateAutosave;
+		return true;
+	}
 
-	UCOTMSaveGame* SaveObject = GetOrCreateSaveGame();
-	if (!SaveObject)
+	UCOTMSaveGame* Snapshot = CreateSnapshot();
+	if (!Snapshot)
 	{
 		OnSaveFailed.Broadcast(TEXT("Failed to create save object"));
 		return false;
 	}
 
-	// Gather all data
-	GatherSaveData(SaveObject);
+	StartSaveTask(Snapshot, bRotateAutosave);
+	return true;
+}
 
-	// Save to disk
-	if (UGameplayStatics::SaveGameToSlot(SaveObject, SaveSlotName, UserIndex))
+void USaveGameManager::FlushQueuedSave()
+{
+	if (!bSaveQueued)
 	{
-		OnGameSaved.Broadcast();
-		return true;
+		return;
 	}
 
-	OnSaveFailed.Broadcast(TEXT("Failed to write save file"));
-	return false;
+	const bool bRotateAutosave = bAutosaveQueued;
+	bSaveQueued = false;
+	bAutosaveQueued = false;
+	RequestSave(bRotateAutosave);
 }
 
-bool USaveGameManager::LoadGame()
+bool USaveGameManager::SaveGameBlocking()
 {
 	// Skip on excluded levels
 	if (IsCurrentLevelExcluded())
@@ -135,45 +194,550 @@ bool USaveGameManager::LoadGame()
 		return false;
 	}
 
-	if (!DoesSaveExist())
+	// This save covers anything queued behind the in-flight write
+	bSaveQueued = false;
+	bAutosaveQueued = false;
+	WaitForInFlightSave();
+
+	UCOTMSaveGame* Snapshot = CreateSnapshot();
+	if (!Snapshot)
 	{
+		OnSaveFailed.Broadcast(TEXT("Failed to create save object"));
 		return false;
 	}
 
-	// Re-cache components
+	// Quitting compacts - the next session starts from a single snapshot
+	Snapshot->JournalSnapshotId = MakeSnapshotId();
+
+	TArray<uint8> SaveData;
+	const FSaveTaskResult Result = WriteFullSnapshot(Snapshot, GetActiveSlotName(), UserIndex, SaveData);
+	OnSaveTaskComplete(Snapshot, Result);
+
+	return Result.bSuccess;
+}
+
+UCOTMSaveGame* USaveGameManager::CreateSnapshot()
+{
+	SCOPE_CYCLE_COUNTER(STAT_SaveSnapshot);
+	const double StartTime = FPlatformTime::Seconds();
+
+	// Re-cache components in case they changed
 	CacheComponents();
 
+	// Fresh object per save - the background task reads it while gameplay keeps running
+	UCOTMSaveGame* Snapshot = Cast<UCOTMSaveGame>(
+		UGameplayStatics::CreateSaveGameObject(UCOTMSaveGame::StaticClass()));
+	if (Snapshot)
+	{
+		GatherSaveData(Snapshot);
+	}
+
+	LastSnapshotTimeMs = static_cast<float>((FPlatformTime::Seconds() - StartTime) * 1000.0);
+	return Snapshot;
+}
+
+void USaveGameManager::StartSaveTask(UCOTMSaveGame* Snapshot, bool bRotateAutosave)
+{
+	InFlightSnapshot = Snapshot;
+
+	TWeakObjectPtr<USaveGameManager> WeakThis(this);
+	const uint32 Serial = ++SaveTaskSerial;
+	const FString SlotName = GetActiveSlotName();
+	const int32 SlotUserIndex = UserIndex;
+
+	// Autosave slot state from the slot cache - the task picks the oldest (or unused) one and
+	// peeks any slot the cache doesn't know yet, so no header reads happen on the game thread
+	TArray<TOptional<FCOTMSaveSlotInfo>> AutosaveSlotInfos;
+	if (bRotateAutosave && NumAutosaveSlots > 0)
+	{
+		const USaveSlotSubsystem* SlotCache = USaveSlotSubsystem::Get(this);
+		if (SlotCache)
+		{
+			AutosaveSlotInfos = SlotCache->GetAutosaveSlotInfos(SlotName, NumAutosaveSlots);
+		}
+		else
+		{
+			AutosaveSlotInfos.SetNum(NumAutosaveSlots);
+		}
+	}
+
+	// Diff on the game thread - the baseline is only safe to read here
+	const bool bJournal = CanWriteJournal();
+	TSharedPtr<FSaveJournalEntry> JournalEntry;
+	if (bJournal)
+	{
+		Snapshot->JournalSnapshotId = CurrentSaveGame->JournalSnapshotId;
+		JournalEntry = MakeShared<FSaveJournalEntry>(FSaveJournal::Diff(CurrentSaveGame, Snapshot, Snapshot->JournalSnapshotId));
+	}
+	else
+	{
+		Snapshot->JournalSnapshotId = MakeSnapshotId();
+	}
+
+	InFlightSave = Async(EAsyncExecution::ThreadPool, [WeakThis, Serial, Snapshot, JournalEntry, SlotName, SlotUserIndex, AutosaveSlotInfos]()
+	{
+		// Nothing on the game thread touches the snapshot until completion
+		FSaveTaskResult Result;
+		TArray<uint8> SaveData;
+		if (JournalEntry.IsValid())
+		{
+			const double StartTime = FPlatformTime::Seconds();
+			Result.bJournal = true;
+			Result.bSuccess = FSaveJournal::AppendEntry(FSaveJournal::GetJournalPath(SlotName), *JournalEntry, Result.BytesWritten);
+			Result.WriteTimeMs = static_cast<float>((FPlatformTime::Seconds() - StartTime) * 1000.0);
+		}
+		else
+		{
+			Result = WriteFullSnapshot(Snapshot, SlotName, SlotUserIndex, SaveData);
+		}
+		Result.SlotName = SlotName;
+
+		// Autosaves are standalone full snapshots, so any one of them can be loaded on its own.
+		// A full write already serialized the snapshot; only a journal append needs it serialized here.
+		const FString AutosaveSlotName = AutosaveSlotInfos.Num() > 0
+			? USaveSlotSubsystem::PickAutosaveSlot(SlotName, AutosaveSlotInfos, SlotUserIndex)
+			: FString();
+		if (!AutosaveSlotName.IsEmpty())
+		{
+			Result.AutosaveSlotName = AutosaveSlotName;
+			Result.bAutosaveSuccess = (SaveData.Num() > 0 || FCOTMSaveArchive::Write(Snapshot, SaveData))
+				&& FCOTMSaveArchive::WriteSlotData(AutosaveSlotName, SlotUserIndex, SaveData);
+			Result.BytesWritten += Result.bAutosaveSuccess ? SaveData.Num() : 0;
+		}
+
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, Serial, Snapshot, Result]()
+		{
+			// Stale if WaitForInFlightSave already completed this write
+			USaveGameManager* This = WeakThis.Get();
+			if (This && This->SaveTaskSerial == Serial && This->InFlightSave.IsValid())
+			{
+				This->InFlightSave.Reset();
+				This->OnSaveTaskComplete(Snapshot, Result);
+			}
+		});
+
+		return Result;
+	});
+}
+
+bool USaveGameManager::CanWriteJournal() const
+{
+	return bUseSaveJournal && bJournalBaselineValid && CurrentSaveGame
+		&& JournalRecordCount < JournalCompactionThreshold;
+}
+
+uint32 USaveGameManager::MakeSnapshotId() const
+{
+	// Random so records left by an older save (or an interrupted compaction) never match
+	const uint32 CurrentId = CurrentSaveGame ? CurrentSaveGame->JournalSnapshotId : 0;
+	uint32 SnapshotId = 0;
+	while (SnapshotId == 0 || SnapshotId == CurrentId)
+	{
+		SnapshotId = GetTypeHash(FGuid::NewGuid());
+	}
+	return SnapshotId;
+}
+
+FSaveTaskResult USaveGameManager::WriteFullSnapshot(UCOTMSaveGame* Snapshot, const FString& SlotName, int32 SlotUserIndex, TArray<uint8>& SaveData)
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	FSaveTaskResult Result;
+	Result.SlotName = SlotName;
+	Result.bSuccess = FCOTMSaveArchive::Write(Snapshot, SaveData)
+		&& FCOTMSaveArchive::WriteSlotData(SlotName, SlotUserIndex, SaveData);
+
+	// The snapshot carries a new id, so a journal that survives a crash here is ignored on load
+	if (Result.bSuccess)
+	{
+		FSaveJournal::DeleteJournal(FSaveJournal::GetJournalPath(SlotName));
+	}
+
+	Result.BytesWritten = SaveData.Num();
+	Result.WriteTimeMs = static_cast<float>((FPlatformTime::Seconds() - StartTime) * 1000.0);
+	return Result;
+}
+
+void USaveGameManager::OnSaveTaskComplete(UCOTMSaveGame* Snapshot, const FSaveTaskResult& Result)
+{
+	InFlightSnapshot = nullptr;
+
+	LastWriteTimeMs = Result.WriteTimeMs;
+	TotalWriteTimeMs += Result.WriteTimeMs;
+	++CompletedSaveCount;
+	SET_FLOAT_STAT(STAT_SaveWriteTimeMs, Result.WriteTimeMs);
+
+	if (Result.bSuccess)
+	{
+		INC_DWORD_STAT(STAT_SavesWritten);
+		LastSaveBytes = Result.BytesWritten;
+		INC_DWORD_STAT_BY(STAT_SaveBytesWritten, Result.BytesWritten);
+
+		if (Result.bJournal)
+		{
+			++JournalRecordCount;
+			INC_DWORD_STAT(STAT_SaveJournalRecords);
+		}
+		else
+		{
+			JournalRecordCount = 0;
+		}
+
+		CurrentSaveGame = Snapshot;
+		bJournalBaselineValid = true;
+
+		if (USaveSlotSubsystem* SlotCache = USaveSlotSubsystem::Get(this))
+		{
+			SlotCache->NotifySlotWritten(MakeSlotInfo(Snapshot, Result.SlotName));
+		}
+
+		OnGameSaved.Broadcast();
+	}
+	else
+	{
+		// Disk state is uncertain - the next save writes a full snapshot
+		bJournalBaselineValid = false;
+		OnSaveFailed.Broadcast(TEXT("Failed to write save file"));
+	}
+
+	if (Result.bAutosaveSuccess)
+	{
+		if (USaveSlotSubsystem* SlotCache = USaveSlotSubsystem::Get(this))
+		{
+			SlotCache->NotifySlotWritten(MakeSlotInfo(Snapshot, Result.AutosaveSlotName));
+		}
+	}
+	else if (!Result.AutosaveSlotName.IsEmpty())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("SaveGameManager: Failed to write autosave %s"), *Result.AutosaveSlotName);
+	}
+
+	// State changed while writing - save it now
+	if (!IsSaveInProgress())
+	{
+		FlushQueuedSave();
+	}
+}
+
+void USaveGameManager::WaitForInFlightSave()
+{
+	if (!InFlightSave.IsValid())
+	{
+		return;
+	}
+
+	const FSaveTaskResult Result = InFlightSave.Get();
+	InFlightSave.Reset();
+
+	// Complete here - the queued game thread completion sees the reset future and does nothing
+	OnSaveTaskComplete(InFlightSnapshot, Result);
+}
+
+bool USaveGameManager::LoadGame()
+{
+	// Skip on excluded levels
+	if (IsCurrentLevelExcluded())
+	{
+		return false;
+	}
+
 	// Load from disk
-	UCOTMSaveGame* LoadedGame = Cast<UCOTMSaveGame>(
-		UGameplayStatics::LoadGameFromSlot(SaveSlotName, UserIndex));
+	const FString ProfileSlotName = GetActiveSlotName();
+	TArray<uint8> SaveData;
+	FString LoadedSlotName;
+	bool bFoundSave = false;
+	const bool bRead = ReadProfileSlotData(ProfileSlotName, UserIndex, NumAutosaveSlots, SaveData, LoadedSlotName, bFoundSave);
 
+	if (!bFoundSave)
+	{
+		return false;
+	}
+
+	UCOTMSaveGame* LoadedGame = bRead ? DeserializeSave(SaveData) : nullptr;
 	if (!LoadedGame)
 	{
 		OnSaveFailed.Broadcast(TEXT("Failed to load save file"));
 		return false;
 	}
 
+	// Only the main slot has a journal
+	const bool bFromMainSlot = LoadedSlotName == ProfileSlotName;
+	int32 NumJournalRecords = 0;
+	if (bFromMainSlot)
+	{
+		TArray<FSaveJournalEntry> JournalEntries;
+		FSaveJournal::ReadEntries(FSaveJournal::GetJournalPath(ProfileSlotName), JournalEntries);
+		NumJournalRecords = FSaveJournal::Replay(JournalEntries, LoadedGame);
+	}
+
+	FinishLoad(LoadedGame, NumJournalRecords, bFromMainSlot);
+	return true;
+}
+
+bool USaveGameManager::ReadProfileSlotData(const FString& ProfileSlotName, int32 SlotUserIndex, int32 NumAutosaves,
+	TArray<uint8>& OutData, FString& OutSlotName, bool& bOutFoundSave)
+{
+	bOutFoundSave = false;
+
+	// Main slot first, then autosaves newest first (headers only to order them)
+	TArray<FCOTMSaveSlotInfo> Candidates;
+	Candidates.AddDefaulted_GetRef().SlotName = ProfileSlotName;
+
+	TArray<FCOTMSaveSlotInfo> Autosaves;
+	for (int32 i = 0; i < NumAutosaves; ++i)
+	{
+		FCOTMSaveSlotInfo Info;
+		if (FCOTMSaveArchive::PeekSlot(USaveSlotSubsystem::MakeAutosaveSlotName(ProfileSlotName, i), SlotUserIndex, Info))
+		{
+			Autosaves.Add(MoveTemp(Info));
+		}
+	}
+	Autosaves.Sort([](const FCOTMSaveSlotInfo& A, const FCOTMSaveSlotInfo& B) { return A.SaveTimestamp > B.SaveTimestamp; });
+	Candidates.Append(MoveTemp(Autosaves));
+
+	for (const FCOTMSaveSlotInfo& Candidate : Candidates)
+	{
+		OutData.Reset();
+		if (!FCOTMSaveArchive::ReadSlotData(Candidate.SlotName, SlotUserIndex, OutData))
+		{
+			continue;
+		}
+
+		bOutFoundSave = true;
+		if (!FCOTMSaveArchive::HasHeader(OutData) || FCOTMSaveArchive::Validate(OutData))
+		{
+			if (Candidate.SlotName != ProfileSlotName)
+			{
+				UE_LOG(LogTemp, Warning, TEXT("SaveGameManager: %s unusable - loading autosave %s"), *ProfileSlotName, *Candidate.SlotName);
+			}
+			OutSlotName = Candidate.SlotName;
+			return true;
+		}
+
+		UE_LOG(LogTemp, Warning, TEXT("SaveGameManager: %s failed validation"), *Candidate.SlotName);
+	}
+
+	OutData.Reset();
+	return false;
+}
+
+bool USaveGameManager::LoadGameAsync()
+{
+	// Skip on excluded levels
+	if (IsCurrentLevelExcluded() || bLoadPending)
+	{
+		return false;
+	}
+
+	bLoadPending = true;
+	PendingLoadedGame = nullptr;
+
+	TWeakObjectPtr<USaveGameManager> WeakThis(this);
+	const FString ProfileSlotName = GetActiveSlotName();
+	const int32 SlotUserIndex = UserIndex;
+	const int32 NumAutosaves = NumAutosaveSlots;
+
+	// File reads and validation off the game thread; the save object itself is created back on the game thread
+	Async(EAsyncExecution::ThreadPool, [WeakThis, ProfileSlotName, SlotUserIndex, NumAutosaves]()
+	{
+		TSharedRef<TArray<uint8>> SaveData = MakeShared<TArray<uint8>>();
+		FString LoadedSlotName;
+		bool bFoundSave = false;
+		const bool bRead = ReadProfileSlotData(ProfileSlotName, SlotUserIndex, NumAutosaves, *SaveData, LoadedSlotName, bFoundSave);
+
+		// Only the main slot has a journal
+		const bool bFromMainSlot = LoadedSlotName == ProfileSlotName;
+		TSharedRef<TArray<FSaveJournalEntry>> JournalEntries = MakeShared<TArray<FSaveJournalEntry>>();
+		if (bRead && bFromMainSlot)
+		{
+			FSaveJournal::ReadEntries(FSaveJournal::GetJournalPath(ProfileSlotName), *JournalEntries);
+		}
+
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, bRead, bFoundSave, bFromMainSlot, SaveData, JournalEntries]()
+		{
+			USaveGameManager* This = WeakThis.Get();
+			if (!This)
+			{
+				return;
+			}
+
+			UCOTMSaveGame* LoadedGame = bRead ? DeserializeSave(*SaveData) : nullptr;
+			const int32 NumJournalRecords = LoadedGame ? FSaveJournal::Replay(*JournalEntries, LoadedGame) : 0;
+			This->OnAsyncLoadComplete(LoadedGame, NumJournalRecords, bFoundSave, bFromMainSlot);
+		});
+	});
+	return true;
+}
+
+void USaveGameManager::OnAsyncLoadComplete(UCOTMSaveGame* LoadedGame, int32 NumJournalRecords, bool bFoundSave, bool bFromMainSlot)
+{
+	PendingLoadedGame = LoadedGame;
+	PendingJournalRecordCount = NumJournalRecords;
+	bPendingLoadFromMainSlot = bFromMainSlot;
+
+	if (!PendingLoadedGame)
+	{
+		bLoadPending = false;
+
+		// No save yet is a fresh start, not a failure
+		if (bFoundSave)
+		{
+			OnSaveFailed.Broadcast(TEXT("Failed to load save file"));
+		}
+
+		// Saves requested while loading can go ahead now
+		FlushQueuedSave();
+		return;
+	}
+
+	TryApplyPendingLoad();
+}
+
+void USaveGameManager::TryApplyPendingLoad()
+{
+	if (!bReadyToApplyLoad || !PendingLoadedGame)
+	{
+		return;
+	}
+
+	UCOTMSaveGame* LoadedGame = PendingLoadedGame;
+	PendingLoadedGame = nullptr;
+	bLoadPending = false;
+
+	FinishLoad(LoadedGame, PendingJournalRecordCount, bPendingLoadFromMainSlot);
+
+	FlushQueuedSave();
+}
+
+UCOTMSaveGame* USaveGameManager::DeserializeSave(const TArray<uint8>& SaveData)
+{
+	if (!FCOTMSaveArchive::HasHeader(SaveData))
+	{
+		// Legacy property save - rewritten in the archive layout by the next full save
+		return Cast<UCOTMSaveGame>(UGameplayStatics::LoadGameFromMemory(SaveData));
+	}
+
+	UCOTMSaveGame* LoadedGame = Cast<UCOTMSaveGame>(
+		UGameplayStatics::CreateSaveGameObject(UCOTMSaveGame::StaticClass()));
+	return LoadedGame && FCOTMSaveArchive::Read(SaveData, LoadedGame) ? LoadedGame : nullptr;
+}
+
+FCOTMSaveSlotInfo USaveGameManager::PeekSaveInfo() const
+{
+	FCOTMSaveSlotInfo Info;
+
+	// Cached header when the slot cache has it, otherwise read the header from disk
+	const USaveSlotSubsystem* SlotCache = USaveSlotSubsystem::Get(this);
+	if (!SlotCache || !SlotCache->GetSlotInfo(GetActiveSlotName(), Info))
+	{
+		FCOTMSaveArchive::PeekSlot(GetActiveSlotName(), UserIndex, Info);
+	}
+	return Info;
+}
+
+FString USaveGameManager::GetActiveSlotName() const
+{
+	return USaveSlotSubsystem::MakeProfileSlotName(SaveSlotName, ProfileName);
+}
+
+void USaveGameManager::SetProfile(const FString& NewProfileName)
+{
+	if (NewProfileName == ProfileName)
+	{
+		return;
+	}
+
+	// Pending writes belong to the old profile
+	bSaveQueued = false;
+	bAutosaveQueued = false;
+	WaitForInFlightSave();
+
+	ProfileName = NewProfileName;
+
+	// Nothing of the new profile is loaded - its first save must be a full snapshot
+	CurrentSaveGame = nullptr;
+	bJournalBaselineValid = false;
+	JournalRecordCount = 0;
+
+	// Pickups, enemies, fires and lamps recorded for the old profile don't carry over
+	if (UWorldStateSubsystem* WorldState = UWorldStateSubsystem::Get(this))
+	{
+		WorldState->ResetState();
+	}
+}
+
+float USaveGameManager::GetPlayTimeSeconds() const
+{
+	const UWorld* World = GetWorld();
+	return PlayTimeAtLoad + (World ? static_cast<float>(World->GetTimeSeconds() - PlayTimeSessionStart) : 0.0f);
+}
+
+void USaveGameManager::FinishLoad(UCOTMSaveGame* LoadedGame, int32 NumJournalRecords, bool bFromMainSlot)
+{
+	// Re-cache components
+	CacheComponents();
+
+	// Play time continues from the save
+	PlayTimeAtLoad = LoadedGame->PlayTimeSeconds;
+	PlayTimeSessionStart = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0;
+
+	// Snapshot + replayed journal is exactly what's on disk - later saves journal against it.
+	// An autosave fallback isn't what the main slot holds, so the next save rewrites it in full.
 	CurrentSaveGame = LoadedGame;
+	bJournalBaselineValid = bFromMainSlot;
+	JournalRecordCount = NumJournalRecords;
 
 	// Apply loaded data
 	ApplySaveData(LoadedGame);
 
 	OnGameLoaded.Broadcast();
-	return true;
 }
 
 bool USaveGameManager::DoesSaveExist() const
 {
-	return UGameplayStatics::DoesSaveGameExist(SaveSlotName, UserIndex);
+	const USaveSlotSubsystem* SlotCache = USaveSlotSubsystem::Get(this);
+	if (SlotCache && SlotCache->IsEnumerationComplete())
+	{
+		return SlotCache->DoesSlotExist(GetActiveSlotName());
+	}
+
+	return UGameplayStatics::DoesSaveGameExist(GetActiveSlotName(), UserIndex);
 }
 
 bool USaveGameManager::DeleteSave()
 {
-	if (DoesSaveExist())
+	const FString ProfileSlotName = GetActiveSlotName();
+	USaveSlotSubsystem* SlotCache = USaveSlotSubsystem::Get(this);
+
+	// A write landing after the delete would bring the save back
+	bSaveQueued = false;
+	bAutosaveQueued = false;
+	WaitForInFlightSave();
+
+	FSaveJournal::DeleteJournal(FSaveJournal::GetJournalPath(ProfileSlotName));
+	bJournalBaselineValid = false;
+
+	TArray<FString> SlotNames = { ProfileSlotName };
+	for (int32 i = 0; i < NumAutosaveSlots; ++i)
 	{
-		return UGameplayStatics::DeleteGameInSlot(SaveSlotName, UserIndex);
+		SlotNames.Add(USaveSlotSubsystem::MakeAutosaveSlotName(ProfileSlotName, i));
 	}
-	return true;
+
+	bool bSuccess = true;
+	for (const FString& SlotName : SlotNames)
+	{
+		if (UGameplayStatics::DoesSaveGameExist(SlotName, UserIndex))
+		{
+			bSuccess &= UGameplayStatics::DeleteGameInSlot(SlotName, UserIndex);
+		}
+		FCOTMSaveArchive::DeleteRecoveryFiles(SlotName);
+
+		if (SlotCache)
+		{
+			SlotCache->NotifySlotDeleted(SlotName);
+		}
+	}
+	return bSuccess;
 }
 
 UCOTMSaveGame* USaveGameManager::GetOrCreateSaveGame()
@@ -188,7 +752,7 @@ UCOTMSaveGame* USaveGameManager::GetOrCreateSaveGame()
 
 void USaveGameManager::TriggerAutoSave()
 {
-	SaveGame();
+	RequestSave(true);
 }
 
 void USaveGameManager::GatherSaveData(UCOTMSaveGame* SaveObject)
@@ -198,9 +762,10 @@ void USaveGameManager::GatherSaveData(UCOTMSaveGame* SaveObject)
 		return;
 	}
 
-	SaveObject->SaveSlotName = SaveSlotName;
+	SaveObject->SaveSlotName = GetActiveSlotName();
 	SaveObject->UserIndex = UserIndex;
 	SaveObject->SaveTimestamp = FDateTime::Now();
+	SaveObject->PlayTimeSeconds = GetPlayTimeSeconds();
 
 	// Get player controller
 	APlayerController* PC = Cast<APlayerController>(GetOwner());
@@ -279,6 +844,17 @@ void USaveGameManager::GatherSaveData(UCOTMSaveGame* SaveObject)
 		DayNightManager->GetSaveData(SaveObject->CurrentGameTime, Weather);
 		SaveObject->CurrentWeather = Weather;
 		SaveObject->bHasDayNightData = true;
+
+		if (DayNightManager->WeatherSystem)
+		{
+			DayNightManager->WeatherSystem->WriteToSave(SaveObject);
+		}
+	}
+
+	// Save world state (already recorded as actors changed - no world iteration)
+	if (UWorldStateSubsystem* WorldState = UWorldStateSubsystem::Get(this))
+	{
+		WorldState->WriteToSave(SaveObject);
 	}
 }
 
@@ -384,8 +960,20 @@ void USaveGameManager::ApplySaveData(UCOTMSaveGame* SaveObject)
 		if (DayNightManager)
 		{
 			DayNightManager->LoadSaveData(SaveObject->CurrentGameTime, SaveObject->CurrentWeather);
+
+			// Continue the saved weather sequence (older saves keep just the weather above)
+			if (DayNightManager->WeatherSystem)
+			{
+				DayNightManager->WeatherSystem->ReadFromSave(SaveObject);
+			}
 		}
 	}
+
+	// Restore world state (levels not loaded yet stay packed until they stream in)
+	if (UWorldStateSubsystem* WorldState = UWorldStateSubsystem::Get(this))
+	{
+		WorldState->ReadFromSave(SaveObject);
+	}
 }
 
 void USaveGameManager::StartAutoSaveTimer()
@@ -404,7 +992,7 @@ void USaveGameManager::StartAutoSaveTimer()
 
 void USaveGameManager::OnAutoSaveTimer()
 {
-	SaveGame();
+	RequestSave(true);
 }
 
 bool USaveGameManager::IsCurrentLevelExcluded() const
@@ -6,6 +6,7 @@
 #include "Components/ActorComponent.h"
 #include "COTMSaveGame.h"
 #include "ItemTypes.h"
+#include "Async/Future.h"
 #include "SaveGameManager.generated.h"
 
 class UInventoryComponent;
@@ -17,9 +18,36 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnGameSaved);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnGameLoaded);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnSaveFailed, const FString&, Reason);
 
+/** Outcome of a background save write */
+struct FSaveTaskResult
+{
+	FString SlotName;
+	bool bSuccess = false;
+	bool bJournal = false;
+	float WriteTimeMs = 0.0f;
+	int32 BytesWritten = 0;
+
+	/** Rotating autosave slot also written (empty if none) */
+	FString AutosaveSlotName;
+	bool bAutosaveSuccess = false;
+};
+
 /**
  * Manages saving and loading game state
  * Attach to PlayerController for automatic save/load functionality
+ *
+ * Saving snapshots game state into a fresh save object on the game thread, then serializes
+ * and writes it on a background task. Requests made while a write is in flight are coalesced into
+ * a single follow-up save of the latest state. Loads read and deserialize off the game thread.
+ *
+ * With the save journal enabled, most saves append only what changed since the last save to the
+ * slot's journal (FSaveJournal). Every JournalCompactionThreshold records - and on quit - a full
+ * snapshot is written instead and the journal is dropped. Loads replay the journal onto the snapshot.
+ *
+ * Each profile has its own main slot plus NumAutosaveSlots rotating autosave slots. Timer
+ * autosaves also write a full snapshot over the oldest autosave slot; if the main slot is missing
+ * or corrupt, loads fall back to the newest valid autosave. Slot files are replaced atomically,
+ * and slot existence/metadata comes from USaveSlotSubsystem's cache instead of the disk.
  */
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
 class CALLOFTHEMOUTAINS_API USaveGameManager : public UActorComponent
@@ -36,10 +64,18 @@ protected:
 public:
 	// ==================== Configuration ====================
 
-	/** Save slot name */
+	/** Base save slot name - profiles and autosaves derive their slot names from it */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SaveGame|Config")
 	FString SaveSlotName = TEXT("COTMSave");
 
+	/** Active profile (empty = default profile, stored in SaveSlotName itself) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "SaveGame|Config")
+	FString ProfileName;
+
+	/** Rotating autosave slots kept per profile (0 = timer autosaves only update the main slot) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SaveGame|Config", meta = (ClampMin = "0", ClampMax = "10"))
+	int32 NumAutosaveSlots = 3;
+
 	/** User index for save */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SaveGame|Config")
 	int32 UserIndex = 0;
@@ -60,6 +96,14 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SaveGame|Config")
 	bool bSaveOnEndPlay = true;
 
+	/** Append changes to a journal between full snapshots instead of rewriting the whole save */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SaveGame|Config")
+	bool bUseSaveJournal = true;
+
+	/** Journal records written before the next save compacts them into a full snapshot */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SaveGame|Config", meta = (ClampMin = "1", EditCondition = "bUseSaveJournal"))
+	int32 JournalCompactionThreshold = 20;
+
 	/** Levels where saving/loading is disabled (sandbox/test levels) */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SaveGame|Config")
 	TArray<FString> ExcludedLevels = { TEXT("Lvl_ThirdPerson"), TEXT("ThirdPersonMap"), TEXT("ThirdPersonExampleMap") };
@@ -80,27 +124,84 @@ public:
 
 	// ==================== Save Functions ====================
 
-	/** Save the current game state */
+	/**
+	 * Save the current game state in the background. Returns false if saving is unavailable;
+	 * success or failure of the write is reported through OnGameSaved / OnSaveFailed.
+	 */
 	UFUNCTION(BlueprintCallable, Category = "SaveGame")
 	bool SaveGame();
 
-	/** Load the saved game state */
+	/** Save the current game state and wait for the write (quitting) */
+	UFUNCTION(BlueprintCallable, Category = "SaveGame")
+	bool SaveGameBlocking();
+
+	/** Load the saved game state (blocks on disk I/O) */
 	UFUNCTION(BlueprintCallable, Category = "SaveGame")
 	bool LoadGame();
 
-	/** Check if a save file exists */
+	/** Load the saved game state in the background - applied and OnGameLoaded broadcast on completion */
+	UFUNCTION(BlueprintCallable, Category = "SaveGame")
+	bool LoadGameAsync();
+
+	/** Is a background save write in flight */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "SaveGame")
+	bool IsSaveInProgress() const { return InFlightSave.IsValid(); }
+
+	// ==================== Save Stats ====================
+
+	/** Game thread time spent gathering the last save snapshot (ms) */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "SaveGame|Stats")
+	float GetLastSnapshotTimeMs() const { return LastSnapshotTimeMs; }
+
+	/** Background time spent serializing and writing the last save (ms) */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "SaveGame|Stats")
+	float GetLastWriteTimeMs() const { return LastWriteTimeMs; }
+
+	/** Average background write time over all completed saves (ms) */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "SaveGame|Stats")
+	float GetAverageWriteTimeMs() const { return CompletedSaveCount > 0 ? TotalWriteTimeMs / CompletedSaveCount : 0.0f; }
+
+	/** Bytes written by the last save (journal record or full snapshot) */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "SaveGame|Stats")
+	int32 GetLastSaveBytes() const { return LastSaveBytes; }
+
+	/** Journal records written since the current full snapshot */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "SaveGame|Stats")
+	int32 GetJournalRecordCount() const { return JournalRecordCount; }
+
+	/** Save requests folded into a later save because a write was already in flight */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "SaveGame|Stats")
+	int32 GetCoalescedSaveCount() const { return CoalescedSaveCount; }
+
+	/** Check if a save exists for the active profile (cached - no disk access once slots are enumerated) */
 	UFUNCTION(BlueprintCallable, Category = "SaveGame")
 	bool DoesSaveExist() const;
 
-	/** Delete the save file */
+	/** Main slot name of the active profile */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "SaveGame")
+	FString GetActiveSlotName() const;
+
+	/** Switch profile. Finishes any in-flight write first; call LoadGameAsync to load the new profile */
+	UFUNCTION(BlueprintCallable, Category = "SaveGame")
+	void SetProfile(const FString& NewProfileName);
+
+	/** Delete the active profile's save, journal and autosaves */
 	UFUNCTION(BlueprintCallable, Category = "SaveGame")
 	bool DeleteSave();
 
+	/** Timestamp and play time of the save slot, read from the file header without loading it */
+	UFUNCTION(BlueprintCallable, Category = "SaveGame")
+	FCOTMSaveSlotInfo PeekSaveInfo() const;
+
+	/** Total play time including previous sessions (seconds) */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "SaveGame")
+	float GetPlayTimeSeconds() const;
+
 	/** Get the current save data (creates new if none exists) */
 	UFUNCTION(BlueprintCallable, Category = "SaveGame")
 	UCOTMSaveGame* GetOrCreateSaveGame();
 
-	/** Force an auto-save now */
+	/** Force an auto-save now (rotates into the next autosave slot) */
 	UFUNCTION(BlueprintCallable, Category = "SaveGame")
 	void TriggerAutoSave();
 
@@ -127,6 +228,105 @@ protected:
 	/** Debounce timer for change-triggered saves (prevents rapid saving) */
 	FTimerHandle ChangeEventSaveTimerHandle;
 
+	// ==================== Async Save State ====================
+
+	/** Snapshot being written by the background task (owned here so it can't be collected mid-write) */
+	UPROPERTY()
+	UCOTMSaveGame* InFlightSnapshot;
+
+	/** Background write task, valid while a save is in flight */
+	TFuture<FSaveTaskResult> InFlightSave;
+
+	/** Bumped per started write so a stale game thread completion is ignored */
+	uint32 SaveTaskSerial = 0;
+
+	/** A save was requested while another was in flight or a load was pending */
+	bool bSaveQueued = false;
+
+	/** One of the queued requests was a timer autosave */
+	bool bAutosaveQueued = false;
+
+	/** Async load started but not yet applied - saves wait so they can't overwrite the file with pre-load state */
+	bool bLoadPending = false;
+
+	/** Async load finished; held until the startup delay allows applying it */
+	UPROPERTY()
+	UCOTMSaveGame* PendingLoadedGame;
+
+	/** Journal records replayed into PendingLoadedGame */
+	int32 PendingJournalRecordCount = 0;
+
+	/** PendingLoadedGame came from the main slot (not an autosave fallback) */
+	bool bPendingLoadFromMainSlot = true;
+
+	/** Startup delay elapsed - components are ready for ApplySaveData */
+	bool bReadyToApplyLoad = false;
+
+	/** CurrentSaveGame matches what is on disk (snapshot + journal), so changes can be journaled against it */
+	bool bJournalBaselineValid = false;
+
+	/** Journal records on disk for the current snapshot */
+	int32 JournalRecordCount = 0;
+
+	int32 LastSaveBytes = 0;
+	float LastSnapshotTimeMs = 0.0f;
+	float LastWriteTimeMs = 0.0f;
+	float TotalWriteTimeMs = 0.0f;
+	int32 CompletedSaveCount = 0;
+	int32 CoalescedSaveCount = 0;
+
+	/** Gather a snapshot into a new save object (game thread) */
+	UCOTMSaveGame* CreateSnapshot();
+
+	/** Save now or queue behind the in-flight write; autosaves also rotate a full snapshot into an autosave slot */
+	bool RequestSave(bool bRotateAutosave);
+
+	/** Start the background write of a snapshot - a journal record against CurrentSaveGame when possible */
+	void StartSaveTask(UCOTMSaveGame* Snapshot, bool bRotateAutosave);
+
+	/** Run the queued save, if any */
+	void FlushQueuedSave();
+
+	/** Whether the next save can be a journal record instead of a full snapshot */
+	bool CanWriteJournal() const;
+
+	/** New snapshot identity for a full save (never reuses the current one) */
+	uint32 MakeSnapshotId() const;
+
+	/** Full snapshot write + journal removal (any thread). SaveData receives the serialized snapshot for reuse. */
+	static FSaveTaskResult WriteFullSnapshot(UCOTMSaveGame* Snapshot, const FString& SlotName, int32 SlotUserIndex, TArray<uint8>& SaveData);
+
+	/** Background write finished (game thread) */
+	void OnSaveTaskComplete(UCOTMSaveGame* Snapshot, const FSaveTaskResult& Result);
+
+	/** Wait for any in-flight write to finish */
+	void WaitForInFlightSave();
+
+	/** Background load finished (game thread). bFoundSave is false when the profile has no save yet */
+	void OnAsyncLoadComplete(UCOTMSaveGame* LoadedGame, int32 NumJournalRecords, bool bFoundSave, bool bFromMainSlot);
+
+	/**
+	 * Read the newest valid data for a profile: the main slot, else autosaves newest first (any thread).
+	 * OutSlotName is the slot read; bOutFoundSave is false when no slot exists at all.
+	 */
+	static bool ReadProfileSlotData(const FString& ProfileSlotName, int32 SlotUserIndex, int32 NumAutosaves,
+		TArray<uint8>& OutData, FString& OutSlotName, bool& bOutFoundSave);
+
+	/** Apply a finished async load once the startup delay has elapsed */
+	void TryApplyPendingLoad();
+
+	/** Play time stored in the loaded save */
+	float PlayTimeAtLoad = 0.0f;
+
+	/** World time when PlayTimeAtLoad was taken */
+	double PlayTimeSessionStart = 0.0;
+
+	/** Save object from file data - archive layout or legacy property save (game thread) */
+	static UCOTMSaveGame* DeserializeSave(const TArray<uint8>& SaveData);
+
+	/** Shared tail of sync and async loads */
+	void FinishLoad(UCOTMSaveGame* LoadedGame, int32 NumJournalRecords, bool bFromMainSlot);
+
 	/** Find and cache component references */
 	void CacheComponents();
 
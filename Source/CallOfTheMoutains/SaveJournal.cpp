@@ -0,0 +1,438 @@
+// CallOfTheMoutains - Save Journal Implementation
+
+#include "SaveJournal.h"
+#include "COTMSaveGame.h"
+#include "COTMSaveArchive.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/Crc.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace
+{
+	/** Marks the start of every record ("COTJ") */
+	constexpr uint32 JournalRecordMagic = 0x434F544A;
+
+	/** Bumped when the record layout changes - records of other versions are skipped */
+	constexpr uint32 JournalRecordVersion = 4;
+
+	/** Magic, version, payload size, payload CRC */
+	constexpr int64 JournalRecordHeaderSize = sizeof(uint32) * 4;
+
+	bool SlotsMatch(const FInventorySlot& A, const FInventorySlot& B)
+	{
+		return A.ItemID == B.ItemID && A.Quantity == B.Quantity && A.AcquiredOrder == B.AcquiredOrder;
+	}
+}
+
+FArchive& operator<<(FArchive& Ar, FSaveJournalEntry& Entry)
+{
+	// Leading fields are read on their own by ReadLatestEntryInfo - keep them first
+	Ar << Entry.SnapshotId;
+	Ar << Entry.Timestamp;
+	Ar << Entry.PlayTimeSeconds;
+
+	Ar << Entry.PlayerLocation;
+	Ar << Entry.PlayerRotation;
+	Ar << Entry.HealthPercent;
+	Ar << Entry.StaminaPercent;
+	Ar << Entry.bWeaponsStowed;
+
+	Ar << Entry.bHasDayNightData;
+	Ar << Entry.GameTime.Hour;
+	Ar << Entry.GameTime.Minute;
+	Ar << Entry.GameTime.Day;
+	Ar << Entry.Weather;
+
+	Ar << Entry.bHasWeatherTimeline;
+	FCOTMSaveArchive::SerializeWeatherTimeline(Ar, Entry.WeatherTimeline);
+
+	Ar << Entry.NumInventorySlots;
+
+	int32 NumInventoryDeltas = Entry.InventoryDeltas.Num();
+	Ar << NumInventoryDeltas;
+	if (Ar.IsLoading())
+	{
+		Entry.InventoryDeltas.SetNum(FMath::Max(NumInventoryDeltas, 0));
+	}
+	for (FSaveJournalSlotDelta& Delta : Entry.InventoryDeltas)
+	{
+		Ar << Delta.SlotIndex;
+		FCOTMSaveArchive::SerializeInventorySlot(Ar, Delta.Slot);
+	}
+
+	int32 NumEquipmentDeltas = Entry.EquipmentDeltas.Num();
+	Ar << NumEquipmentDeltas;
+	if (Ar.IsLoading())
+	{
+		Entry.EquipmentDeltas.SetNum(FMath::Max(NumEquipmentDeltas, 0));
+	}
+	for (FSaveJournalEquipmentDelta& Delta : Entry.EquipmentDeltas)
+	{
+		Ar << Delta.Slot;
+		FCOTMSaveArchive::SerializeName(Ar, Delta.ItemID);
+	}
+
+	int32 NumHotbarDeltas = Entry.HotbarDeltas.Num();
+	Ar << NumHotbarDeltas;
+	if (Ar.IsLoading())
+	{
+		Entry.HotbarDeltas.SetNum(FMath::Max(NumHotbarDeltas, 0));
+	}
+	for (FSaveJournalHotbarDelta& Delta : Entry.HotbarDeltas)
+	{
+		Ar << Delta.Slot;
+
+		int32 NumItems = Delta.AssignedItems.Num();
+		Ar << NumItems;
+		if (Ar.IsLoading())
+		{
+			Delta.AssignedItems.SetNum(FMath::Max(NumItems, 0));
+		}
+		for (FName& ItemID : Delta.AssignedItems)
+		{
+			FCOTMSaveArchive::SerializeName(Ar, ItemID);
+		}
+
+		Ar << Delta.CurrentIndex;
+	}
+
+	int32 NumWorldStateDeltas = Entry.WorldStateDeltas.Num();
+	Ar << NumWorldStateDeltas;
+	if (Ar.IsLoading())
+	{
+		Entry.WorldStateDeltas.SetNum(FMath::Max(NumWorldStateDeltas, 0));
+	}
+	for (FSavedWorldStateLevel& Delta : Entry.WorldStateDeltas)
+	{
+		FCOTMSaveArchive::SerializeWorldStateLevel(Ar, Delta);
+	}
+
+	return Ar;
+}
+
+FString FSaveJournal::GetJournalPath(const FString& SlotName)
+{
+	// Same folder the generic save system writes slots to
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("SaveGames"), SlotName + TEXT(".journal"));
+}
+
+FSaveJournalEntry FSaveJournal::Diff(const UCOTMSaveGame* Baseline, const UCOTMSaveGame* Current, uint32 SnapshotId)
+{
+	FSaveJournalEntry Entry;
+	Entry.SnapshotId = SnapshotId;
+	Entry.Timestamp = Current->SaveTimestamp;
+	Entry.PlayTimeSeconds = Current->PlayTimeSeconds;
+
+	Entry.PlayerLocation = Current->PlayerLocation;
+	Entry.PlayerRotation = Current->PlayerRotation;
+	Entry.HealthPercent = Current->HealthPercent;
+	Entry.StaminaPercent = Current->StaminaPercent;
+	Entry.bWeaponsStowed = Current->bWeaponsStowed;
+
+	Entry.bHasDayNightData = Current->bHasDayNightData;
+	Entry.GameTime = Current->CurrentGameTime;
+	Entry.Weather = Current->CurrentWeather;
+
+	// Timeline cursor is a few bytes and moves with every save - always written
+	Entry.bHasWeatherTimeline = Current->bHasWeatherTimeline;
+	Entry.WeatherTimeline = Current->WeatherTimeline;
+
+	// Inventory - only slots whose contents differ
+	Entry.NumInventorySlots = Current->InventorySlots.Num();
+	for (int32 i = 0; i < Current->InventorySlots.Num(); ++i)
+	{
+		const FInventorySlot& Slot = Current->InventorySlots[i];
+		if (!Baseline->InventorySlots.IsValidIndex(i) || !SlotsMatch(Baseline->InventorySlots[i], Slot))
+		{
+			FSaveJournalSlotDelta& Delta = Entry.InventoryDeltas.AddDefaulted_GetRef();
+			Delta.SlotIndex = i;
+			Delta.Slot = Slot;
+		}
+	}
+
+	// Equipment - changed or newly equipped, then unequipped
+	for (const TPair<EEquipmentSlot, FName>& Pair : Current->EquippedItems)
+	{
+		const FName* BaselineItem = Baseline->EquippedItems.Find(Pair.Key);
+		if (!BaselineItem || *BaselineItem != Pair.Value)
+		{
+			Entry.EquipmentDeltas.Add({ Pair.Key, Pair.Value });
+		}
+	}
+	for (const TPair<EEquipmentSlot, FName>& Pair : Baseline->EquippedItems)
+	{
+		if (!Current->EquippedItems.Contains(Pair.Key))
+		{
+			Entry.EquipmentDeltas.Add({ Pair.Key, NAME_None });
+		}
+	}
+
+	// Hotbar - whole slot when its assignment or selection changed
+	for (const TPair<EHotbarSlot, FSavedHotbarSlot>& Pair : Current->HotbarSlots)
+	{
+		const FSavedHotbarSlot* BaselineSlot = Baseline->HotbarSlots.Find(Pair.Key);
+		if (!BaselineSlot || BaselineSlot->CurrentIndex != Pair.Value.CurrentIndex || BaselineSlot->AssignedItems != Pair.Value.AssignedItems)
+		{
+			FSaveJournalHotbarDelta& Delta = Entry.HotbarDeltas.AddDefaulted_GetRef();
+			Delta.Slot = Pair.Key;
+			Delta.AssignedItems = Pair.Value.AssignedItems;
+			Delta.CurrentIndex = Pair.Value.CurrentIndex;
+		}
+	}
+
+	// World state - levels whose packed records differ (levels are never removed)
+	for (const FSavedWorldStateLevel& Level : Current->WorldStateLevels)
+	{
+		const FSavedWorldStateLevel* BaselineLevel = Baseline->WorldStateLevels.FindByPredicate(
+			[&Level](const FSavedWorldStateLevel& Other) { return Other.LevelName == Level.LevelName; });
+		if (!BaselineLevel || BaselineLevel->PackedRecords != Level.PackedRecords)
+		{
+			Entry.WorldStateDeltas.Add(Level);
+		}
+	}
+
+	return Entry;
+}
+
+void FSaveJournal::Apply(const FSaveJournalEntry& Entry, UCOTMSaveGame* SaveObject)
+{
+	SaveObject->SaveTimestamp = Entry.Timestamp;
+	SaveObject->PlayTimeSeconds = Entry.PlayTimeSeconds;
+
+	SaveObject->PlayerLocation = Entry.PlayerLocation;
+	SaveObject->PlayerRotation = Entry.PlayerRotation;
+	SaveObject->HealthPercent = Entry.HealthPercent;
+	SaveObject->StaminaPercent = Entry.StaminaPercent;
+	SaveObject->bWeaponsStowed = Entry.bWeaponsStowed;
+
+	if (Entry.bHasDayNightData)
+	{
+		SaveObject->bHasDayNightData = true;
+		SaveObject->CurrentGameTime = Entry.GameTime;
+		SaveObject->CurrentWeather = Entry.Weather;
+	}
+
+	if (Entry.bHasWeatherTimeline)
+	{
+		SaveObject->bHasWeatherTimeline = true;
+		SaveObject->WeatherTimeline = Entry.WeatherTimeline;
+	}
+
+	SaveObject->InventorySlots.SetNum(FMath::Max(Entry.NumInventorySlots, 0));
+	for (const FSaveJournalSlotDelta& Delta : Entry.InventoryDeltas)
+	{
+		if (SaveObject->InventorySlots.IsValidIndex(Delta.SlotIndex))
+		{
+			SaveObject->InventorySlots[Delta.SlotIndex] = Delta.Slot;
+		}
+	}
+
+	for (const FSaveJournalEquipmentDelta& Delta : Entry.EquipmentDeltas)
+	{
+		if (Delta.ItemID.IsNone())
+		{
+			SaveObject->EquippedItems.Remove(Delta.Slot);
+		}
+		else
+		{
+			SaveObject->EquippedItems.Add(Delta.Slot, Delta.ItemID);
+		}
+	}
+
+	for (const FSaveJournalHotbarDelta& Delta : Entry.HotbarDeltas)
+	{
+		FSavedHotbarSlot& Slot = SaveObject->HotbarSlots.FindOrAdd(Delta.Slot);
+		Slot.AssignedItems = Delta.AssignedItems;
+		Slot.CurrentIndex = Delta.CurrentIndex;
+	}
+
+	for (const FSavedWorldStateLevel& Delta : Entry.WorldStateDeltas)
+	{
+		FSavedWorldStateLevel* Level = SaveObject->WorldStateLevels.FindByPredicate(
+			[&Delta](const FSavedWorldStateLevel& Other) { return Other.LevelName == Delta.LevelName; });
+		if (Level)
+		{
+			Level->PackedRecords = Delta.PackedRecords;
+		}
+		else
+		{
+			SaveObject->WorldStateLevels.Add(Delta);
+		}
+	}
+}
+
+int32 FSaveJournal::Replay(const TArray<FSaveJournalEntry>& Entries, UCOTMSaveGame* SaveObject)
+{
+	int32 NumApplied = 0;
+	for (const FSaveJournalEntry& Entry : Entries)
+	{
+		if (Entry.SnapshotId == SaveObject->JournalSnapshotId)
+		{
+			Apply(Entry, SaveObject);
+			++NumApplied;
+		}
+	}
+	return NumApplied;
+}
+
+bool FSaveJournal::AppendEntry(const FString& JournalPath, FSaveJournalEntry& Entry, int32& OutBytesWritten)
+{
+	OutBytesWritten = 0;
+
+	TArray<uint8> Payload;
+	FMemoryWriter PayloadWriter(Payload);
+	PayloadWriter << Entry;
+
+	uint32 Magic = JournalRecordMagic;
+	uint32 Version = JournalRecordVersion;
+	uint32 PayloadSize = Payload.Num();
+	uint32 PayloadCrc = FCrc::MemCrc32(Payload.GetData(), Payload.Num());
+
+	TArray<uint8> Record;
+	Record.Reserve(JournalRecordHeaderSize + Payload.Num());
+	FMemoryWriter RecordWriter(Record);
+	RecordWriter << Magic << Version << PayloadSize << PayloadCrc;
+	RecordWriter.Serialize(Payload.GetData(), Payload.Num());
+
+	TUniquePtr<FArchive> FileWriter(IFileManager::Get().CreateFileWriter(*JournalPath, FILEWRITE_Append | FILEWRITE_AllowRead));
+	if (!FileWriter)
+	{
+		return false;
+	}
+
+	FileWriter->Serialize(Record.GetData(), Record.Num());
+	if (!FileWriter->Close())
+	{
+		return false;
+	}
+
+	OutBytesWritten = Record.Num();
+	return true;
+}
+
+void FSaveJournal::ReadEntries(const FString& JournalPath, TArray<FSaveJournalEntry>& OutEntries)
+{
+	TArray<uint8> FileData;
+	if (!FFileHelper::LoadFileToArray(FileData, *JournalPath, FILEREAD_Silent))
+	{
+		return;
+	}
+
+	FMemoryReader Reader(FileData);
+	while (Reader.TotalSize() - Reader.Tell() >= JournalRecordHeaderSize)
+	{
+		uint32 Magic = 0;
+		uint32 Version = 0;
+		uint32 PayloadSize = 0;
+		uint32 PayloadCrc = 0;
+		Reader << Magic << Version << PayloadSize << PayloadCrc;
+
+		if (Magic != JournalRecordMagic || PayloadSize > Reader.TotalSize() - Reader.Tell())
+		{
+			UE_LOG(LogTemp, Warning, TEXT("SaveJournal: Torn record in %s - replay stops at offset %lld"), *JournalPath, Reader.Tell() - JournalRecordHeaderSize);
+			return;
+		}
+
+		const uint8* Payload = FileData.GetData() + Reader.Tell();
+		Reader.Seek(Reader.Tell() + PayloadSize);
+
+		if (FCrc::MemCrc32(Payload, PayloadSize) != PayloadCrc)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("SaveJournal: Corrupt record in %s - replay stops"), *JournalPath);
+			return;
+		}
+
+		// Each record diffs against the state the previous ones produced - replaying past a skipped record would apply on the wrong base
+		if (Version != JournalRecordVersion)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("SaveJournal: Record version %u in %s (expected %u) - replay stops"), Version, *JournalPath, JournalRecordVersion);
+			return;
+		}
+
+		TArray<uint8> PayloadData(Payload, PayloadSize);
+		FMemoryReader PayloadReader(PayloadData);
+		PayloadReader << OutEntries.AddDefaulted_GetRef();
+	}
+}
+
+bool FSaveJournal::ReadLatestEntryInfo(const FString& JournalPath, uint32 SnapshotId, FDateTime& OutTimestamp, float& OutPlayTimeSeconds)
+{
+	TUniquePtr<FArchive> FileReader(IFileManager::Get().CreateFileReader(*JournalPath, FILEREAD_Silent));
+	if (!FileReader)
+	{
+		return false;
+	}
+
+	struct FRecordFrame
+	{
+		int64 PayloadOffset = 0;
+		uint32 PayloadSize = 0;
+		uint32 PayloadCrc = 0;
+	};
+
+	// Walk the record headers only, seeking past payloads (same stop rules as ReadEntries)
+	TArray<FRecordFrame> Frames;
+	const int64 FileSize = FileReader->TotalSize();
+	while (FileSize - FileReader->Tell() >= JournalRecordHeaderSize)
+	{
+		uint32 Magic = 0;
+		uint32 Version = 0;
+		FRecordFrame& Frame = Frames.AddDefaulted_GetRef();
+		*FileReader << Magic << Version << Frame.PayloadSize << Frame.PayloadCrc;
+		Frame.PayloadOffset = FileReader->Tell();
+
+		if (FileReader->IsError() || Magic != JournalRecordMagic || Version != JournalRecordVersion
+			|| Frame.PayloadSize > FileSize - Frame.PayloadOffset)
+		{
+			Frames.Pop();
+			break;
+		}
+
+		FileReader->Seek(Frame.PayloadOffset + Frame.PayloadSize);
+	}
+
+	// Newest first - peek the snapshot id, and only CRC-check the payload that matches
+	TArray<uint8> Payload;
+	for (int32 i = Frames.Num() - 1; i >= 0; --i)
+	{
+		const FRecordFrame& Frame = Frames[i];
+		uint32 EntrySnapshotId = 0;
+		FileReader->Seek(Frame.PayloadOffset);
+		*FileReader << EntrySnapshotId;
+		if (FileReader->IsError() || EntrySnapshotId != SnapshotId)
+		{
+			continue;
+		}
+
+		Payload.SetNumUninitialized(Frame.PayloadSize);
+		FileReader->Seek(Frame.PayloadOffset);
+		FileReader->Serialize(Payload.GetData(), Payload.Num());
+		if (FileReader->IsError() || FCrc::MemCrc32(Payload.GetData(), Payload.Num()) != Frame.PayloadCrc)
+		{
+			continue;
+		}
+
+		FDateTime Timestamp;
+		float PlayTimeSeconds = 0.0f;
+		FMemoryReader PayloadReader(Payload);
+		PayloadReader << EntrySnapshotId << Timestamp << PlayTimeSeconds;
+		if (PayloadReader.IsError())
+		{
+			return false;
+		}
+
+		OutTimestamp = Timestamp;
+		OutPlayTimeSeconds = PlayTimeSeconds;
+		return true;
+	}
+
+	return false;
+}
+
+bool FSaveJournal::DeleteJournal(const FString& JournalPath)
+{
+	return IFileManager::Get().Delete(*JournalPath, false, false, true);
+}
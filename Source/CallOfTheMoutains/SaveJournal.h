@@ -0,0 +1,108 @@
+// CallOfTheMoutains - Save Journal
+// Append-only delta records written between full save snapshots
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ItemTypes.h"
+#include "DayNightTypes.h"
+#include "COTMSaveGame.h"
+
+class UCOTMSaveGame;
+
+/** Inventory slot contents after a change */
+struct FSaveJournalSlotDelta
+{
+	int32 SlotIndex = 0;
+	FInventorySlot Slot;
+};
+
+/** Equipment slot contents after a change (NAME_None = unequipped) */
+struct FSaveJournalEquipmentDelta
+{
+	EEquipmentSlot Slot = EEquipmentSlot::None;
+	FName ItemID;
+};
+
+/** Hotbar slot contents after a change */
+struct FSaveJournalHotbarDelta
+{
+	EHotbarSlot Slot = EHotbarSlot::Special;
+	TArray<FName> AssignedItems;
+	int32 CurrentIndex = 0;
+};
+
+/**
+ * One journal record - everything that changed since the previous record (or the snapshot).
+ * Small per-player values are always written; inventory, equipment, hotbar and world state
+ * only as deltas.
+ */
+struct FSaveJournalEntry
+{
+	/** Snapshot this record applies on top of - records of older snapshots are ignored */
+	uint32 SnapshotId = 0;
+
+	FDateTime Timestamp;
+	float PlayTimeSeconds = 0.0f;
+
+	FVector PlayerLocation = FVector::ZeroVector;
+	FRotator PlayerRotation = FRotator::ZeroRotator;
+	float HealthPercent = 1.0f;
+	float StaminaPercent = 1.0f;
+	bool bWeaponsStowed = false;
+
+	bool bHasDayNightData = false;
+	FCOTMGameTime GameTime;
+	EWeatherType Weather = EWeatherType::Clear;
+
+	bool bHasWeatherTimeline = false;
+	FWeatherTimelineCursor WeatherTimeline;
+
+	/** Inventory slot count (slots past it are dropped on apply) */
+	int32 NumInventorySlots = 0;
+
+	TArray<FSaveJournalSlotDelta> InventoryDeltas;
+	TArray<FSaveJournalEquipmentDelta> EquipmentDeltas;
+	TArray<FSaveJournalHotbarDelta> HotbarDeltas;
+
+	/** World state levels whose records changed (whole level - they're small and packed already) */
+	TArray<FSavedWorldStateLevel> WorldStateDeltas;
+
+	/** Whether inventory, equipment or hotbar changed */
+	bool HasItemDeltas() const { return InventoryDeltas.Num() > 0 || EquipmentDeltas.Num() > 0 || HotbarDeltas.Num() > 0; }
+
+	friend FArchive& operator<<(FArchive& Ar, FSaveJournalEntry& Entry);
+};
+
+/**
+ * Save Journal
+ * Journal file sits next to the slot's save file. Each record is framed with its size and a
+ * CRC, so a record torn by a crash mid-append ends replay instead of corrupting the load.
+ * File access is thread-safe; Diff/Apply touch save objects and run on the game thread.
+ */
+struct CALLOFTHEMOUTAINS_API FSaveJournal
+{
+	/** Journal file path for a save slot */
+	static FString GetJournalPath(const FString& SlotName);
+
+	/** Build a record of what changed from Baseline to Current */
+	static FSaveJournalEntry Diff(const UCOTMSaveGame* Baseline, const UCOTMSaveGame* Current, uint32 SnapshotId);
+
+	/** Replay a record onto a save object */
+	static void Apply(const FSaveJournalEntry& Entry, UCOTMSaveGame* SaveObject);
+
+	/** Replay every record belonging to the save object's snapshot. Returns the number applied */
+	static int32 Replay(const TArray<FSaveJournalEntry>& Entries, UCOTMSaveGame* SaveObject);
+
+	/** Append one record to the journal file */
+	static bool AppendEntry(const FString& JournalPath, FSaveJournalEntry& Entry, int32& OutBytesWritten);
+
+	/** Read every intact record, in write order (stops at the first torn, corrupt or other-version record) */
+	static void ReadEntries(const FString& JournalPath, TArray<FSaveJournalEntry>& OutEntries);
+
+	/** Timestamp and play time of the newest intact record for a snapshot, without decoding whole records */
+	static bool ReadLatestEntryInfo(const FString& JournalPath, uint32 SnapshotId, FDateTime& OutTimestamp, float& OutPlayTimeSeconds);
+
+	/** Remove the journal file (after a full snapshot made it redundant) */
+	static bool DeleteJournal(const FString& JournalPath);
+};
@@ -0,0 +1,269 @@
+// CallOfTheMoutains - Save Slot Subsystem Implementation
+
+#include "SaveSlotSubsystem.h"
+#include "COTMSaveArchive.h"
+#include "CallOfTheMoutains.h"
+#include "Async/Async.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Save Slots Cached"), STAT_SaveSlotsCached, STATGROUP_CallOfTheMoutains);
+
+namespace
+{
+	const TCHAR* AutosaveSuffix = TEXT("_Auto");
+
+	/** Whether a slot name is a rotating autosave ("..._Auto<N>") */
+	bool IsAutosaveSlotName(const FString& SlotName)
+	{
+		const int32 SuffixIndex = SlotName.Find(AutosaveSuffix, ESearchCase::CaseSensitive, ESearchDir::FromEnd);
+		if (SuffixIndex == INDEX_NONE)
+		{
+			return false;
+		}
+
+		const FString Number = SlotName.Mid(SuffixIndex + FCString::Strlen(AutosaveSuffix));
+		return Number.Len() > 0 && Number.IsNumeric();
+	}
+}
+
+USaveSlotSubsystem* USaveSlotSubsystem::Get(const UObject* WorldContextObject)
+{
+	UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+	return GameInstance ? GameInstance->GetSubsystem<USaveSlotSubsystem>() : nullptr;
+}
+
+void USaveSlotSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	RefreshAsync();
+}
+
+void USaveSlotSubsystem::Deinitialize()
+{
+	Slots.Empty();
+	ChangedDuringEnumeration.Empty();
+	bEnumerationComplete = false;
+	bEnumerating = false;
+
+	Super::Deinitialize();
+}
+
+FString USaveSlotSubsystem::MakeProfileSlotName(const FString& BaseSlotName, const FString& ProfileName)
+{
+	return ProfileName.IsEmpty() ? BaseSlotName : FString::Printf(TEXT("%s_%s"), *BaseSlotName, *ProfileName);
+}
+
+FString USaveSlotSubsystem::MakeAutosaveSlotName(const FString& ProfileSlotName, int32 AutosaveIndex)
+{
+	return FString::Printf(TEXT("%s%s%d"), *ProfileSlotName, AutosaveSuffix, AutosaveIndex);
+}
+
+bool USaveSlotSubsystem::GetSlotInfo(const FString& SlotName, FCOTMSaveSlotInfo& OutInfo) const
+{
+	if (const FCOTMSaveSlotInfo* Info = Slots.Find(SlotName))
+	{
+		OutInfo = *Info;
+		return true;
+	}
+	return false;
+}
+
+TArray<FString> USaveSlotSubsystem::GetProfiles(const FString& BaseSlotName) const
+{
+	TArray<FString> Profiles;
+	const FString ProfilePrefix = BaseSlotName + TEXT("_");
+
+	for (const TPair<FString, FCOTMSaveSlotInfo>& Pair : Slots)
+	{
+		const FString& SlotName = Pair.Key;
+		if (IsAutosaveSlotName(SlotName))
+		{
+			continue;
+		}
+
+		if (SlotName == BaseSlotName)
+		{
+			Profiles.AddUnique(FString());
+		}
+		else if (SlotName.StartsWith(ProfilePrefix, ESearchCase::CaseSensitive))
+		{
+			Profiles.AddUnique(SlotName.RightChop(ProfilePrefix.Len()));
+		}
+	}
+
+	Profiles.Sort();
+	return Profiles;
+}
+
+TArray<FCOTMSaveSlotInfo> USaveSlotSubsystem::GetProfileSlots(const FString& ProfileSlotName, int32 NumAutosaveSlots) const
+{
+	TArray<FCOTMSaveSlotInfo> Result;
+
+	if (const FCOTMSaveSlotInfo* Info = Slots.Find(ProfileSlotName))
+	{
+		Result.Add(*Info);
+	}
+
+	for (int32 i = 0; i < NumAutosaveSlots; ++i)
+	{
+		if (const FCOTMSaveSlotInfo* Info = Slots.Find(MakeAutosaveSlotName(ProfileSlotName, i)))
+		{
+			Result.Add(*Info);
+		}
+	}
+
+	Result.Sort([](const FCOTMSaveSlotInfo& A, const FCOTMSaveSlotInfo& B)
+	{
+		return A.SaveTimestamp > B.SaveTimestamp;
+	});
+	return Result;
+}
+
+TArray<TOptional<FCOTMSaveSlotInfo>> USaveSlotSubsystem::GetAutosaveSlotInfos(const FString& ProfileSlotName, int32 NumAutosaveSlots) const
+{
+	TArray<TOptional<FCOTMSaveSlotInfo>> SlotInfos;
+	SlotInfos.SetNum(FMath::Max(NumAutosaveSlots, 0));
+
+	for (int32 i = 0; i < SlotInfos.Num(); ++i)
+	{
+		const FString SlotName = MakeAutosaveSlotName(ProfileSlotName, i);
+		if (const FCOTMSaveSlotInfo* Info = Slots.Find(SlotName))
+		{
+			SlotInfos[i] = *Info;
+		}
+		else if (bEnumerationComplete || ChangedDuringEnumeration.Contains(SlotName))
+		{
+			// Known unused (default info is invalid)
+			SlotInfos[i] = FCOTMSaveSlotInfo();
+		}
+
+		// Otherwise left unset - it may just not be read yet, and overwriting it could lose the newest autosave
+	}
+
+	return SlotInfos;
+}
+
+FString USaveSlotSubsystem::PickAutosaveSlot(const FString& ProfileSlotName, const TArray<TOptional<FCOTMSaveSlotInfo>>& SlotInfos, int32 UserIndex)
+{
+	FString OldestSlot;
+	FDateTime OldestTimestamp = FDateTime::MaxValue();
+
+	for (int32 i = 0; i < SlotInfos.Num(); ++i)
+	{
+		const FString SlotName = MakeAutosaveSlotName(ProfileSlotName, i);
+
+		FCOTMSaveSlotInfo Info;
+		if (SlotInfos[i].IsSet())
+		{
+			Info = SlotInfos[i].GetValue();
+		}
+		else
+		{
+			FCOTMSaveArchive::PeekSlot(SlotName, UserIndex, Info);
+		}
+
+		if (!Info.bValid)
+		{
+			return SlotName;
+		}
+
+		if (Info.SaveTimestamp < OldestTimestamp)
+		{
+			OldestTimestamp = Info.SaveTimestamp;
+			OldestSlot = SlotName;
+		}
+	}
+
+	return OldestSlot;
+}
+
+void USaveSlotSubsystem::RefreshAsync()
+{
+	if (bEnumerating)
+	{
+		return;
+	}
+
+	bEnumerating = true;
+	ChangedDuringEnumeration.Reset();
+
+	TWeakObjectPtr<USaveSlotSubsystem> WeakThis(this);
+	Async(EAsyncExecution::ThreadPool, [WeakThis]()
+	{
+		TArray<FString> SlotNames;
+		FCOTMSaveArchive::FindSlotNames(SlotNames);
+
+		TArray<FCOTMSaveSlotInfo> FoundSlots;
+		FoundSlots.Reserve(SlotNames.Num());
+		for (const FString& SlotName : SlotNames)
+		{
+			FCOTMSaveSlotInfo Info;
+			if (FCOTMSaveArchive::PeekSlot(SlotName, 0, Info))
+			{
+				FoundSlots.Add(MoveTemp(Info));
+			}
+		}
+
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, FoundSlots = MoveTemp(FoundSlots)]() mutable
+		{
+			if (USaveSlotSubsystem* This = WeakThis.Get())
+			{
+				This->OnEnumerationComplete(MoveTemp(FoundSlots));
+			}
+		});
+	});
+}
+
+void USaveSlotSubsystem::OnEnumerationComplete(TArray<FCOTMSaveSlotInfo>&& FoundSlots)
+{
+	// Drop entries the disk no longer has, except ones this session just wrote
+	for (auto It = Slots.CreateIterator(); It; ++It)
+	{
+		if (!ChangedDuringEnumeration.Contains(It.Key()))
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	for (FCOTMSaveSlotInfo& Info : FoundSlots)
+	{
+		if (!ChangedDuringEnumeration.Contains(Info.SlotName))
+		{
+			Slots.Add(Info.SlotName, MoveTemp(Info));
+		}
+	}
+
+	ChangedDuringEnumeration.Reset();
+	bEnumerating = false;
+	bEnumerationComplete = true;
+
+	SET_DWORD_STAT(STAT_SaveSlotsCached, Slots.Num());
+	OnSlotsChanged.Broadcast();
+}
+
+void USaveSlotSubsystem::NotifySlotWritten(const FCOTMSaveSlotInfo& Info)
+{
+	Slots.Add(Info.SlotName, Info);
+	if (bEnumerating)
+	{
+		ChangedDuringEnumeration.Add(Info.SlotName);
+	}
+
+	SET_DWORD_STAT(STAT_SaveSlotsCached, Slots.Num());
+	OnSlotsChanged.Broadcast();
+}
+
+void USaveSlotSubsystem::NotifySlotDeleted(const FString& SlotName)
+{
+	Slots.Remove(SlotName);
+	if (bEnumerating)
+	{
+		ChangedDuringEnumeration.Add(SlotName);
+	}
+
+	SET_DWORD_STAT(STAT_SaveSlotsCached, Slots.Num());
+	OnSlotsChanged.Broadcast();
+}
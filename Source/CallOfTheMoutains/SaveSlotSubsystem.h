@@ -0,0 +1,104 @@
+// CallOfTheMoutains - Save Slot Subsystem
+// Cached save slot metadata (profiles, autosaves) enumerated off the game thread
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "COTMSaveGame.h"
+#include "SaveSlotSubsystem.generated.h"
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnSaveSlotsChanged);
+
+/**
+ * Save Slot Subsystem
+ * Slot names: "<Base>" for the default profile, "<Base>_<Profile>" for named profiles, and
+ * "<ProfileSlot>_Auto<N>" for a profile's rotating autosaves.
+ *
+ * At startup every slot file is peeked (header only) on a background task. Afterwards the cache
+ * is kept current by USaveGameManager reporting its writes and deletes, so title and menu
+ * screens read slot lists, timestamps and play times without touching the disk.
+ */
+UCLASS()
+class CALLOFTHEMOUTAINS_API USaveSlotSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Get the subsystem for a world context (nullptr if unavailable) */
+	static USaveSlotSubsystem* Get(const UObject* WorldContextObject);
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	// ==================== Slot Names ====================
+
+	/** Main slot of a profile (empty profile = default) */
+	static FString MakeProfileSlotName(const FString& BaseSlotName, const FString& ProfileName);
+
+	/** Rotating autosave slot of a profile slot */
+	static FString MakeAutosaveSlotName(const FString& ProfileSlotName, int32 AutosaveIndex);
+
+	// ==================== Queries ====================
+
+	/** Background enumeration has finished (before that, queries only know slots written this session) */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "SaveGame|Slots")
+	bool IsEnumerationComplete() const { return bEnumerationComplete; }
+
+	/** Cached metadata for a slot. Returns false if the slot is not known */
+	UFUNCTION(BlueprintCallable, Category = "SaveGame|Slots")
+	bool GetSlotInfo(const FString& SlotName, FCOTMSaveSlotInfo& OutInfo) const;
+
+	/** Whether a slot is known to exist */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "SaveGame|Slots")
+	bool DoesSlotExist(const FString& SlotName) const { return Slots.Contains(SlotName); }
+
+	/** Profiles with a main slot ("" = default profile) */
+	UFUNCTION(BlueprintCallable, Category = "SaveGame|Slots")
+	TArray<FString> GetProfiles(const FString& BaseSlotName) const;
+
+	/** A profile's main slot and existing autosaves, newest first */
+	UFUNCTION(BlueprintCallable, Category = "SaveGame|Slots")
+	TArray<FCOTMSaveSlotInfo> GetProfileSlots(const FString& ProfileSlotName, int32 NumAutosaveSlots) const;
+
+	/**
+	 * Cached state of a profile's autosave slots, for PickAutosaveSlot. Entries are unset where
+	 * the cache can't answer yet (not enumerated), and invalid where the slot is known unused.
+	 */
+	TArray<TOptional<FCOTMSaveSlotInfo>> GetAutosaveSlotInfos(const FString& ProfileSlotName, int32 NumAutosaveSlots) const;
+
+	/**
+	 * Autosave slot to write next - the first unused one, otherwise the oldest.
+	 * Unset entries are peeked from disk, so call it off the game thread (any thread).
+	 */
+	static FString PickAutosaveSlot(const FString& ProfileSlotName, const TArray<TOptional<FCOTMSaveSlotInfo>>& SlotInfos, int32 UserIndex);
+
+	/** Re-enumerate slot files in the background */
+	UFUNCTION(BlueprintCallable, Category = "SaveGame|Slots")
+	void RefreshAsync();
+
+	// ==================== Cache Updates ====================
+
+	/** A slot was written (game thread) */
+	void NotifySlotWritten(const FCOTMSaveSlotInfo& Info);
+
+	/** A slot was deleted (game thread) */
+	void NotifySlotDeleted(const FString& SlotName);
+
+	/** Broadcast when enumeration completes or a slot is written/deleted */
+	UPROPERTY(BlueprintAssignable, Category = "SaveGame|Slots")
+	FOnSaveSlotsChanged OnSlotsChanged;
+
+protected:
+	/** Slot name -> header info */
+	TMap<FString, FCOTMSaveSlotInfo> Slots;
+
+	/** Slots written or deleted while an enumeration was running - their cached state is newer */
+	TSet<FString> ChangedDuringEnumeration;
+
+	bool bEnumerationComplete = false;
+	bool bEnumerating = false;
+
+	/** Merge a finished enumeration (game thread) */
+	void OnEnumerationComplete(TArray<FCOTMSaveSlotInfo>&& FoundSlots);
+};
@@ -29,6 +29,9 @@
 #include "Animation/AnimInstance.h"
 #include "Animation/AnimMontage.h"
 #include "ExoMovementComponent.h"
+#include "CallOfTheMoutains.h"
+
+DECLARE_CYCLE_STAT(TEXT("Player Character Tick"), STAT_PlayerCharacterTick, STATGROUP_CallOfTheMoutains);
 
 ASoulsLikeCharacter::ASoulsLikeCharacter()
 {
@@ -129,6 +132,13 @@ void ASoulsLikeCharacter::BeginPlay()
 			{
 				Subsystem->AddMappingContext(DefaultMappingContext, 0);
 			}
+
+			// Above the default context, which also maps Shift/WASD/Space
+			if (!KeyMappingContext)
+			{
+				KeyMappingContext = KeyActions.CreateDefaultMappings(this);
+			}
+			Subsystem->AddMappingContext(KeyMappingContext, 1);
 		}
 
 		// Get components from Controller
@@ -239,42 +249,55 @@ void ASoulsLikeCharacter::SetupPlayerInputComponent(UInputComponent* PlayerInput
 			EnhancedInputComponent->BindAction(JumpAction, ETriggerEvent::Started, this, &ASoulsLikeCharacter::Jump);
 			EnhancedInputComponent->BindAction(JumpAction, ETriggerEvent::Completed, this, &ACharacter::StopJumping);
 		}
-		// Note: bJumpHeld tracking is done via direct key polling in Tick
 
-		// Combat (LMB, RMB, Q, C) uses direct key polling in Tick -> HandleCombatInput()
-		// Hotbar (Arrow keys, I) uses direct key polling in Tick -> HandleHotbarInput()
+		// Combat (LMB, RMB, Q, C), hotbar (Arrow keys, I), interaction (E) and jump-held tracking
+		BindKeyActions(EnhancedInputComponent);
+
 		// Lock-on is handled by SoulsLikePlayerController
 	}
 }
 
+void ASoulsLikeCharacter::BindKeyActions(UEnhancedInputComponent* EnhancedInputComponent)
+{
+	if (!KeyMappingContext)
+	{
+		// Registered with the input subsystem in BeginPlay
+		KeyMappingContext = KeyActions.CreateDefaultMappings(this);
+	}
+
+	// Combat
+	EnhancedInputComponent->BindAction(KeyActions.LightAttack, ETriggerEvent::Started, this, &ASoulsLikeCharacter::OnLightAttackInput);
+	EnhancedInputComponent->BindAction(KeyActions.HeavyAttack, ETriggerEvent::Started, this, &ASoulsLikeCharacter::OnHeavyAttackInput);
+	EnhancedInputComponent->BindAction(KeyActions.Guard, ETriggerEvent::Started, this, &ASoulsLikeCharacter::OnGuardStarted);
+	EnhancedInputComponent->BindAction(KeyActions.Guard, ETriggerEvent::Completed, this, &ASoulsLikeCharacter::OnGuardCompleted);
+	EnhancedInputComponent->BindAction(KeyActions.ToggleStow, ETriggerEvent::Started, this, &ASoulsLikeCharacter::OnToggleStowInput);
+
+	// Hotbar / Inventory / Interaction
+	EnhancedInputComponent->BindAction(KeyActions.HotbarUp, ETriggerEvent::Started, this, &ASoulsLikeCharacter::HandleHotbarUp);
+	EnhancedInputComponent->BindAction(KeyActions.HotbarDown, ETriggerEvent::Started, this, &ASoulsLikeCharacter::HandleHotbarDown);
+	EnhancedInputComponent->BindAction(KeyActions.HotbarLeft, ETriggerEvent::Started, this, &ASoulsLikeCharacter::HandleHotbarLeft);
+	EnhancedInputComponent->BindAction(KeyActions.HotbarRight, ETriggerEvent::Started, this, &ASoulsLikeCharacter::HandleHotbarRight);
+	EnhancedInputComponent->BindAction(KeyActions.ToggleInventory, ETriggerEvent::Started, this, &ASoulsLikeCharacter::ToggleInventory);
+	EnhancedInputComponent->BindAction(KeyActions.Interact, ETriggerEvent::Started, this, &ASoulsLikeCharacter::OnInteractInput);
+
+	// Jump held - Triggered fires every frame while held, so ledge checks only run while space is down
+	EnhancedInputComponent->BindAction(KeyActions.Jump, ETriggerEvent::Triggered, this, &ASoulsLikeCharacter::OnJumpHeld);
+	EnhancedInputComponent->BindAction(KeyActions.Jump, ETriggerEvent::Completed, this, &ASoulsLikeCharacter::OnJumpReleased);
+}
+
 void ASoulsLikeCharacter::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
 
+	// Input is event-driven (see BindKeyActions) - only camera work runs here
+	SCOPE_CYCLE_COUNTER(STAT_PlayerCharacterTick);
+
 	// Update camera
 	UpdateCamera(DeltaTime);
 
 	// Handle camera clipping (hide mesh when camera too close)
 	UpdateCameraClipping();
 
-	// Handle hotbar input (Arrow keys + I key)
-	HandleHotbarInput();
-
-	// Handle interaction input (E key)
-	HandleInteractionInput();
-
-	// Handle combat input (LMB, RMB, Q, C)
-	HandleCombatInput();
-
-	// Track jump held for ledge grab (direct key polling)
-	if (APlayerController* PC = Cast<APlayerController>(Controller))
-	{
-		bJumpHeld = PC->IsInputKeyDown(EKeys::SpaceBar);
-	}
-
-	// Check for ledge grab while holding jump in air
-	CheckLedgeGrab();
-
 	// Note: Dodge is handled by SoulsLikePlayerController
 }
 
@@ -493,7 +516,7 @@ void ASoulsLikeCharacter::UpdateFreeCamera(float DeltaTime)
 }
 
 // ==================== Hotbar Input Handlers ====================
-// Direct key detection: Arrow keys = use, Ctrl+Arrow = cycle, I = inventory
+// Key actions: Arrow keys = use, Ctrl+Arrow = cycle, I = inventory
 
 bool ASoulsLikeCharacter::IsCtrlHeld() const
 {
@@ -505,52 +528,6 @@ bool ASoulsLikeCharacter::IsCtrlHeld() const
 	return false;
 }
 
-void ASoulsLikeCharacter::HandleHotbarInput()
-{
-	APlayerController* PC = Cast<APlayerController>(Controller);
-	if (!PC) return;
-
-	// Up Arrow
-	bool bUpDown = PC->IsInputKeyDown(EKeys::Up);
-	if (bUpDown && !bUpArrowWasDown)
-	{
-		HandleHotbarUp();
-	}
-	bUpArrowWasDown = bUpDown;
-
-	// Down Arrow
-	bool bDownDown = PC->IsInputKeyDown(EKeys::Down);
-	if (bDownDown && !bDownArrowWasDown)
-	{
-		HandleHotbarDown();
-	}
-	bDownArrowWasDown = bDownDown;
-
-	// Left Arrow
-	bool bLeftDown = PC->IsInputKeyDown(EKeys::Left);
-	if (bLeftDown && !bLeftArrowWasDown)
-	{
-		HandleHotbarLeft();
-	}
-	bLeftArrowWasDown = bLeftDown;
-
-	// Right Arrow
-	bool bRightDown = PC->IsInputKeyDown(EKeys::Right);
-	if (bRightDown && !bRightArrowWasDown)
-	{
-		HandleHotbarRight();
-	}
-	bRightArrowWasDown = bRightDown;
-
-	// I Key - Toggle Inventory
-	bool bIDown = PC->IsInputKeyDown(EKeys::I);
-	if (bIDown && !bIKeyWasDown)
-	{
-		ToggleInventory();
-	}
-	bIKeyWasDown = bIDown;
-}
-
 void ASoulsLikeCharacter::HandleHotbarUp()
 {
 	UEquipmentComponent* EquipComp = GetController() ? GetController()->FindComponentByClass<UEquipmentComponent>() : nullptr;
@@ -655,21 +632,13 @@ void ASoulsLikeCharacter::ToggleInventory()
 
 // ==================== Interaction Handlers ====================
 
-void ASoulsLikeCharacter::HandleInteractionInput()
+void ASoulsLikeCharacter::OnInteractInput()
 {
-	APlayerController* PC = Cast<APlayerController>(Controller);
-	if (!PC) return;
-
 	// Don't allow interaction while inventory is open
 	if (bInventoryOpen) return;
 
 	// E Key - Interact
-	bool bEDown = PC->IsInputKeyDown(EKeys::E);
-	if (bEDown && !bEKeyWasDown)
-	{
-		TryInteract();
-	}
-	bEKeyWasDown = bEDown;
+	TryInteract();
 }
 
 void ASoulsLikeCharacter::TryInteract()
@@ -746,66 +715,85 @@ void ASoulsLikeCharacter::OnPickupFocusChanged(AItemPickup* Pickup, bool bFocuse
 	}
 }
 
-// ==================== Combat Input (Direct Key Polling) ====================
+// ==================== Combat Input ====================
 
-void ASoulsLikeCharacter::HandleCombatInput()
+UEquipmentComponent* ASoulsLikeCharacter::GetCombatEquipment() const
 {
-	APlayerController* PC = Cast<APlayerController>(Controller);
-	if (!PC)
+	// Don't process combat while inventory is open
+	if (bInventoryOpen || !Controller)
 	{
-		return;
+		return nullptr;
 	}
 
-	// Don't process combat while inventory is open
-	if (bInventoryOpen) return;
+	return Controller->FindComponentByClass<UEquipmentComponent>();
+}
 
-	// Check if dodging
+bool ASoulsLikeCharacter::IsDodging() const
+{
 	ASoulsLikePlayerController* SoulsPC = Cast<ASoulsLikePlayerController>(Controller);
-	bool bDodging = SoulsPC && SoulsPC->bIsDodging;
-
-	UEquipmentComponent* EquipComp = PC->FindComponentByClass<UEquipmentComponent>();
-	if (!EquipComp)
-	{
-		return;
-	}
-
-	// Get input states
-	bool bLMB = PC->IsInputKeyDown(EKeys::LeftMouseButton);
-	bool bRMB = PC->IsInputKeyDown(EKeys::RightMouseButton);
-	bool bQ = PC->IsInputKeyDown(EKeys::Q);
-	bool bC = PC->IsInputKeyDown(EKeys::C);
+	return SoulsPC && SoulsPC->bIsDodging;
+}
 
+void ASoulsLikeCharacter::OnLightAttackInput()
+{
 	// Left Mouse Button - Light Attack
-	if (bLMB && !bLeftMouseWasDown && !bDodging)
+	UEquipmentComponent* EquipComp = GetCombatEquipment();
+	if (EquipComp && !IsDodging())
 	{
 		EquipComp->LightAttack();
 	}
-	bLeftMouseWasDown = bLMB;
+}
 
+void ASoulsLikeCharacter::OnHeavyAttackInput()
+{
 	// Right Mouse Button - Heavy Attack
-	if (bRMB && !bRightMouseWasDown && !bDodging)
+	UEquipmentComponent* EquipComp = GetCombatEquipment();
+	if (EquipComp && !IsDodging())
 	{
 		EquipComp->HeavyAttack();
 	}
-	bRightMouseWasDown = bRMB;
+}
 
+void ASoulsLikeCharacter::OnGuardStarted()
+{
 	// Q Key - Guard (hold)
-	if (bQ && !bQKeyWasDown)
+	if (UEquipmentComponent* EquipComp = GetCombatEquipment())
 	{
 		EquipComp->StartGuard();
 	}
-	else if (!bQ && bQKeyWasDown)
+}
+
+void ASoulsLikeCharacter::OnGuardCompleted()
+{
+	// Release guard even if the inventory opened mid-hold
+	UEquipmentComponent* EquipComp = Controller ? Controller->FindComponentByClass<UEquipmentComponent>() : nullptr;
+	if (EquipComp)
 	{
 		EquipComp->StopGuard();
 	}
-	bQKeyWasDown = bQ;
+}
 
+void ASoulsLikeCharacter::OnToggleStowInput()
+{
 	// C Key - Stow/Draw Weapons
-	if (bC && !bCKeyWasDown && !bDodging)
+	UEquipmentComponent* EquipComp = GetCombatEquipment();
+	if (EquipComp && !IsDodging())
 	{
 		EquipComp->ToggleWeaponStow();
 	}
-	bCKeyWasDown = bC;
+}
+
+void ASoulsLikeCharacter::OnJumpHeld()
+{
+	bJumpHeld = true;
+
+	// Check for ledge grab while holding jump in air
+	CheckLedgeGrab();
+}
+
+void ASoulsLikeCharacter::OnJumpReleased()
+{
+	bJumpHeld = false;
 }
 
 // ==================== Hit Reaction ====================
@@ -6,6 +6,7 @@
 #include "GameFramework/Character.h"
 #include "InputActionValue.h"
 #include "ItemTypes.h"
+#include "SoulsLikeKeyActions.h"
 #include "SoulsLikeCharacter.generated.h"
 
 class USpringArmComponent;
@@ -121,13 +122,13 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input")
 	UInputAction* SwitchTargetAction;
 
-	// Combat uses direct key detection:
-	// Left Mouse = Light Attack, Right Mouse = Heavy Attack
-	// Q = Guard (hold), C = Stow/Draw Weapons
-
-	// Hotbar uses direct key detection:
-	// Arrow keys = use item, Ctrl+Arrow = cycle items
-	// I key = toggle inventory
+	/**
+	 * Fixed gameplay keys - empty slots use the default keys:
+	 * Left Mouse = Light Attack, Right Mouse = Heavy Attack, Q = Guard (hold), C = Stow/Draw Weapons
+	 * Arrow keys = use item, Ctrl+Arrow = cycle items, I = toggle inventory, E = interact
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input")
+	FSoulsLikeKeyActions KeyActions;
 
 	// ==================== UI Widgets ====================
 
@@ -245,8 +246,10 @@ protected:
 	void ToggleLockOn(const FInputActionValue& Value);
 	void SwitchTarget(const FInputActionValue& Value);
 
-	// Hotbar input handling (direct key detection)
-	void HandleHotbarInput();
+	/** Bind the fixed-key actions (creates default key mappings for unassigned actions) */
+	void BindKeyActions(class UEnhancedInputComponent* EnhancedInputComponent);
+
+	// Hotbar input handling
 	void HandleHotbarUp();
 	void HandleHotbarRight();
 	void HandleHotbarLeft();
@@ -257,11 +260,21 @@ protected:
 	bool IsCtrlHeld() const;
 
 	// Interaction handling
-	void HandleInteractionInput();
+	void OnInteractInput();
 	void TryInteract();
 
-	// Combat input handling (direct key polling)
-	void HandleCombatInput();
+	// Combat input handling
+	UEquipmentComponent* GetCombatEquipment() const;
+	bool IsDodging() const;
+	void OnLightAttackInput();
+	void OnHeavyAttackInput();
+	void OnGuardStarted();
+	void OnGuardCompleted();
+	void OnToggleStowInput();
+
+	// Jump held tracking for ledge grab
+	void OnJumpHeld();
+	void OnJumpReleased();
 
 	/** Called when interaction prompt should be shown/hidden (from InteractionComponent) */
 	UFUNCTION()
@@ -281,19 +294,9 @@ protected:
 	/** Currently focused pickup (if any) */
 	AItemPickup* CurrentFocusedPickup = nullptr;
 
-	// Key state tracking (to detect press, not hold)
-	bool bUpArrowWasDown = false;
-	bool bDownArrowWasDown = false;
-	bool bLeftArrowWasDown = false;
-	bool bRightArrowWasDown = false;
-	bool bIKeyWasDown = false;
-	bool bEKeyWasDown = false;
-
-	// Combat input tracking
-	bool bLeftMouseWasDown = false;
-	bool bRightMouseWasDown = false;
-	bool bQKeyWasDown = false;
-	bool bCKeyWasDown = false;
+	/** Transient context mapping default keys for unassigned KeyActions */
+	UPROPERTY()
+	UInputMappingContext* KeyMappingContext = nullptr;
 
 	// Inventory state
 	bool bInventoryOpen = false;
@@ -0,0 +1,61 @@
+// CallOfTheMoutains - Souls-like Key Actions Implementation
+
+#include "SoulsLikeKeyActions.h"
+#include "InputAction.h"
+#include "InputMappingContext.h"
+#include "InputCoreTypes.h"
+
+namespace
+{
+	/** Fill Action (if empty) with a runtime boolean action bound to Keys */
+	void CreateKeyAction(UInputAction*& Action, UObject* Outer, UInputMappingContext* Context, const TCHAR* Name, std::initializer_list<FKey> Keys)
+	{
+		if (Action)
+		{
+			return;
+		}
+
+		Action = NewObject<UInputAction>(Outer, FName(Name), RF_Transient);
+		Action->ValueType = EInputActionValueType::Boolean;
+
+		// Controller and character can both listen to the same key - don't let one swallow it
+		Action->bConsumeInput = false;
+
+		for (const FKey& Key : Keys)
+		{
+			Context->MapKey(Action, Key);
+		}
+	}
+}
+
+UInputMappingContext* FSoulsLikeKeyActions::CreateDefaultMappings(UObject* Outer)
+{
+	UInputMappingContext* Context = NewObject<UInputMappingContext>(Outer, TEXT("IMC_SoulsLikeKeys"), RF_Transient);
+
+	// Combat
+	CreateKeyAction(LightAttack, Outer, Context, TEXT("IA_Key_LightAttack"), { EKeys::LeftMouseButton });
+	CreateKeyAction(HeavyAttack, Outer, Context, TEXT("IA_Key_HeavyAttack"), { EKeys::RightMouseButton });
+	CreateKeyAction(Guard, Outer, Context, TEXT("IA_Key_Guard"), { EKeys::Q });
+	CreateKeyAction(ToggleStow, Outer, Context, TEXT("IA_Key_ToggleStow"), { EKeys::C });
+
+	// Hotbar / Inventory
+	CreateKeyAction(HotbarUp, Outer, Context, TEXT("IA_Key_HotbarUp"), { EKeys::Up });
+	CreateKeyAction(HotbarDown, Outer, Context, TEXT("IA_Key_HotbarDown"), { EKeys::Down });
+	CreateKeyAction(HotbarLeft, Outer, Context, TEXT("IA_Key_HotbarLeft"), { EKeys::Left });
+	CreateKeyAction(HotbarRight, Outer, Context, TEXT("IA_Key_HotbarRight"), { EKeys::Right });
+	CreateKeyAction(ToggleInventory, Outer, Context, TEXT("IA_Key_ToggleInventory"), { EKeys::I });
+	CreateKeyAction(Interact, Outer, Context, TEXT("IA_Key_Interact"), { EKeys::E });
+
+	// Movement
+	CreateKeyAction(Sprint, Outer, Context, TEXT("IA_Key_Sprint"), { EKeys::LeftShift, EKeys::RightShift });
+	CreateKeyAction(Jump, Outer, Context, TEXT("IA_Key_Jump"), { EKeys::SpaceBar });
+	CreateKeyAction(LedgeRelease, Outer, Context, TEXT("IA_Key_LedgeRelease"), { EKeys::S });
+	CreateKeyAction(LedgeMantle, Outer, Context, TEXT("IA_Key_LedgeMantle"), { EKeys::W });
+
+	// Debug
+	CreateKeyAction(DebugDamage, Outer, Context, TEXT("IA_Key_DebugDamage"), { EKeys::T });
+	CreateKeyAction(DebugHeal, Outer, Context, TEXT("IA_Key_DebugHeal"), { EKeys::Y });
+	CreateKeyAction(DebugStamina, Outer, Context, TEXT("IA_Key_DebugStamina"), { EKeys::U });
+
+	return Context;
+}
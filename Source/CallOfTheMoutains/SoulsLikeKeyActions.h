@@ -0,0 +1,105 @@
+// CallOfTheMoutains - Souls-like Key Actions
+// Enhanced Input actions for the fixed gameplay keys (combat, hotbar, interaction, movement, debug)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SoulsLikeKeyActions.generated.h"
+
+class UInputAction;
+class UInputMappingContext;
+
+/**
+ * Key Actions
+ * Assign input action assets here to remap keys through your own mapping context.
+ * Any action left empty is created at runtime and mapped to its default key in a
+ * transient mapping context, so input is event-driven without requiring new assets.
+ */
+USTRUCT(BlueprintType)
+struct CALLOFTHEMOUTAINS_API FSoulsLikeKeyActions
+{
+	GENERATED_BODY()
+
+	// ==================== Combat ====================
+
+	/** Light attack (default: Left Mouse Button) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input|Combat")
+	UInputAction* LightAttack = nullptr;
+
+	/** Heavy attack (default: Right Mouse Button) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input|Combat")
+	UInputAction* HeavyAttack = nullptr;
+
+	/** Guard - hold (default: Q) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input|Combat")
+	UInputAction* Guard = nullptr;
+
+	/** Stow/draw weapons (default: C) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input|Combat")
+	UInputAction* ToggleStow = nullptr;
+
+	// ==================== Hotbar / Inventory ====================
+
+	/** Hotbar up (default: Up Arrow) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input|Hotbar")
+	UInputAction* HotbarUp = nullptr;
+
+	/** Hotbar down (default: Down Arrow) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input|Hotbar")
+	UInputAction* HotbarDown = nullptr;
+
+	/** Hotbar left (default: Left Arrow) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input|Hotbar")
+	UInputAction* HotbarLeft = nullptr;
+
+	/** Hotbar right (default: Right Arrow) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input|Hotbar")
+	UInputAction* HotbarRight = nullptr;
+
+	/** Toggle inventory (default: I) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input|Hotbar")
+	UInputAction* ToggleInventory = nullptr;
+
+	/** Interact/pick up (default: E) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input|Interaction")
+	UInputAction* Interact = nullptr;
+
+	// ==================== Movement ====================
+
+	/** Sprint - hold (default: Left/Right Shift) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input|Movement")
+	UInputAction* Sprint = nullptr;
+
+	/** Jump - hold for ledge grab (default: Space Bar) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input|Movement")
+	UInputAction* Jump = nullptr;
+
+	/** Release ledge while hanging (default: S) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input|Movement")
+	UInputAction* LedgeRelease = nullptr;
+
+	/** Mantle while hanging (default: W) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input|Movement")
+	UInputAction* LedgeMantle = nullptr;
+
+	// ==================== Debug ====================
+
+	/** Debug: take 20 damage (default: T) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input|Debug")
+	UInputAction* DebugDamage = nullptr;
+
+	/** Debug: heal 20 (default: Y) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input|Debug")
+	UInputAction* DebugHeal = nullptr;
+
+	/** Debug: use 30 stamina (default: U) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input|Debug")
+	UInputAction* DebugStamina = nullptr;
+
+	/**
+	 * Create any unassigned actions and map them to their default keys.
+	 * @param Outer - Owner of the runtime actions and context
+	 * @return Transient mapping context holding the default key mappings (add it to the local player's input subsystem)
+	 */
+	UInputMappingContext* CreateDefaultMappings(UObject* Outer);
+};
@@ -15,6 +15,8 @@
 #include "SaveGameManager.h"
 #include "SprintComponent.h"
 #include "ExoMovementComponent.h"
+#include "PickupFocusSubsystem.h"
+#include "CallOfTheMoutains.h"
 #include "EnhancedInputComponent.h"
 #include "EnhancedInputSubsystems.h"
 #include "InputMappingContext.h"
@@ -27,6 +29,10 @@
 #include "Animation/AnimMontage.h"
 #include "Animation/AnimInstance.h"
 #include "Blueprint/UserWidget.h"
+#include "TimerManager.h"
+
+DECLARE_CYCLE_STAT(TEXT("Player Controller Tick"), STAT_PlayerControllerTick, STATGROUP_CallOfTheMoutains);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Player Controller Input Events"), STAT_PlayerControllerInputEvents, STATGROUP_CallOfTheMoutains);
 
 ASoulsLikePlayerController::ASoulsLikePlayerController()
 {
@@ -89,6 +95,20 @@ void ASoulsLikePlayerController::BeginPlay()
 		{
 			Subsystem->AddMappingContext(DefaultMappingContext, 0);
 		}
+
+		// Above the default context, which also maps Shift/WASD/Space
+		if (!KeyMappingContext)
+		{
+			KeyMappingContext = KeyActions.CreateDefaultMappings(this);
+		}
+		Subsystem->AddMappingContext(KeyMappingContext, 1);
+	}
+
+	// Pickup focus is pushed by the focus subsystem (fed from pickup overlap events)
+	if (UPickupFocusSubsystem* FocusSubsystem = UPickupFocusSubsystem::Get(this))
+	{
+		FocusSubsystem->SetRerankDistance(PickupRerankDistance);
+		FocusSubsystem->OnPickupFocusChanged.AddDynamic(this, &ASoulsLikePlayerController::OnPawnPickupFocusChanged);
 	}
 
 	// Delay widget creation to ensure everything is ready
@@ -154,6 +174,9 @@ void ASoulsLikePlayerController::OnPossess(APawn* InPawn)
 	{
 		LockOnComponent->SetOwnerActor(InPawn);
 
+		// Acquire/switch resolve after the line-of-sight traces land, so rotation mode follows the events
+		LockOnComponent->OnLockOnAcquired.AddDynamic(this, &ASoulsLikePlayerController::OnLockOnAcquiredCallback);
+
 		// Bind to OnLockOnLost to restore rotation when target dies/goes out of range
 		LockOnComponent->OnLockOnLost.AddDynamic(this, &ASoulsLikePlayerController::OnLockOnLostCallback);
 	}
@@ -227,32 +250,58 @@ void ASoulsLikePlayerController::SetupInputComponent()
 			EnhancedInput->BindAction(IA_Crouch, ETriggerEvent::Started, this, &ASoulsLikePlayerController::OnCrouchPressed);
 			EnhancedInput->BindAction(IA_Crouch, ETriggerEvent::Completed, this, &ASoulsLikePlayerController::OnCrouchReleased);
 		}
+
+		// Combat, hotbar, interaction, sprint, jump and debug keys
+		BindKeyActions(EnhancedInput);
 	}
 }
 
+void ASoulsLikePlayerController::BindKeyActions(UEnhancedInputComponent* EnhancedInput)
+{
+	if (!KeyMappingContext)
+	{
+		// Registered with the input subsystem in BeginPlay
+		KeyMappingContext = KeyActions.CreateDefaultMappings(this);
+	}
+
+	// Combat
+	EnhancedInput->BindAction(KeyActions.LightAttack, ETriggerEvent::Started, this, &ASoulsLikePlayerController::OnLightAttackInput);
+	EnhancedInput->BindAction(KeyActions.HeavyAttack, ETriggerEvent::Started, this, &ASoulsLikePlayerController::OnHeavyAttackInput);
+	EnhancedInput->BindAction(KeyActions.Guard, ETriggerEvent::Started, this, &ASoulsLikePlayerController::OnGuardStarted);
+	EnhancedInput->BindAction(KeyActions.Guard, ETriggerEvent::Completed, this, &ASoulsLikePlayerController::OnGuardCompleted);
+	EnhancedInput->BindAction(KeyActions.ToggleStow, ETriggerEvent::Started, this, &ASoulsLikePlayerController::OnToggleStowInput);
+
+	// Hotbar / Inventory
+	EnhancedInput->BindAction(KeyActions.HotbarUp, ETriggerEvent::Started, this, &ASoulsLikePlayerController::HandleHotbarUp);
+	EnhancedInput->BindAction(KeyActions.HotbarDown, ETriggerEvent::Started, this, &ASoulsLikePlayerController::HandleHotbarDown);
+	EnhancedInput->BindAction(KeyActions.HotbarLeft, ETriggerEvent::Started, this, &ASoulsLikePlayerController::HandleHotbarLeft);
+	EnhancedInput->BindAction(KeyActions.HotbarRight, ETriggerEvent::Started, this, &ASoulsLikePlayerController::HandleHotbarRight);
+	EnhancedInput->BindAction(KeyActions.ToggleInventory, ETriggerEvent::Started, this, &ASoulsLikePlayerController::ToggleInventory);
+	EnhancedInput->BindAction(KeyActions.Interact, ETriggerEvent::Started, this, &ASoulsLikePlayerController::OnInteractInput);
+
+	// Sprint (hold)
+	EnhancedInput->BindAction(KeyActions.Sprint, ETriggerEvent::Started, this, &ASoulsLikePlayerController::OnSprintStarted);
+	EnhancedInput->BindAction(KeyActions.Sprint, ETriggerEvent::Completed, this, &ASoulsLikePlayerController::OnSprintCompleted);
+
+	// Jump - press for double jump, Triggered fires every frame while held for ledge grab
+	EnhancedInput->BindAction(KeyActions.Jump, ETriggerEvent::Started, this, &ASoulsLikePlayerController::OnJumpStarted);
+	EnhancedInput->BindAction(KeyActions.Jump, ETriggerEvent::Triggered, this, &ASoulsLikePlayerController::OnJumpHeld);
+	EnhancedInput->BindAction(KeyActions.Jump, ETriggerEvent::Completed, this, &ASoulsLikePlayerController::OnJumpCompleted);
+	EnhancedInput->BindAction(KeyActions.LedgeRelease, ETriggerEvent::Triggered, this, &ASoulsLikePlayerController::OnLedgeReleaseInput);
+	EnhancedInput->BindAction(KeyActions.LedgeMantle, ETriggerEvent::Triggered, this, &ASoulsLikePlayerController::OnLedgeMantleInput);
+
+	// Debug
+	EnhancedInput->BindAction(KeyActions.DebugDamage, ETriggerEvent::Started, this, &ASoulsLikePlayerController::OnDebugDamageInput);
+	EnhancedInput->BindAction(KeyActions.DebugHeal, ETriggerEvent::Started, this, &ASoulsLikePlayerController::OnDebugHealInput);
+	EnhancedInput->BindAction(KeyActions.DebugStamina, ETriggerEvent::Started, this, &ASoulsLikePlayerController::OnDebugStaminaInput);
+}
+
 void ASoulsLikePlayerController::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
 
-	// Track lock-on hold time
-	if (bLockOnHeld)
-	{
-		LockOnHoldTime += DeltaTime;
-
-		// Only trigger lock-on immediately if NOT already locked on
-		// When locked on, we wait for release to distinguish tap (switch) from hold (release)
-		if (!IsLockedOn() && LockOnHoldTime >= HoldThreshold && !bLockOnTriggeredThisHold)
-		{
-			bLockOnTriggeredThisHold = true;
-			AcquireLockOn();
-		}
-	}
-
-	// Update dodge cooldown
-	if (DodgeCooldownTimer > 0.0f)
-	{
-		DodgeCooldownTimer -= DeltaTime;
-	}
+	// Input is event-driven - only continuous dodge/camera work runs here
+	SCOPE_CYCLE_COUNTER(STAT_PlayerControllerTick);
 
 	// Update dodge
 	if (bIsDodging)
@@ -267,27 +316,6 @@ void ASoulsLikePlayerController::Tick(float DeltaTime)
 	}
 
 	UpdateCameraDistance(DeltaTime);
-
-	// Handle hotbar input (Arrow keys + I key)
-	HandleHotbarInput();
-
-	// Handle pickup detection (check for nearby pickups)
-	HandlePickupDetection();
-
-	// Handle E key for interaction/pickup
-	HandleInteractionInput();
-
-	// Debug input (T = damage, Y = heal, U = use stamina)
-	HandleDebugInput();
-
-	// Combat input (LMB = light attack, RMB = heavy attack, Q = stow)
-	HandleCombatInput();
-
-	// Sprint input (Shift hold)
-	HandleSprintInput();
-
-	// Exo movement input (jump held tracking, ledge grab, double jump)
-	HandleExoMovementInput();
 }
 
 // ==================== Enhanced Input Handlers ====================
@@ -295,13 +323,29 @@ void ASoulsLikePlayerController::Tick(float DeltaTime)
 void ASoulsLikePlayerController::OnLockOnStarted(const FInputActionValue& Value)
 {
 	bLockOnHeld = true;
-	LockOnHoldTime = 0.0f;
+	LockOnPressTime = GetWorld()->GetTimeSeconds();
 	bLockOnTriggeredThisHold = false;
+
+	// Only trigger lock-on on hold if NOT already locked on
+	// When locked on, we wait for release to distinguish tap (switch) from hold (release)
+	GetWorld()->GetTimerManager().SetTimer(LockOnHoldTimerHandle, this, &ASoulsLikePlayerController::OnLockOnHoldElapsed, HoldThreshold, false);
+}
+
+void ASoulsLikePlayerController::OnLockOnHoldElapsed()
+{
+	if (bLockOnHeld && !IsLockedOn() && !bLockOnTriggeredThisHold)
+	{
+		bLockOnTriggeredThisHold = true;
+		AcquireLockOn();
+	}
 }
 
 void ASoulsLikePlayerController::OnLockOnCompleted(const FInputActionValue& Value)
 {
 	bLockOnHeld = false;
+	GetWorld()->GetTimerManager().ClearTimer(LockOnHoldTimerHandle);
+
+	const float LockOnHoldTime = GetWorld()->GetTimeSeconds() - LockOnPressTime;
 
 	// When locked on, handle tap vs hold on release
 	if (IsLockedOn())
@@ -318,14 +362,13 @@ void ASoulsLikePlayerController::OnLockOnCompleted(const FInputActionValue& Valu
 		}
 	}
 
-	LockOnHoldTime = 0.0f;
 	bLockOnTriggeredThisHold = false;
 }
 
 void ASoulsLikePlayerController::OnDodgeKeyPressed(const FInputActionValue& Value)
 {
 	// Shift pressed - check for double tap to dodge
-	// Sprint is handled by HandleSprintInput() via direct key polling for true hold behavior
+	// Sprint hold is handled by the Sprint key action (OnSprintStarted/OnSprintCompleted)
 	float CurrentTime = GetWorld()->GetTimeSeconds();
 	float TimeSinceLastTap = CurrentTime - LastShiftTapTime;
 
@@ -344,7 +387,7 @@ void ASoulsLikePlayerController::OnDodgeKeyPressed(const FInputActionValue& Valu
 
 void ASoulsLikePlayerController::OnDodgeKeyReleased(const FInputActionValue& Value)
 {
-	// Sprint stop is handled by HandleSprintInput() via direct key polling
+	// Sprint stop is handled by OnSprintCompleted()
 }
 
 void ASoulsLikePlayerController::OnMoveInput(const FInputActionValue& Value)
@@ -382,20 +425,8 @@ void ASoulsLikePlayerController::AcquireLockOn()
 		return;
 	}
 
+	// Rotation mode and OnLockOnChanged are updated in OnLockOnAcquiredCallback once a target lands
 	LockOnComponent->ToggleLockOn();
-
-	// Update character rotation mode
-	if (LockOnComponent->IsLockedOn())
-	{
-		if (ACharacter* ControlledCharacter = GetCharacter())
-		{
-			if (UCharacterMovementComponent* Movement = ControlledCharacter->GetCharacterMovement())
-			{
-				Movement->bOrientRotationToMovement = false;
-			}
-		}
-		OnLockOnChanged.Broadcast(GetLockOnTarget());
-	}
 }
 
 void ASoulsLikePlayerController::ReleaseLockOn()
@@ -426,7 +457,6 @@ void ASoulsLikePlayerController::SwitchTarget()
 		// Switch based on horizontal input, or default to right
 		float Direction = (FMath::Abs(MoveInput.X) > 0.1f) ? FMath::Sign(MoveInput.X) : 1.0f;
 		LockOnComponent->SwitchTarget(Direction);
-		OnLockOnChanged.Broadcast(GetLockOnTarget());
 	}
 }
 
@@ -434,7 +464,7 @@ void ASoulsLikePlayerController::SwitchTarget()
 
 bool ASoulsLikePlayerController::CanDodge() const
 {
-	if (bIsDodging || DodgeCooldownTimer > 0.0f)
+	if (bIsDodging || GetWorld()->GetTimeSeconds() < DodgeCooldownEndTime)
 	{
 		return false;
 	}
@@ -701,13 +731,26 @@ void ASoulsLikePlayerController::EndDodge()
 {
 	bIsDodging = false;
 	bIsInvincible = false;
-	DodgeCooldownTimer = DodgeCooldown;
+	DodgeCooldownEndTime = GetWorld()->GetTimeSeconds() + DodgeCooldown;
 
 	if (ACharacter* ControlledCharacter = GetCharacter())
 	{
 		ControlledCharacter->GetCharacterMovement()->SetMovementMode(MOVE_Walking);
 	}
 
+	// Resume or stop sprint to match shift state (sprint input is ignored mid-dodge)
+	if (PawnSprintComponent)
+	{
+		if (bSprintHeld)
+		{
+			PawnSprintComponent->StartSprint();
+		}
+		else
+		{
+			PawnSprintComponent->StopSprint();
+		}
+	}
+
 	OnDodgeEnded.Broadcast();
 }
 
@@ -779,6 +822,13 @@ void ASoulsLikePlayerController::UpdateCameraDistance(float DeltaTime)
 
 	float TargetDistance = IsLockedOn() ? LockedOnCameraDistance : NormalCameraDistance;
 
+	// Already settled - nothing to interpolate
+	if (FMath::IsNearlyEqual(CachedSpringArm->TargetArmLength, TargetDistance, 0.1f))
+	{
+		CachedSpringArm->TargetArmLength = TargetDistance;
+		return;
+	}
+
 	CachedSpringArm->TargetArmLength = FMath::FInterpTo(
 		CachedSpringArm->TargetArmLength,
 		TargetDistance,
@@ -805,51 +855,10 @@ bool ASoulsLikePlayerController::IsCtrlHeld() const
 	return IsInputKeyDown(EKeys::LeftControl) || IsInputKeyDown(EKeys::RightControl);
 }
 
-void ASoulsLikePlayerController::HandleHotbarInput()
-{
-	// Up Arrow
-	bool bUpDown = IsInputKeyDown(EKeys::Up);
-	if (bUpDown && !bUpArrowWasDown)
-	{
-		HandleHotbarUp();
-	}
-	bUpArrowWasDown = bUpDown;
-
-	// Down Arrow
-	bool bDownDown = IsInputKeyDown(EKeys::Down);
-	if (bDownDown && !bDownArrowWasDown)
-	{
-		HandleHotbarDown();
-	}
-	bDownArrowWasDown = bDownDown;
-
-	// Left Arrow
-	bool bLeftDown = IsInputKeyDown(EKeys::Left);
-	if (bLeftDown && !bLeftArrowWasDown)
-	{
-		HandleHotbarLeft();
-	}
-	bLeftArrowWasDown = bLeftDown;
-
-	// Right Arrow
-	bool bRightDown = IsInputKeyDown(EKeys::Right);
-	if (bRightDown && !bRightArrowWasDown)
-	{
-		HandleHotbarRight();
-	}
-	bRightArrowWasDown = bRightDown;
-
-	// I Key - Toggle Inventory
-	bool bIDown = IsInputKeyDown(EKeys::I);
-	if (bIDown && !bIKeyWasDown)
-	{
-		ToggleInventory();
-	}
-	bIKeyWasDown = bIDown;
-}
-
 void ASoulsLikePlayerController::HandleHotbarUp()
 {
+	INC_DWORD_STAT(STAT_PlayerControllerInputEvents);
+
 	APawn* MyPawn = GetPawn();
 	UEquipmentComponent* EquipComp = MyPawn ? MyPawn->FindComponentByClass<UEquipmentComponent>() : nullptr;
 	if (!EquipComp) return;
@@ -867,6 +876,8 @@ void ASoulsLikePlayerController::HandleHotbarUp()
 
 void ASoulsLikePlayerController::HandleHotbarRight()
 {
+	INC_DWORD_STAT(STAT_PlayerControllerInputEvents);
+
 	APawn* MyPawn = GetPawn();
 	UEquipmentComponent* EquipComp = MyPawn ? MyPawn->FindComponentByClass<UEquipmentComponent>() : nullptr;
 	if (!EquipComp) return;
@@ -881,6 +892,8 @@ void ASoulsLikePlayerController::HandleHotbarRight()
 
 void ASoulsLikePlayerController::HandleHotbarLeft()
 {
+	INC_DWORD_STAT(STAT_PlayerControllerInputEvents);
+
 	APawn* MyPawn = GetPawn();
 	UEquipmentComponent* EquipComp = MyPawn ? MyPawn->FindComponentByClass<UEquipmentComponent>() : nullptr;
 	if (!EquipComp) return;
@@ -895,6 +908,8 @@ void ASoulsLikePlayerController::HandleHotbarLeft()
 
 void ASoulsLikePlayerController::HandleHotbarDown()
 {
+	INC_DWORD_STAT(STAT_PlayerControllerInputEvents);
+
 	APawn* MyPawn = GetPawn();
 	UEquipmentComponent* EquipComp = MyPawn ? MyPawn->FindComponentByClass<UEquipmentComponent>() : nullptr;
 	if (!EquipComp) return;
@@ -912,6 +927,8 @@ void ASoulsLikePlayerController::HandleHotbarDown()
 
 void ASoulsLikePlayerController::ToggleInventory()
 {
+	INC_DWORD_STAT(STAT_PlayerControllerInputEvents);
+
 	bInventoryOpen = !bInventoryOpen;
 
 	// Show/hide inventory widget
@@ -958,56 +975,11 @@ void ASoulsLikePlayerController::CreateStatsWidget()
 
 // ==================== Pickup/Interaction Handling ====================
 
-void ASoulsLikePlayerController::HandlePickupDetection()
+void ASoulsLikePlayerController::OnPawnPickupFocusChanged(APawn* FocusPawn, AItemPickup* Pickup, bool bFocused)
 {
-	APawn* ControlledPawn = GetPawn();
-	if (!ControlledPawn)
-	{
-		// Clear focus if no pawn
-		if (CurrentFocusedPickup)
-		{
-			OnPickupFocusChanged(CurrentFocusedPickup, false);
-		}
-		return;
-	}
-
-	// Get all overlapping actors on the pawn
-	TArray<AActor*> OverlappingActors;
-	ControlledPawn->GetOverlappingActors(OverlappingActors, AItemPickup::StaticClass());
-
-	// Find the closest pickup
-	AItemPickup* ClosestPickup = nullptr;
-	float ClosestDistance = FLT_MAX;
-	FVector PawnLocation = ControlledPawn->GetActorLocation();
-
-	for (AActor* Actor : OverlappingActors)
-	{
-		AItemPickup* Pickup = Cast<AItemPickup>(Actor);
-		if (Pickup && !Pickup->IsCollected())
-		{
-			float Distance = FVector::Dist(PawnLocation, Pickup->GetActorLocation());
-			if (Distance < ClosestDistance)
-			{
-				ClosestDistance = Distance;
-				ClosestPickup = Pickup;
-			}
-		}
-	}
-
-	// Update focus state
-	if (ClosestPickup != CurrentFocusedPickup)
+	if (FocusPawn && FocusPawn == GetPawn())
 	{
-		// Lost focus on previous pickup
-		if (CurrentFocusedPickup)
-		{
-			OnPickupFocusChanged(CurrentFocusedPickup, false);
-		}
-
-		// Gained focus on new pickup
-		if (ClosestPickup)
-		{
-			OnPickupFocusChanged(ClosestPickup, true);
-		}
+		OnPickupFocusChanged(Pickup, bFocused);
 	}
 }
 
@@ -1036,21 +1008,17 @@ void ASoulsLikePlayerController::OnPickupFocusChanged(AItemPickup* Pickup, bool
 	}
 }
 
-void ASoulsLikePlayerController::HandleInteractionInput()
+void ASoulsLikePlayerController::OnInteractInput()
 {
+	INC_DWORD_STAT(STAT_PlayerControllerInputEvents);
+
 	// Don't allow interaction while inventory is open
 	if (bInventoryOpen)
 	{
 		return;
 	}
 
-	// E Key - Interact/Pickup
-	bool bEDown = IsInputKeyDown(EKeys::E);
-	if (bEDown && !bEKeyWasDown)
-	{
-		TryPickupItem();
-	}
-	bEKeyWasDown = bEDown;
+	TryPickupItem();
 }
 
 void ASoulsLikePlayerController::TryPickupItem()
@@ -1081,144 +1049,171 @@ void ASoulsLikePlayerController::TryPickupItem()
 			HotbarWidget->UpdateAllSlots();
 		}
 
-		// The pickup will destroy itself, clear our reference
-		CurrentFocusedPickup = nullptr;
+		// The pickup removed itself from the focus subsystem, which already moved focus
+		// to the next pickup in range (if any) - sync our reference with it
+		UPickupFocusSubsystem* FocusSubsystem = UPickupFocusSubsystem::Get(this);
+		CurrentFocusedPickup = FocusSubsystem ? FocusSubsystem->GetFocusedPickup(ControlledPawn) : nullptr;
 
-		// Hide the prompt
-		if (InteractionPromptWidget)
+		// Hide the prompt if nothing else is in range
+		if (!CurrentFocusedPickup && InteractionPromptWidget)
 		{
 			InteractionPromptWidget->HidePrompt();
 		}
 	}
 }
 
-void ASoulsLikePlayerController::HandleDebugInput()
+void ASoulsLikePlayerController::OnDebugDamageInput()
 {
-	if (!PawnHealthComponent) return;
+	INC_DWORD_STAT(STAT_PlayerControllerInputEvents);
 
 	// T key - take 20 damage
-	static bool bTWasDown = false;
-	bool bTDown = IsInputKeyDown(EKeys::T);
-	if (bTDown && !bTWasDown)
+	if (PawnHealthComponent)
 	{
 		PawnHealthComponent->TakeDamage(20.0f, nullptr, nullptr);
 	}
-	bTWasDown = bTDown;
+}
+
+void ASoulsLikePlayerController::OnDebugHealInput()
+{
+	INC_DWORD_STAT(STAT_PlayerControllerInputEvents);
 
 	// Y key - heal 20
-	static bool bYWasDown = false;
-	bool bYDown = IsInputKeyDown(EKeys::Y);
-	if (bYDown && !bYWasDown)
+	if (PawnHealthComponent)
 	{
 		PawnHealthComponent->Heal(20.0f);
 	}
-	bYWasDown = bYDown;
+}
+
+void ASoulsLikePlayerController::OnDebugStaminaInput()
+{
+	INC_DWORD_STAT(STAT_PlayerControllerInputEvents);
 
 	// U key - use 30 stamina
-	static bool bUWasDown = false;
-	bool bUDown = IsInputKeyDown(EKeys::U);
-	if (bUDown && !bUWasDown)
+	if (PawnHealthComponent)
 	{
 		PawnHealthComponent->UseStamina(30.0f);
 	}
-	bUWasDown = bUDown;
 }
 
 // ==================== Combat Input ====================
 
-void ASoulsLikePlayerController::HandleCombatInput()
+UEquipmentComponent* ASoulsLikePlayerController::GetCombatEquipment() const
 {
-	// Don't allow combat while inventory is open or dodging
-	if (bInventoryOpen || bIsDodging)
-	{
-		return;
-	}
-
 	APawn* MyPawn = GetPawn();
-	if (!MyPawn)
-	{
-		return;
-	}
+	return MyPawn ? MyPawn->FindComponentByClass<UEquipmentComponent>() : nullptr;
+}
 
-	UEquipmentComponent* EquipComp = MyPawn->FindComponentByClass<UEquipmentComponent>();
-	if (!EquipComp)
-	{
-		return;
-	}
+bool ASoulsLikePlayerController::CanUseCombatInput() const
+{
+	// Don't allow combat while inventory is open or dodging
+	return !bInventoryOpen && !bIsDodging;
+}
+
+void ASoulsLikePlayerController::OnLightAttackInput()
+{
+	INC_DWORD_STAT(STAT_PlayerControllerInputEvents);
 
 	// Left Mouse Button - Light Attack
-	bool bLeftMouseDown = IsInputKeyDown(EKeys::LeftMouseButton);
-	if (bLeftMouseDown && !bLeftMouseWasDown)
+	UEquipmentComponent* EquipComp = GetCombatEquipment();
+	if (EquipComp && CanUseCombatInput())
 	{
 		EquipComp->LightAttack();
 	}
-	bLeftMouseWasDown = bLeftMouseDown;
+}
+
+void ASoulsLikePlayerController::OnHeavyAttackInput()
+{
+	INC_DWORD_STAT(STAT_PlayerControllerInputEvents);
 
-	// Right Mouse Button - Heavy Attack (tap) or Guard (hold)
-	bool bRightMouseDown = IsInputKeyDown(EKeys::RightMouseButton);
-	if (bRightMouseDown && !bRightMouseWasDown)
+	// Right Mouse Button - Heavy Attack on press
+	UEquipmentComponent* EquipComp = GetCombatEquipment();
+	if (EquipComp && CanUseCombatInput())
 	{
-		// Start heavy attack on press
 		EquipComp->HeavyAttack();
 	}
-	bRightMouseWasDown = bRightMouseDown;
+}
+
+void ASoulsLikePlayerController::OnGuardStarted()
+{
+	INC_DWORD_STAT(STAT_PlayerControllerInputEvents);
 
 	// Q Key - Guard/Block (hold)
-	bool bQDown = IsInputKeyDown(EKeys::Q);
-	if (bQDown && !bQKeyWasDown)
+	UEquipmentComponent* EquipComp = GetCombatEquipment();
+	if (EquipComp && CanUseCombatInput())
 	{
 		EquipComp->StartGuard();
 	}
-	else if (!bQDown && bQKeyWasDown)
+}
+
+void ASoulsLikePlayerController::OnGuardCompleted()
+{
+	INC_DWORD_STAT(STAT_PlayerControllerInputEvents);
+
+	// Always allow the guard to drop, even if the inventory opened mid-hold
+	if (UEquipmentComponent* EquipComp = GetCombatEquipment())
 	{
 		EquipComp->StopGuard();
 	}
-	bQKeyWasDown = bQDown;
+}
+
+void ASoulsLikePlayerController::OnToggleStowInput()
+{
+	INC_DWORD_STAT(STAT_PlayerControllerInputEvents);
 
 	// C Key - Toggle Weapon Stow
-	bool bCDown = IsInputKeyDown(EKeys::C);
-	if (bCDown && !bCKeyWasDown)
+	UEquipmentComponent* EquipComp = GetCombatEquipment();
+	if (EquipComp && CanUseCombatInput())
 	{
 		EquipComp->ToggleWeaponStow();
 	}
-	bCKeyWasDown = bCDown;
 }
 
 // ==================== Sprint Input ====================
 
-void ASoulsLikePlayerController::HandleSprintInput()
+void ASoulsLikePlayerController::OnSprintStarted()
 {
-	if (!PawnSprintComponent)
-	{
-		return;
-	}
+	INC_DWORD_STAT(STAT_PlayerControllerInputEvents);
 
-	// Direct key polling for true hold-to-sprint behavior
-	// This ensures sprint state always matches whether shift is held
-	bool bShiftDown = IsInputKeyDown(EKeys::LeftShift) || IsInputKeyDown(EKeys::RightShift);
+	bSprintHeld = true;
 
-	// Don't sprint while dodging
-	if (bIsDodging)
-	{
-		bShiftWasDown = bShiftDown;
-		return;
-	}
-
-	// Update sprint based on current key state (true hold behavior)
-	if (bShiftDown)
+	// Don't sprint while dodging - EndDodge picks the held state back up
+	if (PawnSprintComponent && !bIsDodging)
 	{
 		PawnSprintComponent->StartSprint();
 	}
-	else
+}
+
+void ASoulsLikePlayerController::OnSprintCompleted()
+{
+	INC_DWORD_STAT(STAT_PlayerControllerInputEvents);
+
+	bSprintHeld = false;
+
+	if (PawnSprintComponent)
 	{
 		PawnSprintComponent->StopSprint();
 	}
-
-	bShiftWasDown = bShiftDown;
 }
 
 // ==================== Lock-On Callbacks ====================
 
+void ASoulsLikePlayerController::OnLockOnAcquiredCallback(AActor* NewTarget)
+{
+	// Called when the LockOnComponent locks or switches onto a target
+	// (may be a frame after the input, once line-of-sight traces resolve)
+
+	// Strafe around the target
+	if (ACharacter* ControlledCharacter = GetCharacter())
+	{
+		if (UCharacterMovementComponent* Movement = ControlledCharacter->GetCharacterMovement())
+		{
+			Movement->bOrientRotationToMovement = false;
+		}
+	}
+
+	OnLockOnChanged.Broadcast(NewTarget);
+}
+
 void ASoulsLikePlayerController::OnLockOnLostCallback(AActor* LostTarget)
 {
 	// This is called when the LockOnComponent loses its target
@@ -1262,36 +1257,47 @@ void ASoulsLikePlayerController::OnCrouchReleased(const FInputActionValue& Value
 
 // ==================== Exo Movement Input ====================
 
-void ASoulsLikePlayerController::HandleExoMovementInput()
+void ASoulsLikePlayerController::OnJumpStarted()
 {
-	// Track jump held state via direct key polling
-	bJumpHeld = IsInputKeyDown(EKeys::SpaceBar);
+	INC_DWORD_STAT(STAT_PlayerControllerInputEvents);
 
-	// If grabbing ledge, handle ledge-specific input
-	if (PawnExoMovementComponent && PawnExoMovementComponent->IsGrabbingLedge())
-	{
-		// S key = release ledge and fall
-		if (IsInputKeyDown(EKeys::S))
-		{
-			UE_LOG(LogTemp, Warning, TEXT("Controller: S pressed - releasing ledge"));
-			PawnExoMovementComponent->ReleaseLedge();
-			return;
-		}
+	bJumpHeld = true;
 
-		// W key = mantle up
-		if (IsInputKeyDown(EKeys::W))
-		{
-			UE_LOG(LogTemp, Warning, TEXT("Controller: W pressed - trying mantle"));
-			PawnExoMovementComponent->TryMantle();
-			return;
-		}
-	}
+	// Handle double jump / mantle on space press (not hold)
+	HandleDoubleJump();
+}
+
+void ASoulsLikePlayerController::OnJumpHeld()
+{
+	bJumpHeld = true;
 
 	// Check for ledge grab while jump is held and in air
 	CheckLedgeGrab();
+}
 
-	// Handle double jump on space press (not hold)
-	HandleDoubleJump();
+void ASoulsLikePlayerController::OnJumpCompleted()
+{
+	bJumpHeld = false;
+}
+
+void ASoulsLikePlayerController::OnLedgeReleaseInput()
+{
+	// S key = release ledge and fall
+	if (PawnExoMovementComponent && PawnExoMovementComponent->IsGrabbingLedge())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Controller: S pressed - releasing ledge"));
+		PawnExoMovementComponent->ReleaseLedge();
+	}
+}
+
+void ASoulsLikePlayerController::OnLedgeMantleInput()
+{
+	// W key = mantle up
+	if (PawnExoMovementComponent && PawnExoMovementComponent->IsGrabbingLedge())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Controller: W pressed - trying mantle"));
+		PawnExoMovementComponent->TryMantle();
+	}
 }
 
 void ASoulsLikePlayerController::CheckLedgeGrab()
@@ -1354,38 +1360,28 @@ void ASoulsLikePlayerController::HandleDoubleJump()
 		return;
 	}
 
-	// Track space bar press (not hold)
-	static bool bSpaceWasDown = false;
-	bool bSpaceDown = IsInputKeyDown(EKeys::SpaceBar);
-
-	// Only on press, not hold
-	if (bSpaceDown && !bSpaceWasDown)
+	// FIRST: Check if grabbing ledge - mantle takes priority
+	if (PawnExoMovementComponent->IsGrabbingLedge())
 	{
-		// FIRST: Check if grabbing ledge - mantle takes priority
-		if (PawnExoMovementComponent->IsGrabbingLedge())
-		{
-			UE_LOG(LogTemp, Warning, TEXT("Controller: Space pressed while on ledge - trying mantle"));
-			PawnExoMovementComponent->TryMantle();
-		}
-		else
+		UE_LOG(LogTemp, Warning, TEXT("Controller: Space pressed while on ledge - trying mantle"));
+		PawnExoMovementComponent->TryMantle();
+	}
+	else
+	{
+		// Not on ledge - check for double jump
+		ACharacter* MyCharacter = GetCharacter();
+		if (MyCharacter)
 		{
-			// Not on ledge - check for double jump
-			ACharacter* MyCharacter = GetCharacter();
-			if (MyCharacter)
-			{
-				UCharacterMovementComponent* Movement = MyCharacter->GetCharacterMovement();
+			UCharacterMovementComponent* Movement = MyCharacter->GetCharacterMovement();
 
-				// If in air (falling), try double jump
-				if (Movement && Movement->IsFalling())
+			// If in air (falling), try double jump
+			if (Movement && Movement->IsFalling())
+			{
+				if (PawnExoMovementComponent->CanDoubleJump())
 				{
-					if (PawnExoMovementComponent->CanDoubleJump())
-					{
-						PawnExoMovementComponent->TryDoubleJump();
-					}
+					PawnExoMovementComponent->TryDoubleJump();
 				}
 			}
 		}
 	}
-
-	bSpaceWasDown = bSpaceDown;
 }
@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "GameFramework/PlayerController.h"
 #include "InputActionValue.h"
+#include "SoulsLikeKeyActions.h"
 #include "SoulsLikePlayerController.generated.h"
 
 class ULockOnComponent;
@@ -84,6 +85,10 @@ public:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Input")
 	UInputAction* IA_Crouch;
 
+	/** Actions for fixed gameplay keys (combat, hotbar, interaction, sprint, jump, debug) - empty slots use default keys */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Input")
+	FSoulsLikeKeyActions KeyActions;
+
 	// ==================== Components ====================
 
 	/** Lock-on targeting component */
@@ -137,6 +142,12 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lock On", meta = (ClampMin = "0.1", ClampMax = "1.0"))
 	float HoldThreshold = 0.15f;
 
+	// ==================== Interaction Settings ====================
+
+	/** Distance the pawn must move before in-range pickups are re-ranked for focus */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Interaction", meta = (ClampMin = "0.0"))
+	float PickupRerankDistance = 25.0f;
+
 	// ==================== Camera Settings ====================
 
 	/** How fast camera rotates to face target */
@@ -275,8 +286,13 @@ protected:
 	// Helpers
 	USpringArmComponent* FindSpringArm() const;
 
-	// Hotbar/Inventory input (direct key detection)
-	void HandleHotbarInput();
+	/** Bind the fixed-key actions (creates default key mappings for unassigned actions) */
+	void BindKeyActions(class UEnhancedInputComponent* EnhancedInput);
+
+	/** Lock-on button held past HoldThreshold */
+	void OnLockOnHoldElapsed();
+
+	// Hotbar/Inventory input
 	void HandleHotbarUp();
 	void HandleHotbarRight();
 	void HandleHotbarLeft();
@@ -290,63 +306,81 @@ protected:
 	void CreateInteractionPromptWidget();
 
 	// Pickup/Interaction handling
-	void HandlePickupDetection();
-	void HandleInteractionInput();
+	void OnInteractInput();
 	void TryPickupItem();
 
 	/** Called when pickup focus changes */
 	UFUNCTION()
 	void OnPickupFocusChanged(AItemPickup* Pickup, bool bFocused);
 
+	/** Pickup focus subsystem callback - forwards changes for our pawn */
+	UFUNCTION()
+	void OnPawnPickupFocusChanged(APawn* FocusPawn, AItemPickup* Pickup, bool bFocused);
+
+	/** Called when lock-on is acquired or switched to a new target */
+	UFUNCTION()
+	void OnLockOnAcquiredCallback(AActor* NewTarget);
+
 	/** Called when lock-on is lost (target died, went out of range, etc.) */
 	UFUNCTION()
 	void OnLockOnLostCallback(AActor* LostTarget);
 
-	// Debug input handling
-	void HandleDebugInput();
+	// Debug input (T = damage, Y = heal, U = use stamina)
+	void OnDebugDamageInput();
+	void OnDebugHealInput();
+	void OnDebugStaminaInput();
 
-	// Combat input handling (LMB, RMB, Q, C)
-	void HandleCombatInput();
+	// Combat input (LMB = light, RMB = heavy, Q = guard, C = stow)
+	UEquipmentComponent* GetCombatEquipment() const;
+	bool CanUseCombatInput() const;
+	void OnLightAttackInput();
+	void OnHeavyAttackInput();
+	void OnGuardStarted();
+	void OnGuardCompleted();
+	void OnToggleStowInput();
 
-	// Sprint input handling (Shift hold = sprint)
-	void HandleSprintInput();
+	// Sprint input (Shift hold = sprint)
+	void OnSprintStarted();
+	void OnSprintCompleted();
 
 	// Crouch/Slide input handlers
 	void OnCrouchPressed(const FInputActionValue& Value);
 	void OnCrouchReleased(const FInputActionValue& Value);
 
 	// Exo movement - jump/ledge grab handling (works with any character)
-	void HandleExoMovementInput();
+	void OnJumpStarted();
+	void OnJumpHeld();
+	void OnJumpCompleted();
+	void OnLedgeReleaseInput();
+	void OnLedgeMantleInput();
 	void CheckLedgeGrab();
 	void HandleDoubleJump();
 
-private:
-	// Combat input key state tracking
-	bool bLeftMouseWasDown = false;
-	bool bRightMouseWasDown = false;
-	bool bQKeyWasDown = false;
-	bool bCKeyWasDown = false;
-
 private:
 	UPROPERTY()
 	USpringArmComponent* CachedSpringArm;
 
+	/** Transient context mapping default keys for unassigned KeyActions */
+	UPROPERTY()
+	UInputMappingContext* KeyMappingContext = nullptr;
+
 	// Input state
 	FVector2D MoveInput = FVector2D::ZeroVector;
 
 	// Lock-on state
-	float LockOnHoldTime = 0.0f;
+	float LockOnPressTime = 0.0f;
 	bool bLockOnHeld = false;
 	bool bLockOnTriggeredThisHold = false;
+	FTimerHandle LockOnHoldTimerHandle;
 
 	// Dodge state - double tap shift detection
 	float DodgeTimer = 0.0f;
-	float DodgeCooldownTimer = 0.0f;
+	float DodgeCooldownEndTime = 0.0f;
 	float DoubleTapWindow = 0.3f; // Time window for double tap shift
 
 	// Double-tap shift tracking
 	float LastShiftTapTime = -1.0f;
-	bool bShiftWasDown = false;
+	bool bSprintHeld = false;
 
 	// Jump tracking for ledge grab
 	bool bJumpHeld = false;
@@ -358,12 +392,5 @@ private:
 	// Original settings
 	bool bOriginalOrientToMovement = true;
 
-	// Hotbar key state tracking (detect press, not hold)
-	bool bUpArrowWasDown = false;
-	bool bDownArrowWasDown = false;
-	bool bLeftArrowWasDown = false;
-	bool bRightArrowWasDown = false;
-	bool bIKeyWasDown = false;
-	bool bEKeyWasDown = false;
 	bool bInventoryOpen = false;
 };
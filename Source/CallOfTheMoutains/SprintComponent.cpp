@@ -3,6 +3,7 @@
 #include "SprintComponent.h"
 #include "HealthComponent.h"
 #include "EquipmentComponent.h"
+#include "AttributeModifierComponent.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "GameFramework/SpringArmComponent.h"
@@ -65,6 +66,14 @@ void USprintComponent::CacheComponents()
 		MovementComponent = Character->GetCharacterMovement();
 	}
 
+	// Sprint, weather, debuffs and weight all come through the modifier stack; we smooth
+	// the result ourselves, so the stack must not write MaxWalkSpeed directly
+	AttributeModifiers = UAttributeModifierComponent::FindOrAdd(Owner);
+	if (AttributeModifiers)
+	{
+		AttributeModifiers->bDriveMovementSpeed = false;
+	}
+
 	// Get player controller
 	if (APawn* Pawn = Cast<APawn>(Owner))
 	{
@@ -165,6 +174,11 @@ float USprintComponent::GetTargetSpeed() const
 		}
 	}
 
+	if (AttributeModifiers)
+	{
+		return AttributeModifiers->GetModifiedValue(EModifiedAttribute::MoveSpeed, TargetSpeed);
+	}
+
 	// Apply sprint modifier if sprinting
 	if (bIsSprinting)
 	{
@@ -281,5 +295,18 @@ void USprintComponent::SetSprintState(bool bNewState)
 	}
 
 	bIsSprinting = bNewState;
+
+	if (AttributeModifiers)
+	{
+		if (bIsSprinting)
+		{
+			AttributeModifiers->SetModifier(EModifiedAttribute::MoveSpeed, EModifierSource::Sprint, 0.0f, SprintSpeedMultiplier);
+		}
+		else
+		{
+			AttributeModifiers->RemoveModifier(EModifiedAttribute::MoveSpeed, EModifierSource::Sprint);
+		}
+	}
+
 	OnSprintStateChanged.Broadcast(bIsSprinting);
 }
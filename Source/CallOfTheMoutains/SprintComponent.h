@@ -11,6 +11,7 @@ class UHealthComponent;
 class UEquipmentComponent;
 class UCharacterMovementComponent;
 class USpringArmComponent;
+class UAttributeModifierComponent;
 
 // Delegates
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnSprintStateChanged, bool, bIsSprinting);
@@ -40,7 +41,7 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sprint|Speed")
 	float BaseWalkSpeed = 350.0f;
 
-	/** Sprint speed multiplier */
+	/** Sprint speed multiplier (applied as the Sprint modifier layer) */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sprint|Speed", meta = (ClampMin = "1.0", ClampMax = "3.0"))
 	float SprintSpeedMultiplier = 2.0f;
 
@@ -138,7 +139,7 @@ public:
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Sprint")
 	float GetCurrentMaxSpeed() const;
 
-	/** Get the target speed based on current state */
+	/** Get the target speed based on current state and the owner's MoveSpeed modifier layers */
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Sprint")
 	float GetTargetSpeed() const;
 
@@ -160,6 +161,10 @@ protected:
 	UPROPERTY()
 	APlayerController* PlayerController;
 
+	/** Owner's modifier stack - we drive MaxWalkSpeed from it with smoothing */
+	UPROPERTY()
+	UAttributeModifierComponent* AttributeModifiers;
+
 	/** Original FOV (stored on begin play) */
 	float OriginalFOV = 90.0f;
 
@@ -0,0 +1,272 @@
+// CallOfTheMoutains - Target Spatial Hash Implementation
+
+#include "TargetSpatialHash.h"
+#include "TargetableComponent.h"
+#include "CallOfTheMoutains.h"
+#include "Engine/World.h"
+
+DECLARE_CYCLE_STAT(TEXT("Target Hash Update"), STAT_TargetHashUpdate, STATGROUP_CallOfTheMoutains);
+DECLARE_CYCLE_STAT(TEXT("Target Hash Query"), STAT_TargetHashQuery, STATGROUP_CallOfTheMoutains);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Target Hash Targets"), STAT_TargetHashTargets, STATGROUP_CallOfTheMoutains);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Target Hash Cell Moves"), STAT_TargetHashCellMoves, STATGROUP_CallOfTheMoutains);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Target Hash Candidates Tested"), STAT_TargetHashCandidates, STATGROUP_CallOfTheMoutains);
+
+UTargetSpatialHash* UTargetSpatialHash::Get(const UObject* WorldContextObject)
+{
+	UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UTargetSpatialHash>() : nullptr;
+}
+
+void UTargetSpatialHash::Deinitialize()
+{
+	Cells.Empty();
+	TargetCells.Empty();
+	ActorTargets.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UTargetSpatialHash::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+bool UTargetSpatialHash::IsTickable() const
+{
+	return TargetCells.Num() > 0;
+}
+
+TStatId UTargetSpatialHash::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UTargetSpatialHash, STATGROUP_Tickables);
+}
+
+FIntPoint UTargetSpatialHash::GetCellForLocation(const FVector& Location) const
+{
+	return FIntPoint(
+		FMath::FloorToInt32(Location.X / CellSize),
+		FMath::FloorToInt32(Location.Y / CellSize));
+}
+
+void UTargetSpatialHash::AddToCell(const FIntPoint& Cell, UTargetableComponent* Target)
+{
+	Cells.FindOrAdd(Cell).Add(Target);
+}
+
+void UTargetSpatialHash::RemoveFromCell(const FIntPoint& Cell, const UTargetableComponent* Target)
+{
+	if (TArray<TWeakObjectPtr<UTargetableComponent>>* Bucket = Cells.Find(Cell))
+	{
+		Bucket->RemoveAllSwap([Target](const TWeakObjectPtr<UTargetableComponent>& Entry)
+		{
+			return !Entry.IsValid() || Entry.Get() == Target;
+		});
+
+		if (Bucket->Num() == 0)
+		{
+			Cells.Remove(Cell);
+		}
+	}
+}
+
+void UTargetSpatialHash::RegisterTarget(UTargetableComponent* Target)
+{
+	AActor* Owner = Target ? Target->GetOwner() : nullptr;
+	if (!Owner || TargetCells.Contains(Target))
+	{
+		return;
+	}
+
+	const FIntPoint Cell = GetCellForLocation(Owner->GetActorLocation());
+	TargetCells.Add(Target, Cell);
+	ActorTargets.Add(Owner, Target);
+	AddToCell(Cell, Target);
+}
+
+void UTargetSpatialHash::UnregisterTarget(UTargetableComponent* Target)
+{
+	if (!Target)
+	{
+		return;
+	}
+
+	FIntPoint Cell;
+	if (TargetCells.RemoveAndCopyValue(Target, Cell))
+	{
+		RemoveFromCell(Cell, Target);
+	}
+
+	// Only drop the actor entry if it still points at this target
+	AActor* Owner = Target->GetOwner();
+	const TWeakObjectPtr<UTargetableComponent>* Found = Owner ? ActorTargets.Find(Owner) : nullptr;
+	if (Found && (!Found->IsValid() || Found->Get() == Target))
+	{
+		ActorTargets.Remove(Owner);
+	}
+}
+
+void UTargetSpatialHash::PruneActorTargets()
+{
+	for (auto It = ActorTargets.CreateIterator(); It; ++It)
+	{
+		const UTargetableComponent* Target = It.Value().Get();
+		if (!Target || !Target->GetOwner())
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+UTargetableComponent* UTargetSpatialHash::FindTarget(const AActor* Actor) const
+{
+	const TWeakObjectPtr<UTargetableComponent>* Found = ActorTargets.Find(Actor);
+	return Found ? Found->Get() : nullptr;
+}
+
+void UTargetSpatialHash::SetCellSize(float NewCellSize)
+{
+	NewCellSize = FMath::Max(NewCellSize, 100.0f);
+	if (FMath::IsNearlyEqual(NewCellSize, CellSize))
+	{
+		return;
+	}
+
+	CellSize = NewCellSize;
+
+	// Rebucket everything with the new cell size
+	Cells.Reset();
+	for (TPair<TWeakObjectPtr<UTargetableComponent>, FIntPoint>& Pair : TargetCells)
+	{
+		if (UTargetableComponent* Target = Pair.Key.Get())
+		{
+			if (AActor* Owner = Target->GetOwner())
+			{
+				Pair.Value = GetCellForLocation(Owner->GetActorLocation());
+				AddToCell(Pair.Value, Target);
+			}
+		}
+	}
+}
+
+void UTargetSpatialHash::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	SCOPE_CYCLE_COUNTER(STAT_TargetHashUpdate);
+
+	int32 CellMoves = 0;
+	bool bDroppedTargets = false;
+
+	for (auto It = TargetCells.CreateIterator(); It; ++It)
+	{
+		UTargetableComponent* Target = It.Key().Get();
+		AActor* Owner = Target ? Target->GetOwner() : nullptr;
+
+		// Drop targets destroyed without unregistering
+		if (!Owner)
+		{
+			RemoveFromCell(It.Value(), nullptr);
+			It.RemoveCurrent();
+			bDroppedTargets = true;
+			continue;
+		}
+
+		// Only targets that crossed a cell boundary touch the buckets
+		const FIntPoint NewCell = GetCellForLocation(Owner->GetActorLocation());
+		if (NewCell != It.Value())
+		{
+			RemoveFromCell(It.Value(), Target);
+			AddToCell(NewCell, Target);
+			It.Value() = NewCell;
+			++CellMoves;
+		}
+	}
+
+	// Their actor entries can't be found by key anymore - sweep them out
+	if (bDroppedTargets)
+	{
+		PruneActorTargets();
+	}
+
+	SET_DWORD_STAT(STAT_TargetHashTargets, TargetCells.Num());
+	INC_DWORD_STAT_BY(STAT_TargetHashCellMoves, CellMoves);
+}
+
+template <typename PredicateType>
+void UTargetSpatialHash::ForEachTargetInRadius(const FVector& Origin, float Radius, const AActor* IgnoreActor, PredicateType&& Predicate) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_TargetHashQuery);
+
+	const FIntPoint MinCell = GetCellForLocation(Origin - FVector(Radius, Radius, 0.0f));
+	const FIntPoint MaxCell = GetCellForLocation(Origin + FVector(Radius, Radius, 0.0f));
+	const float RadiusSq = Radius * Radius;
+
+	int32 Candidates = 0;
+
+	for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+	{
+		for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+		{
+			const TArray<TWeakObjectPtr<UTargetableComponent>>* Bucket = Cells.Find(FIntPoint(X, Y));
+			if (!Bucket)
+			{
+				continue;
+			}
+
+			for (const TWeakObjectPtr<UTargetableComponent>& Entry : *Bucket)
+			{
+				UTargetableComponent* Target = Entry.Get();
+				AActor* Owner = Target ? Target->GetOwner() : nullptr;
+				if (!Owner || Owner == IgnoreActor || !Target->IsTargetable())
+				{
+					continue;
+				}
+
+				++Candidates;
+
+				const FVector ToTarget = Owner->GetActorLocation() - Origin;
+				const float DistSq = ToTarget.SizeSquared();
+				if (DistSq <= RadiusSq)
+				{
+					Predicate(Target, ToTarget, DistSq);
+				}
+			}
+		}
+	}
+
+	INC_DWORD_STAT_BY(STAT_TargetHashCandidates, Candidates);
+}
+
+void UTargetSpatialHash::QueryTargetsInRadius(const FVector& Origin, float Radius, TArray<UTargetableComponent*>& OutTargets, const AActor* IgnoreActor) const
+{
+	OutTargets.Reset();
+
+	ForEachTargetInRadius(Origin, Radius, IgnoreActor, [&OutTargets](UTargetableComponent* Target, const FVector&, float)
+	{
+		OutTargets.Add(Target);
+	});
+}
+
+void UTargetSpatialHash::QueryTargetsInCone(const FVector& Origin, const FVector& Forward, float Radius, float HalfAngleDegrees, TArray<UTargetableComponent*>& OutTargets, const AActor* IgnoreActor) const
+{
+	OutTargets.Reset();
+
+	// Compare against cos(angle) scaled by distance so no per-target sqrt/acos is needed
+	const float CosHalfAngle = FMath::Cos(FMath::DegreesToRadians(HalfAngleDegrees));
+
+	ForEachTargetInRadius(Origin, Radius, IgnoreActor, [&OutTargets, &Forward, CosHalfAngle](UTargetableComponent* Target, const FVector& ToTarget, float DistSq)
+	{
+		const float Dot = FVector::DotProduct(Forward, ToTarget);
+		if (CosHalfAngle >= 0.0f)
+		{
+			if (Dot >= 0.0f && Dot * Dot >= CosHalfAngle * CosHalfAngle * DistSq)
+			{
+				OutTargets.Add(Target);
+			}
+		}
+		else if (Dot >= 0.0f || Dot * Dot <= CosHalfAngle * CosHalfAngle * DistSq)
+		{
+			OutTargets.Add(Target);
+		}
+	});
+}
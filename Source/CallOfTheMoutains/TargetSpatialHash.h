@@ -0,0 +1,97 @@
+// CallOfTheMoutains - Target Spatial Hash
+// Uniform-grid index of lock-on targets so range queries touch only nearby cells
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "TargetSpatialHash.generated.h"
+
+class UTargetableComponent;
+
+/**
+ * Target Spatial Hash
+ * UTargetableComponents register at BeginPlay and unregister at EndPlay.
+ * Targets are bucketed into a uniform XY grid; each tick only targets that crossed
+ * a cell boundary are moved between buckets. Lock-on range/cone queries read the
+ * overlapping cells instead of running a physics overlap + component scan.
+ */
+UCLASS()
+class CALLOFTHEMOUTAINS_API UTargetSpatialHash : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Get the subsystem for a world context (nullptr if unavailable) */
+	static UTargetSpatialHash* Get(const UObject* WorldContextObject);
+
+	virtual void Deinitialize() override;
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override;
+
+	/** Add a target to the grid (called from UTargetableComponent::BeginPlay) */
+	void RegisterTarget(UTargetableComponent* Target);
+
+	/** Remove a target from the grid (called from UTargetableComponent::EndPlay) */
+	void UnregisterTarget(UTargetableComponent* Target);
+
+	/** Is this actor a registered target? Returns its targetable component if so */
+	UTargetableComponent* FindTarget(const AActor* Actor) const;
+
+	/**
+	 * Collect targetable components within Radius of Origin.
+	 * @param IgnoreActor - Optional actor to skip (the querying pawn)
+	 */
+	void QueryTargetsInRadius(const FVector& Origin, float Radius, TArray<UTargetableComponent*>& OutTargets, const AActor* IgnoreActor = nullptr) const;
+
+	/**
+	 * Collect targetable components within Radius of Origin and within HalfAngleDegrees of Forward.
+	 * Forward is expected to be normalized.
+	 */
+	void QueryTargetsInCone(const FVector& Origin, const FVector& Forward, float Radius, float HalfAngleDegrees, TArray<UTargetableComponent*>& OutTargets, const AActor* IgnoreActor = nullptr) const;
+
+	/** Number of registered targets */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Lock On")
+	int32 GetNumTargets() const { return TargetCells.Num(); }
+
+	/** Number of occupied grid cells */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Lock On")
+	int32 GetNumOccupiedCells() const { return Cells.Num(); }
+
+	/** Edge length of a grid cell (world units). Rebuilds the grid when changed. */
+	UFUNCTION(BlueprintCallable, Category = "Lock On")
+	void SetCellSize(float NewCellSize);
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Lock On")
+	float GetCellSize() const { return CellSize; }
+
+private:
+	/** Bucket of targets per grid cell */
+	TMap<FIntPoint, TArray<TWeakObjectPtr<UTargetableComponent>>> Cells;
+
+	/** Cell each registered target currently lives in */
+	TMap<TWeakObjectPtr<UTargetableComponent>, FIntPoint> TargetCells;
+
+	/** Owner actor -> targetable, for actor-keyed lookups */
+	TMap<TObjectKey<AActor>, TWeakObjectPtr<UTargetableComponent>> ActorTargets;
+
+	/** Edge length of a cell - roughly half the lock-on range keeps queries at ~5x5 cells */
+	float CellSize = 1000.0f;
+
+	FIntPoint GetCellForLocation(const FVector& Location) const;
+
+	void AddToCell(const FIntPoint& Cell, UTargetableComponent* Target);
+	void RemoveFromCell(const FIntPoint& Cell, const UTargetableComponent* Target);
+
+	/** Drop actor entries whose target or owner is gone */
+	void PruneActorTargets();
+
+	/** Visit every live target in cells overlapping the circle, filtered by distance */
+	template <typename PredicateType>
+	void ForEachTargetInRadius(const FVector& Origin, float Radius, const AActor* IgnoreActor, PredicateType&& Predicate) const;
+};
@@ -1,6 +1,7 @@
 // CallOfTheMoutains - Targetable Component for Lock-On System
 
 #include "TargetableComponent.h"
+#include "TargetSpatialHash.h"
 #include "Components/BillboardComponent.h"
 #include "Components/PointLightComponent.h"
 #include "Components/SkeletalMeshComponent.h"
@@ -21,6 +22,22 @@ void UTargetableComponent::BeginPlay()
 
 	// Start with indicators hidden
 	HideIndicator();
+
+	// Publish into the lock-on spatial index
+	if (UTargetSpatialHash* SpatialHash = UTargetSpatialHash::Get(this))
+	{
+		SpatialHash->RegisterTarget(this);
+	}
+}
+
+void UTargetableComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UTargetSpatialHash* SpatialHash = UTargetSpatialHash::Get(this))
+	{
+		SpatialHash->UnregisterTarget(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 FVector UTargetableComponent::GetTargetLocation() const
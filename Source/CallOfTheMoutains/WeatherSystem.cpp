@@ -1,10 +1,22 @@
 // CallOfTheMoutains - Weather System Implementation
 
 #include "WeatherSystem.h"
+#include "COTMSaveGame.h"
 #include "Particles/ParticleSystemComponent.h"
 #include "Components/AudioComponent.h"
 #include "Kismet/GameplayStatics.h"
 #include "GameFramework/Character.h"
+#include "CallOfTheMoutains.h"
+#include "TimerManager.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Weather Effects Active"), STAT_WeatherEffectsActive, STATGROUP_CallOfTheMoutains);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Weather Effect Activations"), STAT_WeatherEffectActivations, STATGROUP_CallOfTheMoutains);
+
+namespace
+{
+	/** Particles spawn this far above the player */
+	const FVector WeatherParticleOffset(0.0f, 0.0f, 500.0f);
+}
 
 UWeatherSystem::UWeatherSystem()
 {
@@ -24,36 +36,47 @@ void UWeatherSystem::BeginPlay()
 	TargetWeather = StartingWeather;
 	TransitionState = EWeatherTransitionState::Stable;
 
-	// Calculate initial duration
-	if (WeatherTransitions.Contains(CurrentWeather))
-	{
-		const FWeatherTransition& Transition = WeatherTransitions[CurrentWeather];
-		CurrentWeatherDuration = FMath::FRandRange(Transition.MinDuration, Transition.MaxDuration);
-		TimeUntilWeatherChange = CurrentWeatherDuration;
-	}
-	else
+	// Start the timeline - everything random about the weather is rolled from its seed
+	const int32 Seed = WeatherSeed != 0 ? WeatherSeed : FMath::RandRange(1, MAX_int32 - 1);
+	Timeline.SetRules(&WeatherTransitions, WeatherChangeProbability);
+	Timeline.Reset(Seed, StartingWeather);
+	SyncFromTimeline();
+
+	// Pre-warm every weather's effects, then apply the initial weather
+	CreateEffectPool();
+	ApplyWeatherEffects();
+}
+
+void UWeatherSystem::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UWorld* World = GetWorld())
 	{
-		TimeUntilWeatherChange = 300.0f; // Default 5 minutes
+		World->GetTimerManager().ClearTimer(ThunderTimerHandle);
 	}
 
-	// Apply initial weather
-	ApplyWeatherEffects();
+	Super::EndPlay(EndPlayReason);
 }
 
 void UWeatherSystem::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
-	// Update transition
-	if (TransitionState != EWeatherTransitionState::Stable)
+	// Step the timeline (transitions re-apply effects, which also moves them to the player)
+	Timeline.SetRules(&WeatherTransitions, WeatherChangeProbability);
+	if (bWeatherChangeEnabled)
 	{
-		UpdateTransition(DeltaTime);
+		Timeline.Advance(DeltaTime);
 	}
+	else
+	{
+		Timeline.Hold(DeltaTime);
+	}
+	SyncFromTimeline();
 
-	// Check for weather changes
-	if (bWeatherChangeEnabled && TransitionState == EWeatherTransitionState::Stable)
+	if (TransitionState == EWeatherTransitionState::Stable && NumActiveEffects > 0)
 	{
-		CheckWeatherChange(DeltaTime);
+		// Keep active effects on the player
+		FollowPlayer();
 	}
 
 	// Update storm effects
@@ -64,21 +87,11 @@ void UWeatherSystem::TickComponent(float DeltaTime, ELevelTick TickType, FActorC
 		{
 			TriggerLightning();
 			// Random interval between lightning strikes (5-30 seconds)
-			LightningTimer = FMath::FRandRange(5.0f, 30.0f);
+			LightningTimer = LightningStream.FRandRange(5.0f, 30.0f);
 		}
 	}
 
-	// Update particle position to follow player
-	if (ActiveParticles)
-	{
-		ACharacter* Player = UGameplayStatics::GetPlayerCharacter(this, 0);
-		if (Player)
-		{
-			FVector ParticleLocation = Player->GetActorLocation();
-			ParticleLocation.Z += 500.0f; // Above player
-			ActiveParticles->SetWorldLocation(ParticleLocation);
-		}
-	}
+	SET_DWORD_STAT(STAT_WeatherEffectsActive, NumActiveEffects);
 }
 
 void UWeatherSystem::InitializeDefaults()
@@ -278,187 +291,213 @@ void UWeatherSystem::InitializeDefaults()
 	}
 }
 
-void UWeatherSystem::UpdateTransition(float DeltaTime)
+void UWeatherSystem::SyncFromTimeline()
 {
-	TransitionProgress += DeltaTime / CurrentTransitionDuration;
+	const FWeatherTimelineState State = Timeline.GetState();
+	const EWeatherType OldWeather = CurrentWeather;
+	const bool bWasTransitioning = TransitionState != EWeatherTransitionState::Stable;
 
-	if (TransitionProgress >= 1.0f)
-	{
-		TransitionProgress = 1.0f;
-		TransitionState = EWeatherTransitionState::Stable;
+	CurrentWeather = State.Current;
+	TargetWeather = State.Target;
+	TransitionState = State.bTransitioning ? EWeatherTransitionState::TransitioningIn : EWeatherTransitionState::Stable;
+	TransitionProgress = State.TransitionProgress;
 
-		EWeatherType OldWeather = CurrentWeather;
-		CurrentWeather = TargetWeather;
+	if (State.bTransitioning)
+	{
+		PreviousWeather = State.Current;
+	}
+	else if (CurrentWeather != OldWeather)
+	{
+		PreviousWeather = OldWeather;
+	}
 
-		// Set up next duration
-		if (WeatherTransitions.Contains(CurrentWeather))
-		{
-			const FWeatherTransition& Transition = WeatherTransitions[CurrentWeather];
-			CurrentWeatherDuration = FMath::FRandRange(Transition.MinDuration, Transition.MaxDuration);
-			TimeUntilWeatherChange = CurrentWeatherDuration * WeatherChangeProbability;
-		}
+	// Lightning intervals replay with the segment
+	const int32 Segment = Timeline.GetCursor().Segment;
+	if (Segment != SyncedSegment)
+	{
+		SyncedSegment = Segment;
+		LightningStream.Initialize(Timeline.GetSegmentSeed());
+		ThunderStream.Initialize(static_cast<int32>(HashCombine(static_cast<uint32>(Timeline.GetSegmentSeed()), 0x54484452u))); // "THDR"
+		LightningTimer = LightningStream.FRandRange(3.0f, 10.0f);
+	}
 
+	if (CurrentWeather != OldWeather)
+	{
 		OnWeatherChanged.Broadcast(CurrentWeather, OldWeather);
-
-		// Reset lightning timer for storms
-		if (CurrentWeather == EWeatherType::Storm)
-		{
-			LightningTimer = FMath::FRandRange(3.0f, 10.0f);
-		}
 	}
 
-	ApplyWeatherEffects();
+	if (State.bTransitioning || bWasTransitioning || CurrentWeather != OldWeather)
+	{
+		ApplyWeatherEffects();
+	}
 }
 
-void UWeatherSystem::CheckWeatherChange(float DeltaTime)
+void UWeatherSystem::ApplyWeatherEffects()
 {
-	TimeUntilWeatherChange -= DeltaTime;
-
-	if (TimeUntilWeatherChange <= 0.0f)
-	{
-		TriggerRandomWeatherChange();
-	}
+	UpdateEffectWeights();
+	UpdateParticles();
+	UpdateAudio();
+	FollowPlayer();
 }
 
-EWeatherType UWeatherSystem::SelectNextWeather() const
+void UWeatherSystem::CreateEffectPool()
 {
-	if (!WeatherTransitions.Contains(CurrentWeather))
+	AActor* Owner = GetOwner();
+	if (!Owner)
 	{
-		return EWeatherType::Clear;
+		return;
 	}
 
-	const FWeatherTransition& Transition = WeatherTransitions[CurrentWeather];
-
-	if (Transition.PossibleNextWeathers.Num() == 0)
-	{
-		return EWeatherType::Clear;
-	}
+	ParticlePool.Init(nullptr, NumWeatherTypes);
+	AudioPool.Init(nullptr, NumWeatherTypes);
+	EffectWeights.Init(0.0f, NumWeatherTypes);
 
-	// Calculate total weight
-	float TotalWeight = 0.0f;
-	for (int32 i = 0; i < Transition.TransitionWeights.Num() && i < Transition.PossibleNextWeathers.Num(); i++)
+	for (int32 i = 0; i < NumWeatherTypes; ++i)
 	{
-		TotalWeight += Transition.TransitionWeights[i];
-	}
-
-	// Random selection
-	float Random = FMath::FRand() * TotalWeight;
-	float Accumulated = 0.0f;
+		const EWeatherType Weather = static_cast<EWeatherType>(i);
 
-	for (int32 i = 0; i < Transition.PossibleNextWeathers.Num(); i++)
-	{
-		float Weight = (i < Transition.TransitionWeights.Num()) ? Transition.TransitionWeights[i] : 1.0f;
-		Accumulated += Weight;
+		if (UParticleSystem* Template = GetParticlesForWeather(Weather))
+		{
+			UParticleSystemComponent* Particles = NewObject<UParticleSystemComponent>(Owner);
+			Particles->bAutoActivate = false;
+			Particles->SetUsingAbsoluteLocation(true);
+			Particles->SetUsingAbsoluteRotation(true);
+			Particles->SetTemplate(Template);
+			Particles->RegisterComponent();
+			ParticlePool[i] = Particles;
+		}
 
-		if (Random <= Accumulated)
+		if (USoundBase* Sound = GetSoundForWeather(Weather))
 		{
-			return Transition.PossibleNextWeathers[i];
+			UAudioComponent* Audio = NewObject<UAudioComponent>(Owner);
+			Audio->bAutoActivate = false;
+			Audio->SetUsingAbsoluteLocation(true);
+			Audio->SetSound(Sound);
+			Audio->RegisterComponent();
+			AudioPool[i] = Audio;
 		}
 	}
 
-	return Transition.PossibleNextWeathers[0];
+	if (ThunderSounds.Num() > 0)
+	{
+		ThunderAudio = NewObject<UAudioComponent>(Owner);
+		ThunderAudio->bAutoActivate = false;
+		ThunderAudio->bAllowSpatialization = false;
+		ThunderAudio->RegisterComponent();
+	}
 }
 
-void UWeatherSystem::ApplyWeatherEffects()
+void UWeatherSystem::UpdateEffectWeights()
 {
-	UpdateParticles();
-	UpdateAudio();
+	if (EffectWeights.Num() != NumWeatherTypes)
+	{
+		return;
+	}
+
+	for (float& Weight : EffectWeights)
+	{
+		Weight = 0.0f;
+	}
+
+	// The outgoing weather fades as the incoming one builds up
+	if (TransitionState == EWeatherTransitionState::Stable)
+	{
+		EffectWeights[static_cast<int32>(CurrentWeather)] = 1.0f;
+	}
+	else
+	{
+		EffectWeights[static_cast<int32>(PreviousWeather)] += 1.0f - TransitionProgress;
+		EffectWeights[static_cast<int32>(TargetWeather)] += TransitionProgress;
+	}
 }
 
 void UWeatherSystem::UpdateParticles()
 {
-	UParticleSystem* TargetParticles = GetParticlesForWeather(TargetWeather);
+	NumActiveEffects = 0;
 
-	// Get player for attachment
-	ACharacter* Player = UGameplayStatics::GetPlayerCharacter(this, 0);
-	if (!Player)
+	for (int32 i = 0; i < ParticlePool.Num(); ++i)
 	{
-		return;
-	}
+		UParticleSystemComponent* Particles = ParticlePool[i];
+		if (!Particles)
+		{
+			continue;
+		}
 
-	// Create or update particle component
-	if (TargetParticles)
-	{
-		if (!ActiveParticles || ActiveParticles->Template != TargetParticles)
+		const float Weight = EffectWeights[i];
+		if (Weight > 0.0f)
 		{
-			// Need new particle component
-			if (ActiveParticles)
+			const FWeatherVisuals* Visuals = WeatherVisuals.Find(static_cast<EWeatherType>(i));
+			Particles->SetFloatParameter(ParticleIntensityParameter, (Visuals ? Visuals->ParticleIntensity : 1.0f) * Weight);
+
+			if (!Particles->IsActive())
 			{
-				ActiveParticles->DestroyComponent();
+				Particles->Activate();
+				INC_DWORD_STAT(STAT_WeatherEffectActivations);
 			}
-
-			ActiveParticles = UGameplayStatics::SpawnEmitterAtLocation(
-				this,
-				TargetParticles,
-				Player->GetActorLocation() + FVector(0, 0, 500),
-				FRotator::ZeroRotator,
-				FVector(1.0f),
-				true,
-				EPSCPoolMethod::None,
-				false
-			);
+			++NumActiveEffects;
 		}
-
-		// Adjust intensity based on transition
-		if (ActiveParticles && WeatherVisuals.Contains(TargetWeather))
+		else if (Particles->IsActive())
 		{
-			float Intensity = WeatherVisuals[TargetWeather].ParticleIntensity * TransitionProgress;
-			// Note: You'd need to set spawn rate or other parameters here
-			// This depends on your specific particle system setup
+			// Stop spawning - particles already in the air finish their lifetime
+			Particles->Deactivate();
 		}
 	}
-	else if (ActiveParticles)
-	{
-		// Fade out and destroy
-		ActiveParticles->DestroyComponent();
-		ActiveParticles = nullptr;
-	}
 }
 
 void UWeatherSystem::UpdateAudio()
 {
-	USoundBase* TargetSound = GetSoundForWeather(TargetWeather);
-
-	if (TargetSound)
+	for (int32 i = 0; i < AudioPool.Num(); ++i)
 	{
-		if (!ActiveWeatherAudio || ActiveWeatherAudio->Sound != TargetSound)
+		UAudioComponent* Audio = AudioPool[i];
+		if (!Audio)
 		{
-			// Stop old audio
-			if (ActiveWeatherAudio)
-			{
-				ActiveWeatherAudio->FadeOut(2.0f, 0.0f);
-			}
+			continue;
+		}
+
+		const float Weight = EffectWeights[i];
+		if (Weight > 0.0f)
+		{
+			Audio->SetVolumeMultiplier(Weight);
 
-			// Start new audio
-			ACharacter* Player = UGameplayStatics::GetPlayerCharacter(this, 0);
-			if (Player)
+			if (!Audio->IsPlaying())
 			{
-				ActiveWeatherAudio = UGameplayStatics::SpawnSoundAttached(
-					TargetSound,
-					Player->GetRootComponent(),
-					NAME_None,
-					FVector::ZeroVector,
-					EAttachLocation::KeepRelativeOffset,
-					true,
-					TransitionProgress,
-					1.0f,
-					0.0f,
-					nullptr,
-					nullptr,
-					false
-				);
+				Audio->Play();
+				INC_DWORD_STAT(STAT_WeatherEffectActivations);
 			}
+			++NumActiveEffects;
 		}
-		else if (ActiveWeatherAudio)
+		else if (Audio->IsPlaying())
 		{
-			// Adjust volume based on transition
-			ActiveWeatherAudio->SetVolumeMultiplier(TransitionProgress);
+			// Faded to silence by the transition already
+			Audio->Stop();
 		}
 	}
-	else if (ActiveWeatherAudio)
+}
+
+void UWeatherSystem::FollowPlayer()
+{
+	ACharacter* Player = UGameplayStatics::GetPlayerCharacter(this, 0);
+	if (!Player)
+	{
+		return;
+	}
+
+	const FVector PlayerLocation = Player->GetActorLocation();
+	for (int32 i = 0; i < EffectWeights.Num(); ++i)
 	{
-		ActiveWeatherAudio->FadeOut(2.0f, 0.0f);
-		ActiveWeatherAudio = nullptr;
+		if (EffectWeights[i] <= 0.0f)
+		{
+			continue;
+		}
+
+		if (UParticleSystemComponent* Particles = ParticlePool[i])
+		{
+			Particles->SetWorldLocation(PlayerLocation + WeatherParticleOffset);
+		}
+		if (UAudioComponent* Audio = AudioPool[i])
+		{
+			Audio->SetWorldLocation(PlayerLocation);
+		}
 	}
 }
 
@@ -585,18 +624,28 @@ FWeatherVisuals UWeatherSystem::GetCurrentWeatherVisuals() const
 	return FWeatherVisuals();
 }
 
+void UWeatherSystem::GetVisualsBlend(EWeatherType& OutFrom, EWeatherType& OutTo, float& OutAlpha) const
+{
+	if (TransitionState == EWeatherTransitionState::Stable)
+	{
+		OutFrom = CurrentWeather;
+		OutTo = CurrentWeather;
+		OutAlpha = 1.0f;
+	}
+	else
+	{
+		OutFrom = PreviousWeather;
+		OutTo = TargetWeather;
+		OutAlpha = TransitionProgress;
+	}
+}
+
 void UWeatherSystem::SetWeather(EWeatherType NewWeather, bool bInstant)
 {
 	if (bInstant)
 	{
-		PreviousWeather = CurrentWeather;
-		CurrentWeather = NewWeather;
-		TargetWeather = NewWeather;
-		TransitionState = EWeatherTransitionState::Stable;
-		TransitionProgress = 1.0f;
-
-		ApplyWeatherEffects();
-		OnWeatherChanged.Broadcast(CurrentWeather, PreviousWeather);
+		Timeline.Force(NewWeather);
+		SyncFromTimeline();
 	}
 	else
 	{
@@ -611,29 +660,52 @@ void UWeatherSystem::TransitionToWeather(EWeatherType NewWeather, float Duration
 		return;
 	}
 
-	PreviousWeather = CurrentWeather;
-	TargetWeather = NewWeather;
-	TransitionState = EWeatherTransitionState::TransitioningIn;
-	TransitionProgress = 0.0f;
-
-	if (Duration > 0.0f)
-	{
-		CurrentTransitionDuration = Duration;
-	}
-	else if (WeatherTransitions.Contains(CurrentWeather))
-	{
-		CurrentTransitionDuration = WeatherTransitions[CurrentWeather].TransitionDuration;
-	}
-	else
+	if (Duration <= 0.0f)
 	{
-		CurrentTransitionDuration = 30.0f;
+		const FWeatherTransition* Transition = WeatherTransitions.Find(CurrentWeather);
+		Duration = Transition ? Transition->TransitionDuration : 30.0f;
 	}
+
+	Timeline.ForceTransition(NewWeather, Duration);
+	SyncFromTimeline();
 }
 
 void UWeatherSystem::TriggerRandomWeatherChange()
 {
-	EWeatherType NextWeather = SelectNextWeather();
-	TransitionToWeather(NextWeather);
+	// Start the transition the timeline rolled for this weather now
+	Timeline.BeginTransition();
+	SyncFromTimeline();
+}
+
+void UWeatherSystem::AdvanceWeather(float Seconds)
+{
+	Timeline.SetRules(&WeatherTransitions, WeatherChangeProbability);
+	Timeline.Advance(Seconds);
+	SyncFromTimeline();
+}
+
+EWeatherType UWeatherSystem::PredictWeather(float SecondsAhead) const
+{
+	const FWeatherTimelineState State = Timeline.Predict(SecondsAhead);
+	return State.bTransitioning && State.TransitionProgress >= 0.5f ? State.Target : State.Current;
+}
+
+void UWeatherSystem::WriteToSave(UCOTMSaveGame* SaveObject) const
+{
+	SaveObject->WeatherTimeline = Timeline.GetCursor();
+	SaveObject->bHasWeatherTimeline = true;
+}
+
+void UWeatherSystem::ReadFromSave(const UCOTMSaveGame* SaveObject)
+{
+	if (!SaveObject->bHasWeatherTimeline)
+	{
+		return;
+	}
+
+	Timeline.SetCursor(SaveObject->WeatherTimeline);
+	SyncedSegment = INDEX_NONE;
+	SyncFromTimeline();
 }
 
 void UWeatherSystem::TriggerLightning()
@@ -656,23 +728,28 @@ void UWeatherSystem::PlayThunder()
 		return;
 	}
 
-	int32 SoundIndex = FMath::RandRange(0, ThunderSounds.Num() - 1);
+	int32 SoundIndex = ThunderStream.RandRange(0, ThunderSounds.Num() - 1);
 	USoundBase* ThunderSound = ThunderSounds[SoundIndex];
 
-	if (ThunderSound)
+	if (ThunderSound && ThunderAudio)
 	{
-		// Play with slight delay to simulate distance
-		float Delay = FMath::FRandRange(0.5f, 3.0f);
+		// Play with slight delay to simulate distance (a newer strike replaces one still waiting)
+		float Delay = ThunderStream.FRandRange(0.5f, 3.0f);
 
-		FTimerHandle ThunderTimer;
-		GetWorld()->GetTimerManager().SetTimer(
-			ThunderTimer,
-			[this, ThunderSound]()
-			{
-				UGameplayStatics::PlaySound2D(this, ThunderSound, FMath::FRandRange(0.7f, 1.0f));
-			},
-			Delay,
-			false
-		);
+		PendingThunderSound = ThunderSound;
+		GetWorld()->GetTimerManager().SetTimer(ThunderTimerHandle, this, &UWeatherSystem::PlayPendingThunder, Delay, false);
 	}
 }
+
+void UWeatherSystem::PlayPendingThunder()
+{
+	if (!ThunderAudio || !PendingThunderSound)
+	{
+		return;
+	}
+
+	ThunderAudio->SetSound(PendingThunderSound);
+	ThunderAudio->SetVolumeMultiplier(ThunderStream.FRandRange(0.7f, 1.0f));
+	ThunderAudio->Play();
+	PendingThunderSound = nullptr;
+}
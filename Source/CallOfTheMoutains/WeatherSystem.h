@@ -6,10 +6,12 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "DayNightTypes.h"
+#include "WeatherTimeline.h"
 #include "WeatherSystem.generated.h"
 
 class UParticleSystemComponent;
 class UAudioComponent;
+class UCOTMSaveGame;
 
 /**
  * Weather transition configuration
@@ -47,7 +49,8 @@ struct FWeatherTransition
  * Attach to the DayNightManager actor.
  *
  * Features:
- * - Randomized weather with weighted transitions
+ * - Randomized weather with weighted transitions, from a seeded timeline (reproducible
+ *   across save/load, fast-forwarded over time skips)
  * - Particle effects for rain, snow, etc.
  * - Integration with lighting and post-process
  * - Weather-based gameplay modifiers
@@ -62,6 +65,7 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 public:
@@ -79,6 +83,10 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Weather|Settings", meta = (ClampMin = "0.0", ClampMax = "2.0"))
 	float WeatherChangeProbability = 1.0f;
 
+	/** Seed of the weather timeline (0 = a new random seed every session). The same seed gives the same weather */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Weather|Settings")
+	int32 WeatherSeed = 0;
+
 	/** Transition rules for each weather type */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Weather|Transitions")
 	TMap<EWeatherType, FWeatherTransition> WeatherTransitions;
@@ -113,6 +121,13 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Weather|Particles")
 	UParticleSystem* FogParticles;
 
+	/**
+	 * Float instance parameter set to ParticleIntensity x the weather's cross-fade weight.
+	 * Bind the emitters' spawn rate to it with a Particle Parameter distribution.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Weather|Particles")
+	FName ParticleIntensityParameter = TEXT("SpawnRate");
+
 	// ==================== Audio References ====================
 
 	/** Rain ambient sound */
@@ -171,6 +186,9 @@ public:
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Weather")
 	FWeatherVisuals GetCurrentWeatherVisuals() const;
 
+	/** Weathers whose visuals are blended right now and the blend alpha (From == To when stable) */
+	void GetVisualsBlend(EWeatherType& OutFrom, EWeatherType& OutTo, float& OutAlpha) const;
+
 	// ==================== Weather Control ====================
 
 	/** Force a specific weather (optionally instant) */
@@ -189,6 +207,30 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Weather")
 	void SetWeatherChangeEnabled(bool bEnabled) { bWeatherChangeEnabled = bEnabled; }
 
+	// ==================== Timeline ====================
+
+	/** Fast-forward the weather (time skips, sleeping): steps the timeline and jumps straight to the result */
+	UFUNCTION(BlueprintCallable, Category = "Weather")
+	void AdvanceWeather(float Seconds);
+
+	/** Weather the timeline shows SecondsAhead from now (scripted changes in between aren't known yet) */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Weather")
+	EWeatherType PredictWeather(float SecondsAhead) const;
+
+	/** Seed the current timeline was started from */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Weather")
+	int32 GetWeatherSeed() const { return Timeline.GetCursor().Seed; }
+
+	const FWeatherTimeline& GetTimeline() const { return Timeline; }
+
+	// ==================== Save/Load ====================
+
+	/** Store the timeline's seed and cursor */
+	void WriteToSave(UCOTMSaveGame* SaveObject) const;
+
+	/** Continue the saved timeline (saves without one keep the current timeline) */
+	void ReadFromSave(const UCOTMSaveGame* SaveObject);
+
 	// ==================== Storm Effects ====================
 
 	/** Trigger a lightning flash and thunder */
@@ -214,55 +256,76 @@ protected:
 	/** Transition progress (0-1) */
 	float TransitionProgress = 0.0f;
 
-	/** Duration of current transition */
-	float CurrentTransitionDuration = 30.0f;
-
-	/** Time until next weather change check */
-	float TimeUntilWeatherChange = 0.0f;
+	/** Seeded weather sequence - the state above mirrors it */
+	FWeatherTimeline Timeline;
 
-	/** Current weather duration */
-	float CurrentWeatherDuration = 0.0f;
+	/** Timeline segment the state was last synced from (lightning restarts with each segment) */
+	int32 SyncedSegment = INDEX_NONE;
 
 	/** Timer for lightning in storms */
 	float LightningTimer = 0.0f;
 
-	// ==================== Active Components ====================
+	/** Lightning intervals, seeded per timeline segment */
+	FRandomStream LightningStream;
+
+	/** Thunder sound, delay and volume - kept apart so playback never shifts the strike schedule */
+	FRandomStream ThunderStream;
+
+	// ==================== Effect Pool ====================
 
-	/** Active weather particle component */
+	/**
+	 * Effect components created once at BeginPlay, indexed by EWeatherType (null where the
+	 * weather has no asset). Weather changes cross-fade them through parameters and volume
+	 * and activate/deactivate them - nothing is spawned or destroyed afterwards.
+	 */
 	UPROPERTY()
-	UParticleSystemComponent* ActiveParticles;
+	TArray<UParticleSystemComponent*> ParticlePool;
+
+	UPROPERTY()
+	TArray<UAudioComponent*> AudioPool;
+
+	/** Cross-fade weight of each weather's effects (0 = off) */
+	TArray<float> EffectWeights;
+
+	/** Pooled components currently active (they follow the player) */
+	int32 NumActiveEffects = 0;
 
-	/** Active weather audio component */
+	/** Single thunder voice, reused for every strike */
 	UPROPERTY()
-	UAudioComponent* ActiveWeatherAudio;
+	UAudioComponent* ThunderAudio;
 
-	/** Active wind audio component */
+	/** Thunder waiting for its distance delay */
 	UPROPERTY()
-	UAudioComponent* ActiveWindAudio;
+	USoundBase* PendingThunderSound;
+
+	FTimerHandle ThunderTimerHandle;
 
 	// ==================== Internal Functions ====================
 
 	/** Initialize default weather configurations */
 	void InitializeDefaults();
 
-	/** Update weather transition */
-	void UpdateTransition(float DeltaTime);
-
-	/** Check if we should change weather */
-	void CheckWeatherChange(float DeltaTime);
-
-	/** Select next weather based on transition rules */
-	EWeatherType SelectNextWeather() const;
+	/** Copy the timeline's state, firing change events and updating effects */
+	void SyncFromTimeline();
 
 	/** Apply current weather effects */
 	void ApplyWeatherEffects();
 
+	/** Create the pooled particle/audio components for every weather with assets */
+	void CreateEffectPool();
+
+	/** Cross-fade weights from the current transition */
+	void UpdateEffectWeights();
+
 	/** Update particle effects */
 	void UpdateParticles();
 
 	/** Update audio for current weather */
 	void UpdateAudio();
 
+	/** Move active pooled effects to the player */
+	void FollowPlayer();
+
 	/** Lerp between weather visuals */
 	FWeatherVisuals LerpWeatherVisuals(const FWeatherVisuals& A, const FWeatherVisuals& B, float Alpha) const;
 
@@ -275,6 +338,9 @@ protected:
 	/** Play thunder sound */
 	void PlayThunder();
 
+	/** Thunder delay elapsed */
+	void PlayPendingThunder();
+
 	/** Handle lightning flash effect */
 	void DoLightningFlash();
 };
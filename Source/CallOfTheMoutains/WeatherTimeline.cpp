@@ -0,0 +1,203 @@
+// CallOfTheMoutains - Weather Timeline Implementation
+
+#include "WeatherTimeline.h"
+#include "WeatherSystem.h"
+#include "CallOfTheMoutains.h"
+#include "Math/RandomStream.h"
+
+DECLARE_CYCLE_STAT(TEXT("Weather Timeline Advance"), STAT_WeatherTimelineAdvance, STATGROUP_CallOfTheMoutains);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Weather Segments Crossed"), STAT_WeatherSegmentsCrossed, STATGROUP_CallOfTheMoutains);
+
+namespace
+{
+	/** Weathers without transition rules */
+	constexpr double DefaultHoldSeconds = 300.0;
+	constexpr double DefaultTransitionSeconds = 30.0;
+
+	/** Keeps zero-length segments from stalling Advance */
+	constexpr double MinTransitionSeconds = 0.1;
+
+	EWeatherType RollNextWeather(const FWeatherTransition& Rule, FRandomStream& Stream)
+	{
+		const TArray<EWeatherType>& Options = Rule.PossibleNextWeathers;
+		if (Options.Num() == 0)
+		{
+			return EWeatherType::Clear;
+		}
+
+		// Options without a weight count as 1
+		auto GetWeight = [&Rule](int32 Index)
+		{
+			return Rule.TransitionWeights.IsValidIndex(Index) ? Rule.TransitionWeights[Index] : 1.0f;
+		};
+
+		float TotalWeight = 0.0f;
+		for (int32 i = 0; i < Options.Num(); ++i)
+		{
+			TotalWeight += GetWeight(i);
+		}
+
+		const float Random = Stream.FRand() * TotalWeight;
+		float Accumulated = 0.0f;
+		for (int32 i = 0; i < Options.Num(); ++i)
+		{
+			Accumulated += GetWeight(i);
+			if (Random <= Accumulated)
+			{
+				return Options[i];
+			}
+		}
+
+		return Options[0];
+	}
+}
+
+void FWeatherTimeline::SetRules(const TMap<EWeatherType, FWeatherTransition>* InRules, float InChangeProbability)
+{
+	Rules = InRules;
+	ChangeProbability = InChangeProbability;
+}
+
+void FWeatherTimeline::Reset(int32 Seed, EWeatherType StartWeather, double Time)
+{
+	Cursor = FWeatherTimelineCursor();
+	Cursor.Seed = Seed;
+	Cursor.Weather = StartWeather;
+	Cursor.SegmentStart = Time;
+	Cursor.Time = Time;
+}
+
+int32 FWeatherTimeline::GetSegmentSeed() const
+{
+	return static_cast<int32>(HashCombine(GetTypeHash(Cursor.Seed), GetTypeHash(Cursor.Segment)));
+}
+
+FWeatherTimeline::FSegment FWeatherTimeline::RollSegment() const
+{
+	FSegment Segment;
+
+	if (Cursor.bForced)
+	{
+		Segment.TransitionDuration = FMath::Max(static_cast<double>(Cursor.ForcedTransitionDuration), MinTransitionSeconds);
+		Segment.Next = Cursor.ForcedTarget;
+		return Segment;
+	}
+
+	const FWeatherTransition* Rule = Rules ? Rules->Find(Cursor.Weather) : nullptr;
+	if (!Rule)
+	{
+		Segment.HoldDuration = DefaultHoldSeconds;
+		Segment.TransitionDuration = DefaultTransitionSeconds;
+		return Segment;
+	}
+
+	// Always roll in the same order - saves depend on it
+	FRandomStream Stream(GetSegmentSeed());
+	Segment.HoldDuration = Stream.FRandRange(Rule->MinDuration, Rule->MaxDuration) * ChangeProbability;
+	Segment.Next = RollNextWeather(*Rule, Stream);
+	Segment.TransitionDuration = FMath::Max(static_cast<double>(Rule->TransitionDuration), MinTransitionSeconds);
+	return Segment;
+}
+
+int32 FWeatherTimeline::Advance(double Seconds)
+{
+	SCOPE_CYCLE_COUNTER(STAT_WeatherTimelineAdvance);
+
+	Cursor.Time += FMath::Max(Seconds, 0.0);
+
+	int32 Crossed = 0;
+	for (;;)
+	{
+		const FSegment Segment = RollSegment();
+		const double SegmentEnd = Cursor.SegmentStart + Segment.HoldDuration + Segment.TransitionDuration;
+		if (Cursor.Time < SegmentEnd)
+		{
+			break;
+		}
+
+		Cursor.Weather = Segment.Next;
+		Cursor.SegmentStart = SegmentEnd;
+		Cursor.bForced = false;
+		++Cursor.Segment;
+		++Crossed;
+	}
+
+	INC_DWORD_STAT_BY(STAT_WeatherSegmentsCrossed, Crossed);
+	return Crossed;
+}
+
+void FWeatherTimeline::Hold(double Seconds)
+{
+	const FSegment Segment = RollSegment();
+	if (Cursor.Time - Cursor.SegmentStart < Segment.HoldDuration)
+	{
+		// Slide the segment along with the clock so the held phase never runs out
+		Cursor.Time += FMath::Max(Seconds, 0.0);
+		Cursor.SegmentStart += FMath::Max(Seconds, 0.0);
+	}
+	else
+	{
+		// A transition already under way still finishes
+		Advance(Seconds);
+	}
+}
+
+FWeatherTimelineState FWeatherTimeline::GetState() const
+{
+	const FSegment Segment = RollSegment();
+	const double Elapsed = Cursor.Time - Cursor.SegmentStart;
+
+	FWeatherTimelineState State;
+	State.Current = Cursor.Weather;
+
+	if (Elapsed < Segment.HoldDuration)
+	{
+		State.Target = Cursor.Weather;
+		State.TimeUntilChange = Segment.HoldDuration - Elapsed;
+	}
+	else
+	{
+		State.Target = Segment.Next;
+		State.bTransitioning = true;
+		State.TransitionProgress = FMath::Clamp(static_cast<float>((Elapsed - Segment.HoldDuration) / Segment.TransitionDuration), 0.0f, 1.0f);
+	}
+
+	return State;
+}
+
+FWeatherTimelineState FWeatherTimeline::Predict(double SecondsAhead) const
+{
+	FWeatherTimeline Ahead = *this;
+	Ahead.Advance(SecondsAhead);
+	return Ahead.GetState();
+}
+
+void FWeatherTimeline::Force(EWeatherType Weather)
+{
+	++Cursor.Segment;
+	Cursor.Weather = Weather;
+	Cursor.SegmentStart = Cursor.Time;
+	Cursor.bForced = false;
+}
+
+void FWeatherTimeline::ForceTransition(EWeatherType Target, float Duration)
+{
+	// Leave from whatever weather is showing - an interrupted transition restarts from its source
+	const EWeatherType From = GetState().Current;
+
+	++Cursor.Segment;
+	Cursor.Weather = From;
+	Cursor.SegmentStart = Cursor.Time;
+	Cursor.bForced = true;
+	Cursor.ForcedTarget = Target;
+	Cursor.ForcedTransitionDuration = Duration;
+}
+
+void FWeatherTimeline::BeginTransition()
+{
+	const FSegment Segment = RollSegment();
+	if (Cursor.Time - Cursor.SegmentStart < Segment.HoldDuration)
+	{
+		Cursor.SegmentStart = Cursor.Time - Segment.HoldDuration;
+	}
+}
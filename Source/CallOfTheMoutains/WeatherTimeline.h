@@ -0,0 +1,91 @@
+// CallOfTheMoutains - Weather Timeline
+// Seeded weather sequence that can be evaluated at any weather clock time without ticking
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DayNightTypes.h"
+
+struct FWeatherTransition;
+
+/**
+ * Weather at one point of a timeline
+ */
+struct FWeatherTimelineState
+{
+	/** Weather held, or the one being left while transitioning */
+	EWeatherType Current = EWeatherType::Clear;
+
+	/** Weather being transitioned to (Current while stable) */
+	EWeatherType Target = EWeatherType::Clear;
+
+	bool bTransitioning = false;
+	float TransitionProgress = 1.0f;
+
+	/** Seconds until the next transition starts (0 while transitioning) */
+	double TimeUntilChange = 0.0;
+};
+
+/**
+ * Weather Timeline
+ *
+ * The weather is a chain of segments: one weather held for a rolled duration, then the
+ * transition to a rolled next weather. Segment N rolls from a stream seeded with (Seed, N),
+ * so the sequence doesn't depend on frame timing - advancing a whole day in one call or by
+ * DeltaTime every frame gives the same weather, and seed + cursor restore it exactly.
+ *
+ * Advancing steps over whole segments (a few dozen per game day at default settings).
+ * Scripted weather (Force, ForceTransition) starts a new segment at the current time, so
+ * the timeline stays reproducible after it.
+ */
+class CALLOFTHEMOUTAINS_API FWeatherTimeline
+{
+public:
+	/** Rules segments are rolled from (must outlive the timeline). ChangeProbability scales held durations */
+	void SetRules(const TMap<EWeatherType, FWeatherTransition>* InRules, float InChangeProbability);
+
+	/** Start over from a seed, holding StartWeather from weather clock Time */
+	void Reset(int32 Seed, EWeatherType StartWeather, double Time = 0.0);
+
+	const FWeatherTimelineCursor& GetCursor() const { return Cursor; }
+	void SetCursor(const FWeatherTimelineCursor& InCursor) { Cursor = InCursor; }
+
+	/** Move the weather clock forward, stepping over whole segments. Returns the segments crossed */
+	int32 Advance(double Seconds);
+
+	/** Move the weather clock without using up the held phase (weather changes disabled) */
+	void Hold(double Seconds);
+
+	/** Weather at the cursor */
+	FWeatherTimelineState GetState() const;
+
+	/** Weather SecondsAhead from now, leaving the cursor where it is */
+	FWeatherTimelineState Predict(double SecondsAhead) const;
+
+	/** Hold a weather from now on (instant change) */
+	void Force(EWeatherType Weather);
+
+	/** Transition from the current weather to Target over Duration seconds, starting now */
+	void ForceTransition(EWeatherType Target, float Duration);
+
+	/** End the held phase now, so the rolled transition starts right away */
+	void BeginTransition();
+
+	/** Seed for per-segment effects that must also replay identically (lightning) */
+	int32 GetSegmentSeed() const;
+
+private:
+	/** Rolled shape of the cursor's segment */
+	struct FSegment
+	{
+		double HoldDuration = 0.0;
+		double TransitionDuration = 0.0;
+		EWeatherType Next = EWeatherType::Clear;
+	};
+
+	FSegment RollSegment() const;
+
+	const TMap<EWeatherType, FWeatherTransition>* Rules = nullptr;
+	float ChangeProbability = 1.0f;
+	FWeatherTimelineCursor Cursor;
+};
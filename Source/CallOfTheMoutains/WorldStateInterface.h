@@ -0,0 +1,35 @@
+// CallOfTheMoutains - World State Interface
+// Level-placed actors whose state persists in save games implement this interface
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Interface.h"
+#include "WorldStateInterface.generated.h"
+
+UINTERFACE(MinimalAPI, meta = (CannotImplementInterfaceInBlueprint))
+class UWorldStateInterface : public UInterface
+{
+	GENERATED_BODY()
+};
+
+/**
+ * Interface for actors tracked by UWorldStateSubsystem (pickups, enemies, fires, lamps)
+ * State is a small bitfield whose meaning is up to the implementing class.
+ * Call UWorldStateSubsystem::RegisterActor at the end of BeginPlay and MarkDirty whenever
+ * the state changes - the subsystem never polls.
+ */
+class CALLOFTHEMOUTAINS_API IWorldStateInterface
+{
+	GENERATED_BODY()
+
+public:
+	/** Stable id of this actor (invalid = not persistent, e.g. spawned at runtime) */
+	virtual FGuid GetWorldStateGuid() const = 0;
+
+	/** Current state to save */
+	virtual uint32 CaptureWorldState() const = 0;
+
+	/** Restore saved state (may destroy the actor) */
+	virtual void RestoreWorldState(uint32 State) = 0;
+};
@@ -0,0 +1,293 @@
+// CallOfTheMoutains - World State Subsystem Implementation
+
+#include "WorldStateSubsystem.h"
+#include "WorldStateInterface.h"
+#include "COTMSaveGame.h"
+#include "CallOfTheMoutains.h"
+#include "Engine/GameInstance.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "Misc/SecureHash.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+DECLARE_CYCLE_STAT(TEXT("World State Pack"), STAT_WorldStatePack, STATGROUP_CallOfTheMoutains);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("World State Levels Unpacked"), STAT_WorldStateLevelsUnpacked, STATGROUP_CallOfTheMoutains);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("World State Records Changed"), STAT_WorldStateRecordsChanged, STATGROUP_CallOfTheMoutains);
+
+namespace
+{
+	/** Bumped when the packed record layout changes - levels in other versions are dropped */
+	constexpr int32 WorldStatePackVersion = 1;
+}
+
+UWorldStateSubsystem* UWorldStateSubsystem::Get(const UObject* WorldContextObject)
+{
+	UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+	return GameInstance ? GameInstance->GetSubsystem<UWorldStateSubsystem>() : nullptr;
+}
+
+void UWorldStateSubsystem::Deinitialize()
+{
+	Levels.Empty();
+	LiveActors.Empty();
+
+	Super::Deinitialize();
+}
+
+// ==================== Actors ====================
+
+void UWorldStateSubsystem::RegisterActor(AActor* Actor)
+{
+	const IWorldStateInterface* StateActor = Cast<IWorldStateInterface>(Actor);
+	if (!StateActor)
+	{
+		return;
+	}
+
+	const FGuid Guid = StateActor->GetWorldStateGuid();
+	if (!Guid.IsValid())
+	{
+		return;
+	}
+
+	TWeakObjectPtr<AActor>& Entry = LiveActors.FindOrAdd(Guid);
+	if (Entry.IsValid() && Entry.Get() != Actor)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("WorldState: %s shares its GUID with %s - re-save the level to fix duplicated GUIDs"),
+			*Actor->GetName(), *Entry->GetName());
+	}
+	Entry = Actor;
+
+	RestoreActor(Actor, Guid);
+}
+
+void UWorldStateSubsystem::MarkDirty(AActor* Actor)
+{
+	const IWorldStateInterface* StateActor = Cast<IWorldStateInterface>(Actor);
+	const FGuid Guid = StateActor ? StateActor->GetWorldStateGuid() : FGuid();
+	if (!Guid.IsValid())
+	{
+		return;
+	}
+
+	const FName LevelKey = GetLevelKey(Actor);
+	FWorldStateLevel& Level = Levels.FindOrAdd(LevelKey);
+	Unpack(LevelKey, Level);
+
+	// Restores report their own state back - nothing changed
+	const uint32 State = StateActor->CaptureWorldState();
+	const uint32* ExistingState = Level.Records.Find(Guid);
+	if (ExistingState && *ExistingState == State)
+	{
+		return;
+	}
+
+	Level.Records.Add(Guid, State);
+	Level.bDirty = true;
+	INC_DWORD_STAT(STAT_WorldStateRecordsChanged);
+}
+
+void UWorldStateSubsystem::NotifyStateChanged(AActor* Actor)
+{
+	if (UWorldStateSubsystem* WorldState = Get(Actor))
+	{
+		WorldState->MarkDirty(Actor);
+	}
+}
+
+void UWorldStateSubsystem::ResolveAndRegister(AActor* Actor, FGuid& Guid)
+{
+	Guid = ResolveGuid(Actor, Guid);
+	if (UWorldStateSubsystem* WorldState = Get(Actor))
+	{
+		WorldState->RegisterActor(Actor);
+	}
+}
+
+void UWorldStateSubsystem::RestoreActor(AActor* Actor, const FGuid& Guid)
+{
+	const FName LevelKey = GetLevelKey(Actor);
+	FWorldStateLevel* Level = Levels.Find(LevelKey);
+	if (!Level)
+	{
+		return;
+	}
+
+	Unpack(LevelKey, *Level);
+	if (const uint32* State = Level->Records.Find(Guid))
+	{
+		CastChecked<IWorldStateInterface>(Actor)->RestoreWorldState(*State);
+	}
+}
+
+// ==================== Save Game ====================
+
+void UWorldStateSubsystem::WriteToSave(UCOTMSaveGame* SaveObject)
+{
+	if (!SaveObject)
+	{
+		return;
+	}
+
+	SaveObject->WorldStateLevels.Reset(Levels.Num());
+	for (TPair<FName, FWorldStateLevel>& Pair : Levels)
+	{
+		if (Pair.Value.bDirty)
+		{
+			Pack(Pair.Value);
+		}
+
+		if (Pair.Value.PackedRecords.Num() > 0)
+		{
+			FSavedWorldStateLevel& SavedLevel = SaveObject->WorldStateLevels.AddDefaulted_GetRef();
+			SavedLevel.LevelName = Pair.Key;
+			SavedLevel.PackedRecords = Pair.Value.PackedRecords;
+		}
+	}
+}
+
+void UWorldStateSubsystem::ReadFromSave(const UCOTMSaveGame* SaveObject)
+{
+	if (!SaveObject)
+	{
+		return;
+	}
+
+	Levels.Reset();
+	for (const FSavedWorldStateLevel& SavedLevel : SaveObject->WorldStateLevels)
+	{
+		Levels.Add(SavedLevel.LevelName).PackedRecords = SavedLevel.PackedRecords;
+	}
+
+	// Actors already in play get their state now; later ones get it when they register.
+	// Restoring can destroy actors, so walk a copy.
+	TArray<TPair<FGuid, TWeakObjectPtr<AActor>>> Registered = LiveActors.Array();
+	for (const TPair<FGuid, TWeakObjectPtr<AActor>>& Pair : Registered)
+	{
+		if (AActor* Actor = Pair.Value.Get())
+		{
+			RestoreActor(Actor, Pair.Key);
+		}
+		else
+		{
+			LiveActors.Remove(Pair.Key);
+		}
+	}
+}
+
+void UWorldStateSubsystem::ResetState()
+{
+	Levels.Reset();
+}
+
+void UWorldStateSubsystem::Unpack(FName LevelName, FWorldStateLevel& Level)
+{
+	if (Level.bUnpacked)
+	{
+		return;
+	}
+
+	Level.bUnpacked = true;
+	if (Level.PackedRecords.Num() == 0)
+	{
+		return;
+	}
+
+	INC_DWORD_STAT(STAT_WorldStateLevelsUnpacked);
+
+	FMemoryReader Reader(Level.PackedRecords);
+	int32 Version = 0;
+	int32 NumRecords = 0;
+	Reader << Version << NumRecords;
+
+	if (Version != WorldStatePackVersion || NumRecords < 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("WorldState: Dropping %s records (pack version %d)"), *LevelName.ToString(), Version);
+		Level.PackedRecords.Reset();
+		return;
+	}
+
+	Level.Records.Reserve(NumRecords);
+	for (int32 i = 0; i < NumRecords && !Reader.IsError(); ++i)
+	{
+		FGuid Guid;
+		uint32 State = 0;
+		Reader << Guid << State;
+		Level.Records.Add(Guid, State);
+	}
+}
+
+void UWorldStateSubsystem::Pack(FWorldStateLevel& Level)
+{
+	SCOPE_CYCLE_COUNTER(STAT_WorldStatePack);
+
+	Level.PackedRecords.Reset();
+	Level.bDirty = false;
+
+	if (Level.Records.Num() == 0)
+	{
+		return;
+	}
+
+	FMemoryWriter Writer(Level.PackedRecords);
+	int32 Version = WorldStatePackVersion;
+	int32 NumRecords = Level.Records.Num();
+	Writer << Version << NumRecords;
+
+	for (TPair<FGuid, uint32>& Pair : Level.Records)
+	{
+		Writer << Pair.Key << Pair.Value;
+	}
+}
+
+// ==================== GUIDs ====================
+
+void UWorldStateSubsystem::AssignEditorGuid(AActor* Actor, FGuid& Guid)
+{
+	const UWorld* World = Actor ? Actor->GetWorld() : nullptr;
+	if (!Guid.IsValid() && World && !World->IsGameWorld() && !Actor->IsTemplate())
+	{
+		// Same GUID ResolveGuid derives at runtime, so a legacy actor keeps the state saved under it
+		Actor->Modify();
+		Guid = MakeNameGuid(Actor);
+	}
+}
+
+#if WITH_EDITOR
+void UWorldStateSubsystem::RegenerateImportedGuid(FGuid& Guid)
+{
+	// The copied GUID belongs to the original
+	Guid = FGuid::NewGuid();
+}
+#endif
+
+FGuid UWorldStateSubsystem::ResolveGuid(const AActor* Actor, const FGuid& StoredGuid)
+{
+	if (StoredGuid.IsValid() || !Actor || !Actor->IsNetStartupActor())
+	{
+		return StoredGuid;
+	}
+
+	return MakeNameGuid(Actor);
+}
+
+FGuid UWorldStateSubsystem::MakeNameGuid(const AActor* Actor)
+{
+	// Actor names are unique and stable within a level
+	const FString Key = GetLevelKey(Actor).ToString() + TEXT(".") + Actor->GetFName().ToString();
+
+	FMD5 Md5;
+	Md5.Update(reinterpret_cast<const uint8*>(*Key), Key.Len() * sizeof(TCHAR));
+	uint32 Digest[4];
+	Md5.Final(reinterpret_cast<uint8*>(Digest));
+	return FGuid(Digest[0], Digest[1], Digest[2], Digest[3]);
+}
+
+FName UWorldStateSubsystem::GetLevelKey(const AActor* Actor)
+{
+	const ULevel* Level = Actor ? Actor->GetLevel() : nullptr;
+	const UPackage* Package = Level ? Level->GetPackage() : nullptr;
+	return Package ? FName(*UWorld::RemovePIEPrefix(Package->GetName())) : NAME_None;
+}
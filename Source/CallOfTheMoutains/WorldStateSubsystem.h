@@ -0,0 +1,116 @@
+// CallOfTheMoutains - World State Subsystem
+// Persistent state of level-placed actors (pickups, enemies, fires, lamps), per level
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "WorldStateSubsystem.generated.h"
+
+class UCOTMSaveGame;
+
+/**
+ * State records of one level
+ */
+struct FWorldStateLevel
+{
+	/** Records as stored in the save (valid while !bUnpacked or until re-packed) */
+	TArray<uint8> PackedRecords;
+
+	/** Actor GUID -> state, filled on first use */
+	TMap<FGuid, uint32> Records;
+
+	bool bUnpacked = false;
+
+	/** Records changed since PackedRecords was built */
+	bool bDirty = false;
+};
+
+/**
+ * World State Subsystem
+ * Actors implementing IWorldStateInterface register at BeginPlay and report state changes
+ * as they happen, so saving never iterates the world: only levels with changes are re-packed,
+ * and every other level's packed bytes are copied into the save as-is.
+ *
+ * Loading keeps each level's records packed until the first actor of that level registers,
+ * so streaming levels unpack their own state when they come in. Only actors whose state was
+ * ever reported have a record; everything else keeps its placed state.
+ *
+ * Lives on the game instance, so state survives level travel within a session.
+ */
+UCLASS()
+class CALLOFTHEMOUTAINS_API UWorldStateSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Get the subsystem for a world context (nullptr if unavailable) */
+	static UWorldStateSubsystem* Get(const UObject* WorldContextObject);
+
+	virtual void Deinitialize() override;
+
+	// ==================== Actors ====================
+
+	/** Track an actor and restore its saved state, if any. Call at the end of BeginPlay */
+	void RegisterActor(AActor* Actor);
+
+	/** Record an actor's current state (game thread, on every state change) */
+	void MarkDirty(AActor* Actor);
+
+	/** Convenience for actors reporting a state change */
+	static void NotifyStateChanged(AActor* Actor);
+
+	/** Resolve an actor's stored GUID (see ResolveGuid) and register it. Call at the end of BeginPlay */
+	static void ResolveAndRegister(AActor* Actor, FGuid& Guid);
+
+	// ==================== Save Game ====================
+
+	/** Copy every level's records into a save (re-packs only dirty levels) */
+	void WriteToSave(UCOTMSaveGame* SaveObject);
+
+	/** Replace all state with a save's and restore it onto registered actors */
+	void ReadFromSave(const UCOTMSaveGame* SaveObject);
+
+	/** Drop every level's records (switching profiles) - registered actors stay tracked */
+	void ResetState();
+
+	/** Number of levels with saved state */
+	int32 GetNumLevels() const { return Levels.Num(); }
+
+	// ==================== GUIDs ====================
+
+	/** Give a placed actor a GUID in the editor (call from OnConstruction; no-op in game worlds). Marks the actor modified. */
+	static void AssignEditorGuid(AActor* Actor, FGuid& Guid);
+
+#if WITH_EDITOR
+	/** Give a pasted or duplicated actor its own GUID (call from PostEditImport) */
+	static void RegenerateImportedGuid(FGuid& Guid);
+#endif
+
+	/**
+	 * GUID to use at runtime: the stored one, else one derived from the level and actor name for
+	 * actors placed before they had a GUID. Runtime-spawned actors get none and aren't persisted.
+	 */
+	static FGuid ResolveGuid(const AActor* Actor, const FGuid& StoredGuid);
+
+	/** Key of the level an actor was placed in (PIE prefix stripped) */
+	static FName GetLevelKey(const AActor* Actor);
+
+private:
+	/** GUID hashed from the actor's level and name (shared by AssignEditorGuid and ResolveGuid) */
+	static FGuid MakeNameGuid(const AActor* Actor);
+
+	TMap<FName, FWorldStateLevel> Levels;
+
+	/** Registered actors by GUID - stale entries are skipped and pruned on ReadFromSave */
+	TMap<FGuid, TWeakObjectPtr<AActor>> LiveActors;
+
+	/** Restore an actor's record, if its level has one */
+	void RestoreActor(AActor* Actor, const FGuid& Guid);
+
+	/** Decode a level's packed records (once) */
+	void Unpack(FName LevelName, FWorldStateLevel& Level);
+
+	/** Encode a level's records */
+	static void Pack(FWorldStateLevel& Level);
+};